@@ -0,0 +1,70 @@
+/** -----------------------------------------------------------------------------------------------
+ *  File: main.c
+ *  Description: Compiles the code of a ROM ahead of time to C, to be built to a shared object
+ *               and loaded with gb_aot_load.
+ *  ----------------------------------------------------------------------------------------------- */
+#include "gb/aot.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * helper function to read file contents to `data`.
+ */
+static int read_file (const char *fp, void **data, size_t *bytes)
+{
+	FILE* f = fopen (fp, "rb");
+	if (!f)
+	{
+		fprintf (stderr, "could not open file @ %s\n", fp);
+		return 1;
+	}
+	fseek (f, 0, SEEK_END);
+	*bytes = ftell (f);
+	rewind (f);
+	*data = calloc (*bytes, 1);
+
+	size_t ret = fread (*data, 1, *bytes, f);
+	fclose (f);
+	if (ret != *bytes)
+	{
+		fprintf (stderr, "could not read the entire file! got %ld of %ld bytes\n", ret, *bytes);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main (int argc, char** argv)
+{
+	if (argc != 3)
+	{
+		fprintf (stderr, "usage: %s rom out.c\n", argv[0]);
+		exit (1);
+	}
+
+	uint8_t *rom = NULL;
+	size_t bytes;
+	if (read_file (argv[1], (void **) &rom, &bytes) != 0)
+		exit (1);
+
+	if (bytes < GB_AOT_HEADER_LOC + GB_AOT_HEADER_SIZE)
+	{
+		fprintf (stderr, "%s is too small to be a ROM\n", argv[1]);
+		exit (1);
+	}
+
+	FILE *f = fopen (argv[2], "w");
+	if (!f)
+	{
+		fprintf (stderr, "could not open file @ %s\n", argv[2]);
+		exit (1);
+	}
+
+	int n = gb_aot_compile (rom, bytes, f);
+	fclose (f);
+	free (rom);
+
+	printf ("%d blocks written to %s, build them with\n", n, argv[2]);
+	printf ("\tcc -O2 -shared -fPIC -I include -o %s.so %s\n", argv[1], argv[2]);
+	return 0;
+}
@@ -26,6 +26,9 @@
 #define VERTEX_SHADER_FILE "examples/app/shaders/vertex.glsl"
 #define FRAGMENT_SHADER_FILE "examples/app/shaders/fragment.glsl"
 
+/* emulator instance. */
+static gb_t *gb;
+
 /**
  * helper function to read file contents to `data`.
  */
@@ -247,7 +250,7 @@ void draw ()
 	SDL_GetWindowSize (sdl_window, &width, &height);
 	glViewport (0, 0, width, height);
 
-	const uint16_t *screen = gb_lcd ();
+	const uint16_t *screen = gb_lcd (gb);
 	glTexImage2D
 	(
 		GL_TEXTURE_2D,
@@ -326,7 +329,7 @@ static int audio_play ()
 	int ret = 0;
 	size_t size;
 
-	gb_audio_samples (audio_samples_buffer, &size);
+	gb_audio_samples (gb, audio_samples_buffer, &size);
 	if ((ret = SDL_QueueAudio (audio_devid, audio_samples_buffer, size)) != 0)
 	{
 		fprintf (stderr, "[error] audio_play > could not queue samples.\n");
@@ -348,7 +351,7 @@ static int audio_play ()
 	int err;
 	size_t size;
 
-	gb_audio_samples (audio_samples_buffer, &size);
+	gb_audio_samples (gb, audio_samples_buffer, &size);
 
 	if (pa_simple_write (audioconn, audio_samples_buffer, size, &err) < 0)
 		fprintf (stderr, "pa_simple_write: %s\n", pa_strerror (err));
@@ -368,7 +371,7 @@ static int audio_quit ()
 	int err;
 	size_t size;
 
-	gb_audio_samples (audio_samples_buffer, &size);
+	gb_audio_samples (gb, audio_samples_buffer, &size);
 
 	if (pa_simple_write (audioconn, audio_samples_buffer, size, &err) < 0)
 		fprintf (stderr, "pa_simple_write: %s\n", pa_strerror (err));
@@ -384,7 +387,7 @@ static int running = 0;
 static void handle_events ()
 {
 	SDL_Event event;
-	void (*key_func) (gb_button);
+	void (*key_func) (gb_t *, gb_button);
 
 	while (SDL_PollEvent (&event))
 	{
@@ -400,35 +403,35 @@ static void handle_events ()
 				switch (event.key.keysym.sym)
 				{
 					case SDLK_a:
-						key_func (gb_io_b_left);
+						key_func (gb, gb_io_b_left);
 						break;
 
 					case SDLK_s:
-						key_func (gb_io_b_down);
+						key_func (gb, gb_io_b_down);
 						break;
 
 					case SDLK_d:
-						key_func (gb_io_b_right);
+						key_func (gb, gb_io_b_right);
 						break;
 
 					case SDLK_w:
-						key_func (gb_io_b_up);
+						key_func (gb, gb_io_b_up);
 						break;
 
 					case SDLK_j:
-						key_func (gb_io_b_a);
+						key_func (gb, gb_io_b_a);
 						break;
 
 					case SDLK_k:
-						key_func (gb_io_b_b);
+						key_func (gb, gb_io_b_b);
 						break;
 
 					case SDLK_SPACE:
-						key_func (gb_io_b_start);
+						key_func (gb, gb_io_b_start);
 						break;
 
 					case SDLK_x:
-						key_func (gb_io_b_select);
+						key_func (gb, gb_io_b_select);
 						break;
 
 					case SDLK_q:
@@ -451,7 +454,12 @@ int main (int argc, char** argv)
 	size_t bytes;
 
 	// emulator and load ROM
-	gb_init (SAMPLE_RATE);
+	gb = gb_init (SAMPLE_RATE);
+	if (!gb)
+	{
+		fprintf (stderr, "could not create emulator instance\n");
+		exit (1);
+	}
 
 	// ROM data
 	uint8_t *rom;
@@ -475,7 +483,7 @@ int main (int argc, char** argv)
 	size_t ram_size;
 
 	// load the game
-	if (gb_load (rom, &ram, &ram_size) != 0)
+	if (gb_load (gb, rom, &ram, &ram_size) != 0)
 		exit (1);
 
 	// video
@@ -500,7 +508,7 @@ int main (int argc, char** argv)
 
 	while (running)
 	{
-		cc += gb_step (STEP);
+		cc += gb_step (gb, STEP);
 
 		if (cc >= GB_FRAME)
 		{
@@ -524,9 +532,10 @@ int main (int argc, char** argv)
 		fwrite (ram, 1, ram_size, f);
 	}
 
-	gb_quit ();
-	quit_opengl ();
+	// the audio drains the samples of the instance
 	audio_quit ();
+	quit_opengl ();
+	gb_quit (gb);
 
 	free (ram);
 	free (rom);
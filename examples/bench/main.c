@@ -0,0 +1,341 @@
+/** -----------------------------------------------------------------------------------------------
+ *  File: main.c
+ *  Description: Micro-benchmarks of the hot paths of the emulator: CPU dispatch, memory
+ *               accesses, the PPU and the APU. The games are small synthetic ROMs built in
+ *               memory so no game data is needed.
+ *  ----------------------------------------------------------------------------------------------- */
+#include "gb.h"
+#include "gb/cpu.h"
+#include "gb/ppu.h"
+#include "gb/apu.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SAMPLE_RATE 44100
+
+/* each benchmark is run this many times and the fastest run is reported. */
+#define RUNS 5
+
+/* frames of emulated time for each run. */
+#define FRAMES 60
+
+#define ROM_SIZE 0x8000
+#define CODE_LOC 0x0150
+
+static double now ()
+{
+	struct timespec t;
+	clock_gettime (CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* Synthetic ROM ------------------------------------------------------------------ */
+
+static const uint8_t LOGO[48] =
+{
+	0xCE, 0xED, 0x66, 0x66, 0xCC, 0x0D, 0x00, 0x0B, 0x03, 0x73, 0x00, 0x83, 0x00, 0x0C, 0x00, 0x0D,
+	0x00, 0x08, 0x11, 0x1F, 0x88, 0x89, 0x00, 0x0E, 0xDC, 0xCC, 0x6E, 0xE6, 0xDD, 0xDD, 0xD9, 0x99,
+	0xBB, 0xBB, 0x67, 0x63, 0x6E, 0x0E, 0xEC, 0xCC, 0xDD, 0xDC, 0x99, 0x9F, 0xBB, 0xB9, 0x33, 0x3E
+};
+
+/**
+ * Build a 32KB ROM without MBC that runs the setup code with interrupts disabled and
+ * then loops over the body repeated a number of times. Without a body it spins.
+ */
+static uint8_t *build_rom
+(
+	int cgb,
+	const uint8_t *setup, size_t setup_len,
+	const uint8_t *body, size_t body_len, int repeat
+)
+{
+	uint8_t *rom = calloc (ROM_SIZE, 1);
+	uint8_t *p = rom + CODE_LOC;
+
+	// entry point: nop, jp $0150
+	memcpy (rom + 0x100, (uint8_t []) { 0x00, 0xC3, CODE_LOC & 0xFF, CODE_LOC >> 8 }, 4);
+	memcpy (rom + 0x104, LOGO, sizeof (LOGO));
+	memcpy (rom + 0x134, "BENCH", 5);
+	rom[0x143] = cgb ? 0x80 : 0x00;
+
+	int x = 0;
+	for (int i = 0x134; i < 0x14D; i ++)
+		x = x - rom[i] - 1;
+	rom[0x14D] = x;
+
+	// di, ld sp,$FFFE
+	memcpy (p, (uint8_t []) { 0xF3, 0x31, 0xFE, 0xFF }, 4);
+	p += 4;
+
+	memcpy (p, setup, setup_len);
+	p += setup_len;
+
+	uint8_t *loop = p;
+	for (int i = 0; i < repeat; i ++, p += body_len)
+		memcpy (p, body, body_len);
+
+	// jr loop
+	*p = 0x18;
+	*(p + 1) = loop - (p + 2);
+
+	return rom;
+}
+
+static gb_t *load (const uint8_t *rom)
+{
+	uint8_t *ram = NULL;
+	size_t ram_size;
+
+	gb_t *gb = gb_init (SAMPLE_RATE);
+	if (!gb || gb_load (gb, rom, &ram, &ram_size) != 0)
+	{
+		fprintf (stderr, "could not load synthetic ROM\n");
+		exit (1);
+	}
+	return gb;
+}
+
+/* Benchmarks -------------------------------------------------------------------- */
+
+/* outcome of one run, the number of operations and CPU cycles that were emulated. */
+typedef
+struct result
+{
+	uint64_t ops;
+	uint64_t cc;
+}
+result;
+
+typedef result (* run_fn) (gb_t *) ;
+
+static float samples[SAMPLE_RATE];
+
+static void report (const char *name, const char *op, run_fn run, gb_t *gb)
+{
+	double best = 0;
+	result r;
+
+	for (int i = 0; i < RUNS; i ++)
+	{
+		double start = now ();
+		r = run (gb);
+		double t = now () - start;
+		if (i == 0 || t < best) best = t;
+	}
+
+	printf (
+		"%-20s %10.2f ns/%-6s %14.0f cycles/s %7.1fx\n",
+		name,
+		best * 1e9 / r.ops,
+		op,
+		r.cc / best,
+		r.cc / best / GB_CPU_CLOCK
+	);
+}
+
+/**
+ * Dispatch: 63 single cycle register operations and a jump back, with the LCD off so
+ * the CPU mostly runs alone.
+ */
+#define DISPATCH_OPS 64
+#define DISPATCH_CC (63 * 4 + 12)
+
+static const uint8_t DISPATCH_SETUP[] =
+{
+	0xAF,       // xor a
+	0xE0, 0x40, // ldh ($40),a ; LCD off
+};
+
+static const uint8_t DISPATCH_BODY[] =
+{
+	0x3C, // inc a
+	0x80, // add a,b
+	0x47, // ld b,a
+	0xA9, // xor c
+	0x1D, // dec e
+	0x65, // ld h,l
+	0xB2, // or d
+	0x4F, // ld c,a
+	0x07, // rlca
+};
+
+static result run_cpu (gb_t *gb)
+{
+	result r = { 0 };
+	for (int i = 0; i < FRAMES; i ++)
+	{
+		r.cc += gb_step (gb, GB_FRAME);
+		gb_audio_samples (gb, samples, (size_t []) { 0 });
+	}
+	return r;
+}
+
+static result run_dispatch (gb_t *gb)
+{
+	result r = run_cpu (gb);
+	r.ops = r.cc * DISPATCH_OPS / DISPATCH_CC;
+	return r;
+}
+
+/**
+ * Memory: reads and stores to WRAM, banked WRAM, HRAM, ROM and IO registers which go
+ * through the handlers.
+ */
+#define MEMORY_REPEAT 6
+#define MEMORY_OPS (MEMORY_REPEAT * 9)
+#define MEMORY_CC (MEMORY_REPEAT * (5 * 8 + 4 * 12 + 4) + 12)
+
+static const uint8_t MEMORY_SETUP[] =
+{
+	0x21, 0x00, 0xC0, // ld hl,$C000
+	0x11, 0x00, 0xD0, // ld de,$D000
+	0x01, 0x00, 0x40, // ld bc,$4000
+};
+
+static const uint8_t MEMORY_BODY[] =
+{
+	0x7E,       // ld a,(hl)
+	0x12,       // ld (de),a
+	0x1A,       // ld a,(de)
+	0x77,       // ld (hl),a
+	0xF0, 0x00, // ldh a,($00) ; joypad
+	0xE0, 0x80, // ldh ($80),a
+	0xF0, 0x80, // ldh a,($80)
+	0xE0, 0x01, // ldh ($01),a ; serial data
+	0x0A,       // ld a,(bc)
+	0x2C,       // inc l
+};
+
+static result run_memory (gb_t *gb)
+{
+	result r = run_cpu (gb);
+	r.ops = r.cc * MEMORY_OPS / MEMORY_CC;
+	return r;
+}
+
+/* PPU: full frames with the window and all 40 sprites enabled. */
+static void setup_ppu (gb_t *gb)
+{
+	*gb_cpu_mem (gb, 0xFF40) = 0xF3; // LCD, window at $9C00, tiles at $8000, sprites, BG
+	*gb_cpu_mem (gb, 0xFF4A) = 0x40; // WY
+	*gb_cpu_mem (gb, 0xFF4B) = 0x57; // WX
+	*gb_cpu_mem (gb, 0xFF47) = 0xE4; // BGP
+	*gb_cpu_mem (gb, 0xFF48) = 0xD2; // OBP0
+	*gb_cpu_mem (gb, 0xFF49) = 0x1B; // OBP1
+
+	// tile data and maps
+	for (int i = 0; i < 0x1800; i ++)
+		*gb_cpu_mem (gb, VRAM_LOC + i) = i * 37 + (i >> 4);
+	for (int i = 0; i < 0x800; i ++)
+		*gb_cpu_mem (gb, 0x9800 + i) = i * 7;
+
+	// sprites spread out so most lines have some
+	for (int i = 0; i < 40; i ++)
+	{
+		uint8_t *s = gb_cpu_mem (gb, OAM_LOC + i * 4);
+		s[0] = 16 + (i * 29) % GB_LCD_HEIGHT;
+		s[1] = 8 + (i * 17) % GB_LCD_WIDTH;
+		s[2] = i * 3;
+		s[3] = (i & 3) << 5 | (i & 1) << 4;
+	}
+}
+
+static result run_ppu (gb_t *gb)
+{
+	result r = { 0 };
+	for (int i = 0; i < FRAMES; i ++)
+		gb_ppu_step (gb, GB_FRAME);
+	r.cc = (uint64_t) FRAMES * GB_FRAME;
+	r.ops = FRAMES;
+	return r;
+}
+
+/* APU: all four channels playing without length counters, sampled at 44.1 kHz. */
+static const uint8_t APU_SETUP[] =
+{
+	0x3E, 0x80, 0xE0, 0x26, // NR52: sound on
+	0x3E, 0x77, 0xE0, 0x24, // NR50: full volume
+	0x3E, 0xFF, 0xE0, 0x25, // NR51: all channels to both terminals
+
+	0x3E, 0x00, 0xE0, 0x10, // NR10: no sweep
+	0x3E, 0x80, 0xE0, 0x11, // NR11: 50% duty
+	0x3E, 0xF0, 0xE0, 0x12, // NR12: volume 15
+	0x3E, 0x00, 0xE0, 0x13,
+	0x3E, 0x87, 0xE0, 0x14, // NR14: trigger
+
+	0x3E, 0x40, 0xE0, 0x16, // NR21: 25% duty
+	0x3E, 0xF0, 0xE0, 0x17,
+	0x3E, 0x80, 0xE0, 0x18,
+	0x3E, 0x86, 0xE0, 0x19, // NR24: trigger
+
+	0x21, 0x30, 0xFF,       // ld hl,$FF30 ; wave pattern
+	0x3E, 0x9D,             // ld a,$9D
+	0x22,                   // ld (hl+),a
+	0xCB, 0x75,             // bit 6,l
+	0x28, 0xFB,             // jr z,-5 (until $FF40)
+	0x3E, 0x80, 0xE0, 0x1A, // NR30: wave on
+	0x3E, 0x20, 0xE0, 0x1C, // NR32: full volume
+	0x3E, 0x00, 0xE0, 0x1D,
+	0x3E, 0x85, 0xE0, 0x1E, // NR34: trigger
+
+	0x3E, 0xF0, 0xE0, 0x21, // NR42: volume 15
+	0x3E, 0x22, 0xE0, 0x22, // NR43: clock shift and divider
+	0x3E, 0x80, 0xE0, 0x23, // NR44: trigger
+};
+
+static result run_apu (gb_t *gb)
+{
+	result r = { 0 };
+	for (int i = 0; i < FRAMES; i ++)
+	{
+		gb_apu_step (gb, GB_FRAME);
+		gb_audio_samples (gb, samples, (size_t []) { 0 });
+	}
+	r.cc = (uint64_t) FRAMES * GB_FRAME;
+	r.ops = FRAMES;
+	return r;
+}
+
+int main (int argc, char** argv)
+{
+	uint8_t *rom;
+	gb_t *gb;
+
+	printf ("%d runs of %d frames, fastest run\n", RUNS, FRAMES);
+
+	for (int cgb = 0; cgb <= 1; cgb ++)
+	{
+		const char *mode = cgb ? "cgb" : "dmg";
+		char name[32];
+
+		rom = build_rom (cgb, DISPATCH_SETUP, sizeof (DISPATCH_SETUP), DISPATCH_BODY, sizeof (DISPATCH_BODY), 7);
+		gb = load (rom);
+		snprintf (name, sizeof (name), "dispatch %s", mode);
+		report (name, "op", run_dispatch, gb);
+		gb_quit (gb); free (rom);
+
+		rom = build_rom (cgb, MEMORY_SETUP, sizeof (MEMORY_SETUP), MEMORY_BODY, sizeof (MEMORY_BODY), MEMORY_REPEAT);
+		gb = load (rom);
+		snprintf (name, sizeof (name), "mem_read/store %s", mode);
+		report (name, "access", run_memory, gb);
+		gb_quit (gb); free (rom);
+
+		rom = build_rom (cgb, NULL, 0, NULL, 0, 0);
+		gb = load (rom);
+		setup_ppu (gb);
+		snprintf (name, sizeof (name), "ppu %s", mode);
+		report (name, "frame", run_ppu, gb);
+		gb_quit (gb); free (rom);
+
+		rom = build_rom (cgb, APU_SETUP, sizeof (APU_SETUP), NULL, 0, 0);
+		gb = load (rom);
+		gb_step (gb, GB_FRAME); // run the setup
+		snprintf (name, sizeof (name), "apu %s", mode);
+		report (name, "frame", run_apu, gb);
+		gb_quit (gb); free (rom);
+	}
+
+	return 0;
+}
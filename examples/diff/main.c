@@ -0,0 +1,362 @@
+/** -----------------------------------------------------------------------------------------------
+ *  File: main.c
+ *  Description: Runs a ROM on two builds of the emulator in lockstep and reports the first point
+ *               where their registers, memory or screen differ. Each build of this program is
+ *               also the tracer that the other side runs, started with -t.
+ *  ----------------------------------------------------------------------------------------------- */
+#include "gb.h"
+#include "gb/core.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <inttypes.h>
+
+#define SAMPLE_RATE 44100
+#define DEFAULT_CONTEXT 8
+#define MAX_INPUTS 1024
+
+/* state of the emulator after a step, compared between the two builds. */
+typedef
+struct record
+{
+	uint64_t n;
+	uint64_t cc;
+	uint16_t af, bc, de, hl, sp, pc;
+	uint8_t ime, halt;
+	uint64_t mem;
+	uint64_t lcd;
+}
+record;
+
+/* button pressed or released at the start of a frame. */
+typedef
+struct input
+{
+	uint64_t frame;
+	gb_button button;
+	int pressed;
+}
+input;
+
+static const char *buttons[8] = { "right", "left", "up", "down", "a", "b", "select", "start" };
+
+static input inputs[MAX_INPUTS];
+static int n_inputs, next_input;
+
+/* granularity of the comparison by name and the number of cycles each step runs. */
+static const struct { const char *name; uint32_t cc; } steps[] =
+{
+	{ "instruction", 1 },
+	{ "scanline", GB_SCANLINE },
+	{ "frame", GB_FRAME },
+};
+
+static uint32_t step_cc = GB_FRAME;
+static const char *step_name = "frame";
+static uint64_t start_frame = 0;
+static uint64_t n_records = 1000;
+static int context = DEFAULT_CONTEXT;
+static const char *inputs_path = NULL;
+
+/**
+ * helper function to read file contents to `data`.
+ */
+static int read_file (const char *fp, void **data, size_t *bytes)
+{
+	FILE* f = fopen (fp, "rb");
+	if (!f)
+	{
+		fprintf (stderr, "could not open file @ %s\n", fp);
+		return 1;
+	}
+	fseek (f, 0, SEEK_END);
+	*bytes = ftell (f);
+	rewind (f);
+	*data = calloc (*bytes, 1);
+
+	size_t ret = fread (*data, 1, *bytes, f);
+	fclose (f);
+	if (ret != *bytes)
+	{
+		fprintf (stderr, "could not read the entire file! got %ld of %ld bytes\n", ret, *bytes);
+		return 1;
+	}
+
+	return 0;
+}
+
+/* read inputs as lines of `frame button press|release`, sorted by frame. */
+static int read_inputs (const char *fp)
+{
+	FILE *f = fopen (fp, "r");
+	if (!f)
+	{
+		fprintf (stderr, "could not open file @ %s\n", fp);
+		return 1;
+	}
+
+	char button[16], state[16];
+	uint64_t frame;
+	while (n_inputs < MAX_INPUTS && fscanf (f, "%" SCNu64 " %15s %15s", &frame, button, state) == 3)
+	{
+		input *in = &inputs[n_inputs];
+		in->frame = frame;
+		in->pressed = strcmp (state, "press") == 0;
+		in->button = 8;
+		for (int b = 0; b < 8; b ++)
+			if (strcmp (button, buttons[b]) == 0) in->button = b;
+
+		if (in->button == 8 || (frame < (n_inputs ? inputs[n_inputs - 1].frame : 0)))
+		{
+			fprintf (stderr, "bad input on line %d of %s\n", n_inputs + 1, fp);
+			fclose (f);
+			return 1;
+		}
+		n_inputs ++;
+	}
+	fclose (f);
+	return 0;
+}
+
+/* step the emulator after applying the inputs of the frames that have started. */
+static uint32_t step (gb_t *gb, uint32_t cc)
+{
+	for (; next_input < n_inputs && inputs[next_input].frame * GB_FRAME <= gb->cc; next_input ++)
+	{
+		input *in = &inputs[next_input];
+		if (in->pressed) gb_press_button (gb, in->button);
+		else gb_release_button (gb, in->button);
+	}
+	return gb_step (gb, cc);
+}
+
+/* FNV-1a, the bytes in [skip, skip + n_skip) are left out. */
+static uint64_t hash (uint64_t h, const uint8_t *p, size_t n, size_t skip, size_t n_skip)
+{
+	for (size_t i = 0; i < n; i ++)
+	{
+		if (i >= skip && i < skip + n_skip) continue;
+		h = (h ^ p[i]) * 0x100000001B3ULL;
+	}
+	return h;
+}
+
+static void fill_record (gb_t *gb, uint64_t n, record *r)
+{
+	memset (r, 0, sizeof (*r));
+	r->n = n;
+	r->cc = gb->cc;
+	r->af = gb->cpu.regs.af;
+	r->bc = gb->cpu.regs.bc;
+	r->de = gb->cpu.regs.de;
+	r->hl = gb->cpu.regs.hl;
+	r->sp = gb->cpu.regs.sp;
+	r->pc = gb->cpu.regs.pc;
+	r->ime = gb->cpu.ime;
+	r->halt = gb->cpu.f_halt;
+
+	// DIV and TIMA in memory are only brought up to date when they are read
+	r->mem = hash (0xCBF29CE484222325ULL, gb->cpu.ram, sizeof (gb->cpu.ram), 0xFF04, 2);
+	r->mem = hash (r->mem, gb->cpu.wram, sizeof (gb->cpu.wram), 0, 0);
+	r->lcd = hash (0xCBF29CE484222325ULL, (const uint8_t *) gb_lcd (gb),
+		GB_LCD_WIDTH * GB_LCD_HEIGHT * sizeof (uint16_t), 0, 0);
+}
+
+/* run the ROM and write a record after each step. */
+static int trace (const char *path, FILE *out)
+{
+	uint8_t *rom = NULL, *ram = NULL;
+	size_t bytes, ram_size;
+
+	if (inputs_path && read_inputs (inputs_path) != 0) return 1;
+	if (read_file (path, (void **) &rom, &bytes) != 0) return 1;
+
+	gb_t *gb = gb_init (SAMPLE_RATE);
+	if (!gb || gb_load (gb, rom, &ram, &ram_size) != 0)
+	{
+		fprintf (stderr, "could not load %s\n", path);
+		return 1;
+	}
+
+	// samples are thrown away but retrieving them keeps the buffer from filling up
+	float *samples = malloc (SAMPLE_RATE * sizeof (float));
+	size_t n_samples;
+
+	for (uint64_t f = 0; f < start_frame; f ++)
+	{
+		step (gb, GB_FRAME);
+		gb_audio_samples (gb, samples, &n_samples);
+	}
+
+	// an instruction takes more than a cycle, so steps of one cycle that run nothing
+	// are not recorded
+	for (uint64_t n = 0; n < n_records; )
+	{
+		uint64_t cc = gb->cc;
+		step (gb, step_cc);
+		gb_audio_samples (gb, samples, &n_samples);
+		if (gb->cc == cc) continue;
+
+		record r;
+		fill_record (gb, n ++, &r);
+		if (fwrite (&r, sizeof (r), 1, out) != 1) break;
+	}
+
+	fclose (out);
+	gb_quit (gb);
+	free (samples);
+	free (ram);
+	free (rom);
+	return 0;
+}
+
+static void print_record (const char *name, const record *r)
+{
+	printf (
+		"%-6s %8" PRIu64 " %12" PRIu64 "  PC=%.4X AF=%.4X BC=%.4X DE=%.4X HL=%.4X SP=%.4X IME=%d HALT=%d"
+		"  mem=%.16" PRIx64 " lcd=%.16" PRIx64 "\n",
+		name, r->n, r->cc, r->pc, r->af, r->bc, r->de, r->hl, r->sp, r->ime, r->halt, r->mem, r->lcd
+	);
+}
+
+/* start the tracer of a build with the same options. */
+static FILE *start_trace (const char *bin, const char *rom)
+{
+	char cmd[4096];
+	snprintf (
+		cmd, sizeof (cmd), "'%s' -t -g %s -s %" PRIu64 " -n %" PRIu64 " %s%s%s '%s'",
+		bin, step_name, start_frame, n_records,
+		inputs_path ? "-i '" : "", inputs_path ? inputs_path : "", inputs_path ? "'" : "", rom
+	);
+
+	FILE *f = popen (cmd, "r");
+	if (!f) fprintf (stderr, "could not run %s\n", cmd);
+	return f;
+}
+
+/* run both builds and compare their records. returns non-zero if they differ. */
+static int compare (const char *ref_bin, const char *bin, const char *rom)
+{
+	FILE *ref = start_trace (ref_bin, rom);
+	FILE *other = start_trace (bin, rom);
+	if (!ref || !other) return 2;
+
+	record *history = calloc (context + 1, sizeof (record));
+	record a, b;
+	uint64_t n = 0;
+	int diverged = 0;
+
+	for (;; n ++)
+	{
+		size_t ra = fread (&a, sizeof (a), 1, ref);
+		size_t rb = fread (&b, sizeof (b), 1, other);
+		if (ra != rb)
+		{
+			printf ("%s stopped after %" PRIu64 " records\n", ra ? bin : ref_bin, n);
+			diverged = 1;
+			break;
+		}
+		if (ra == 0) break;
+
+		if (memcmp (&a, &b, sizeof (a)) != 0)
+		{
+			diverged = 2;
+			break;
+		}
+		history[n % (context + 1)] = a;
+	}
+
+	if (diverged == 2)
+	{
+		printf ("first divergence after %s %" PRIu64 ", at cycle %" PRIu64 " in frame %" PRIu64 "\n",
+			step_name, n, a.cc, a.cc / GB_FRAME);
+		printf ("(cycle and registers are after the step, mem and lcd are hashes)\n");
+		for (uint64_t i = n > (uint64_t) context ? n - context : 0; i < n; i ++)
+			print_record ("", &history[i % (context + 1)]);
+		print_record ("ref", &a);
+		print_record ("other", &b);
+
+		printf ("differs:");
+		if (a.cc != b.cc) printf (" cycle");
+		if (a.pc != b.pc || a.af != b.af || a.bc != b.bc || a.de != b.de || a.hl != b.hl ||
+			a.sp != b.sp || a.ime != b.ime || a.halt != b.halt)
+			printf (" registers");
+		if (a.mem != b.mem) printf (" memory");
+		if (a.lcd != b.lcd) printf (" screen");
+		printf ("\n");
+
+		// the last step that matched is where a finer comparison can start
+		uint64_t last = n > 0 ? history[(n - 1) % (context + 1)].cc : 0;
+		if (step_cc > 1)
+			printf ("narrow it down with -g instruction -s %" PRIu64 "\n", last / GB_FRAME);
+	}
+	else if (!diverged)
+		printf ("no divergence in %" PRIu64 " records\n", n);
+
+	free (history);
+	pclose (ref);
+	pclose (other);
+	return diverged != 0;
+}
+
+static void usage (const char *name)
+{
+	fprintf (stderr, "usage: %s [options] reference-build other-build rom\n", name);
+	fprintf (stderr, "       %s -t [options] rom\n", name);
+	fprintf (stderr, "\t-g step     compare after each instruction, scanline or frame (default frame)\n");
+	fprintf (stderr, "\t-n records  number of steps to compare (default 1000)\n");
+	fprintf (stderr, "\t-s frames   frames to run before comparing (default 0)\n");
+	fprintf (stderr, "\t-c records  records before the divergence to print (default %d)\n", DEFAULT_CONTEXT);
+	fprintf (stderr, "\t-i file     inputs as lines of `frame button press|release`\n");
+	fprintf (stderr, "\t-t          write the records of this build to stdout\n");
+}
+
+int main (int argc, char** argv)
+{
+	int tracer = 0;
+	int opt;
+
+	while ((opt = getopt (argc, argv, "g:n:s:c:i:th")) != -1)
+	{
+		switch (opt)
+		{
+			case 'g':
+				step_cc = 0;
+				for (size_t i = 0; i < sizeof (steps) / sizeof (steps[0]); i ++)
+				{
+					if (strcmp (optarg, steps[i].name) != 0) continue;
+					step_cc = steps[i].cc;
+					step_name = steps[i].name;
+				}
+				break;
+			case 'n': n_records = strtoull (optarg, NULL, 10); break;
+			case 's': start_frame = strtoull (optarg, NULL, 10); break;
+			case 'c': context = atoi (optarg); break;
+			case 'i': inputs_path = optarg; break;
+			case 't': tracer = 1; break;
+			default:
+				usage (argv[0]);
+				exit (opt == 'h' ? 0 : 1);
+		}
+	}
+
+	if (step_cc == 0 || context < 0 || optind + (tracer ? 1 : 3) != argc)
+	{
+		usage (argv[0]);
+		exit (1);
+	}
+
+	if (tracer)
+	{
+		// the header and messages of the emulator would end up between the records
+		int out = dup (STDOUT_FILENO);
+		dup2 (STDERR_FILENO, STDOUT_FILENO);
+		FILE *records = fdopen (out, "wb");
+		if (!records) exit (1);
+
+		return trace (argv[optind], records);
+	}
+
+	return compare (argv[optind], argv[optind + 1], argv[optind + 2]);
+}
@@ -0,0 +1,261 @@
+/** -----------------------------------------------------------------------------------------------
+ *  File: main.c
+ *  Description: Headless runner that measures the throughput of the emulator. Runs a list of
+ *               ROMs for a number of frames without video or audio output.
+ *  ----------------------------------------------------------------------------------------------- */
+#include "gb.h"
+#ifdef CPU_AOT
+#include "gb/aot.h"
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <inttypes.h>
+
+#define SAMPLE_RATE 44100
+#define DEFAULT_FRAMES 3600
+
+/* result of running one ROM. */
+typedef
+struct job
+{
+	const char *path;
+	int failed;
+	uint64_t frames;
+	uint64_t cc;
+	double seconds;
+}
+job;
+
+static job *jobs;
+static int n_jobs;
+static int frames = DEFAULT_FRAMES;
+static gb_accuracy accuracy = GB_ACCURACY_FAST;
+#ifdef CPU_AOT
+static int aot = 0;
+#endif
+
+/* next job to pick up by a worker. */
+static int next_job;
+static pthread_mutex_t next_job_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static double now ()
+{
+	struct timespec t;
+	clock_gettime (CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/**
+ * helper function to read file contents to `data`.
+ */
+static int read_file (const char *fp, void **data, size_t *bytes)
+{
+	FILE* f = fopen (fp, "rb");
+	if (!f)
+	{
+		fprintf (stderr, "could not open file @ %s\n", fp);
+		return 1;
+	}
+	fseek (f, 0, SEEK_END);
+	*bytes = ftell (f);
+	rewind (f);
+	*data = calloc (*bytes, 1);
+
+	size_t ret = fread (*data, 1, *bytes, f);
+	fclose (f);
+	if (ret != *bytes)
+	{
+		fprintf (stderr, "could not read the entire file! got %ld of %ld bytes\n", ret, *bytes);
+		return 1;
+	}
+
+	return 0;
+}
+
+/* run the ROM of the job for the requested number of frames. */
+static void run (job *j)
+{
+	uint8_t *rom = NULL, *ram = NULL;
+	float *samples = malloc (SAMPLE_RATE * sizeof (float));
+	size_t bytes, ram_size, n;
+	gb_t *gb = NULL;
+
+	j->failed = 1;
+
+	if (read_file (j->path, (void **) &rom, &bytes) != 0)
+		goto end;
+
+	if (!(gb = gb_init (SAMPLE_RATE)))
+	{
+		fprintf (stderr, "could not create emulator instance\n");
+		goto end;
+	}
+	gb_set_accuracy (gb, accuracy);
+
+	if (gb_load (gb, rom, &ram, &ram_size) != 0)
+	{
+		fprintf (stderr, "could not load %s\n", j->path);
+		goto end;
+	}
+
+#ifdef CPU_AOT
+	// blocks compiled with gb-aotc to <rom>.so
+	if (aot)
+	{
+		char path[1024];
+		snprintf (path, sizeof (path), "%s.so", j->path);
+		if (gb_aot_load (gb, path) != 0)
+			goto end;
+	}
+#endif
+
+	double start = now ();
+	for (int i = 0; i < frames; i ++)
+	{
+		j->cc += gb_step (gb, GB_FRAME);
+		// the samples are thrown away but retrieving them is part of the work
+		gb_audio_samples (gb, samples, &n);
+	}
+	j->seconds = now () - start;
+	j->frames = frames;
+	j->failed = 0;
+
+end:
+	if (gb) gb_quit (gb);
+	free (samples);
+	free (ram);
+	free (rom);
+}
+
+static void *worker (void *arg)
+{
+	for (;;)
+	{
+		pthread_mutex_lock (&next_job_lock);
+		int i = next_job ++;
+		pthread_mutex_unlock (&next_job_lock);
+
+		if (i >= n_jobs) break;
+		run (&jobs[i]);
+	}
+	return NULL;
+}
+
+/* -a is only there when the blocks compiled ahead of time can be loaded. */
+#ifdef CPU_AOT
+#define AOT_USAGE " [-a]"
+#else
+#define AOT_USAGE ""
+#endif
+
+static void usage (const char *name)
+{
+	fprintf (stderr, "usage: %s [-f frames] [-j threads] [-m]" AOT_USAGE " rom...\n", name);
+	fprintf (stderr, "\t-f frames   number of frames to run each ROM (default %d)\n", DEFAULT_FRAMES);
+	fprintf (stderr, "\t-j threads  number of ROMs to run at the same time (default 1)\n");
+	fprintf (stderr, "\t-m          time memory accesses by M-cycle, see gb_set_accuracy\n");
+#ifdef CPU_AOT
+	fprintf (stderr, "\t-a          run the blocks compiled ahead of time to <rom>.so\n");
+#endif
+}
+
+int main (int argc, char** argv)
+{
+	int n_threads = 1;
+	int opt;
+
+	while ((opt = getopt (argc, argv, "f:j:mah")) != -1)
+	{
+		switch (opt)
+		{
+			case 'f': frames = atoi (optarg); break;
+			case 'j': n_threads = atoi (optarg); break;
+			case 'm': accuracy = GB_ACCURACY_MCYCLE; break;
+#ifdef CPU_AOT
+			case 'a': aot = 1; break;
+#endif
+			default:
+				usage (argv[0]);
+				exit (opt == 'h' ? 0 : 1);
+		}
+	}
+
+	if (optind >= argc || frames <= 0 || n_threads <= 0)
+	{
+		usage (argv[0]);
+		exit (1);
+	}
+
+	n_jobs = argc - optind;
+	jobs = calloc (n_jobs, sizeof (job));
+	for (int i = 0; i < n_jobs; i ++)
+		jobs[i].path = argv[optind + i];
+
+	if (n_threads > n_jobs) n_threads = n_jobs;
+
+	//
+	// Run
+	//
+
+	pthread_t *threads = calloc (n_threads, sizeof (pthread_t));
+
+	double start = now ();
+	for (int i = 0; i < n_threads; i ++)
+		pthread_create (&threads[i], NULL, worker, NULL);
+	for (int i = 0; i < n_threads; i ++)
+		pthread_join (threads[i], NULL);
+	double seconds = now () - start;
+
+	//
+	// Report
+	//
+
+	uint64_t total_frames = 0, total_cc = 0;
+	int failed = 0;
+
+	printf ("\n%-32s %10s %10s %12s %14s %8s\n", "ROM", "frames", "seconds", "frames/s", "cycles/s", "speed");
+	for (int i = 0; i < n_jobs; i ++)
+	{
+		job *j = &jobs[i];
+		if (j->failed)
+		{
+			printf ("%-32s %10s\n", j->path, "FAILED");
+			failed ++;
+			continue;
+		}
+
+		printf (
+			"%-32s %10" PRIu64 " %10.3f %12.1f %14.0f %7.1fx\n",
+			j->path,
+			j->frames,
+			j->seconds,
+			j->frames / j->seconds,
+			j->cc / j->seconds,
+			j->cc / j->seconds / GB_CPU_CLOCK
+		);
+
+		total_frames += j->frames;
+		total_cc += j->cc;
+	}
+
+	// aggregate throughput over the wall time of all workers
+	printf (
+		"%-32s %10" PRIu64 " %10.3f %12.1f %14.0f %7.1fx\n",
+		"total",
+		total_frames,
+		seconds,
+		total_frames / seconds,
+		total_cc / seconds,
+		total_cc / seconds / GB_CPU_CLOCK
+	);
+	printf ("%d threads\n", n_threads);
+
+	free (threads);
+	free (jobs);
+
+	return failed ? 1 : 0;
+}
@@ -1,7 +1,6 @@
 #ifndef GB_H
 #define GB_H
 
-#include "gb/io.h"
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -9,21 +8,54 @@
 #define GB_LCD_HEIGHT 144
 
 #define GB_CPU_CLOCK 4194304
+
 #define GB_SCANLINE 456
 #define GB_SCANLINES 154
 #define GB_FRAME 70224
 
 /**
- * Initialize the emulator.
+ * Handle to an emulator instance.
+ *
+ * All state of an emulated Game Boy lives behind this handle so several instances
+ * can run side by side within the same process. Instances share nothing, which means
+ * that different instances can be stepped from different threads, but one instance
+ * must not be used from more than one thread at a time.
+ */
+typedef struct gb gb_t;
+
+/**
+ * Joypad keys.
+ */
+typedef enum gb_io_button
+{
+	gb_io_b_right = 0,
+	gb_io_b_left = 1,
+	gb_io_b_up = 2,
+	gb_io_b_down = 3,
+	gb_io_b_a = 4,
+	gb_io_b_b = 5,
+	gb_io_b_select = 6,
+	gb_io_b_start = 7,
+}
+gb_io_button;
+
+typedef gb_io_button gb_button;
+
+/**
+ * Create a new emulator instance.
+ *
+ * The argument is the audio sample rate that the instance should generate samples at.
  *
- * Right now this is just for setting the audio sample rate before starting.
+ * Returns NULL in case the instance could not be allocated. The instance should be
+ * released with `gb_quit`.
  */
-void gb_init (int /* sample rate */) ;
+gb_t *gb_init (int /* sample rate */) ;
 
 /**
  * Load ROM data.
  *
- * First argument poinst to ROM data read from a cartridge.
+ * First argument poinst to ROM data read from a cartridge. The data is not copied so it
+ * needs to stay valid while the game runs.
  *
  * Second argument points to RAM. This can be a pointer to loaded battery backed RAM
  * data. If a NULL pointer is supplied then the emulator will allocate the RAM, and if
@@ -32,7 +64,7 @@ void gb_init (int /* sample rate */) ;
  *
  * A non-zero return value is returned in case the ROM data is corrupt or invalid.
  */
-int gb_load (const uint8_t * /* rom */, uint8_t ** /* ram */, size_t * /* ram_size */) ;
+int gb_load (gb_t *, const uint8_t * /* rom */, uint8_t ** /* ram */, size_t * /* ram_size */) ;
 
 /**
  * Step the emulator for *at least* a given number of CPU cycles. The function returns
@@ -42,12 +74,12 @@ int gb_load (const uint8_t * /* rom */, uint8_t ** /* ram */, size_t * /* ram_si
  * instruction is different, therefore the input act as a minimum of cycles to
  * iterate.
  */
-uint32_t gb_step (uint32_t /* cc */) ;
+uint32_t gb_step (gb_t *, uint32_t /* cc */) ;
 
 /**
- * Deinitiliaze the Game Boy emulator.
+ * Deinitiliaze the Game Boy emulator and free the instance.
  */
-void gb_quit () ;
+void gb_quit (gb_t *) ;
 
 /**
  * Get pointer to the screen buffer.
@@ -59,32 +91,76 @@ void gb_quit () ;
  * This can change between frames so it is recommended to make a call each time
  * AFTER stepping the emulator and drawing while it is paused before stepping again.
  */
-const uint16_t *gb_lcd () ;
-
-// TODO
-// I don't like this solution for the buttons.
-// I think maybe it would be better to move the definition of the enum of buttons here.
-
-typedef gb_io_button gb_button;
+const uint16_t *gb_lcd (gb_t *) ;
 
 /**
  * Emulate pressing (and holding down) a key.
  */
-void gb_press_button (gb_button) ;
+void gb_press_button (gb_t *, gb_button) ;
 
 /**
  * Emulate releasing a key.
  */
-void gb_release_button (gb_button) ;
+void gb_release_button (gb_t *, gb_button) ;
 
 /**
  * Get audio samples generated.
  */
-void gb_audio_samples (float * /* buffer */, size_t * /* n */) ;
+void gb_audio_samples (gb_t *, float * /* buffer */, size_t * /* n */) ;
 
 /**
  * Add callback to call after `gb_step`.
+ *
+ * The callback gets the number of CPU cycles that ran during the step.
+ */
+void gb_add_step_callback (gb_t *, void (* fn) (gb_t *, uint32_t)) ;
+
+/**
+ * Size in bytes of a save state of the running game.
+ */
+size_t gb_state_size (gb_t *) ;
+
+/**
+ * Save the state of the emulator to the buffer, which needs to hold at least
+ * `gb_state_size` bytes. Nothing is allocated.
+ *
+ * The state should be saved in between calls to `gb_step`. Audio samples that have not
+ * been retrieved are not part of it.
+ *
+ * A non-zero value is returned in case the buffer is too small.
+ */
+int gb_state_save (gb_t *, uint8_t * /* buffer */, size_t /* size */) ;
+
+/**
+ * Load a state saved with `gb_state_save`.
+ *
+ * The same game needs to have been loaded with `gb_load` first. States are saved in
+ * the byte order of the host.
+ *
+ * A non-zero value is returned in case the state is from another game or version of
+ * the emulator, in which case nothing has been loaded.
+ */
+int gb_state_load (gb_t *, const uint8_t * /* buffer */, size_t /* size */) ;
+
+/**
+ * Timing accuracy.
+ *
+ * The fast tier counts the cycles of an operation once it has run, so the registers of
+ * the PPU and timers are read and written as they were when it started. The M-cycle
+ * tier has them catch up to the M-cycle of the access within the operation, and takes
+ * 20 cycles to dispatch an interrupt. It runs somewhat slower and without the JIT.
+ */
+typedef
+enum gb_accuracy
+{
+	GB_ACCURACY_FAST = 0,
+	GB_ACCURACY_MCYCLE = 1,
+}
+gb_accuracy;
+
+/**
+ * Set the timing accuracy of the instance, it applies from the next `gb_load`.
  */
-void gb_add_step_callback (void (* fn) (uint32_t)) ;
+void gb_set_accuracy (gb_t *, gb_accuracy) ;
 
 #endif /* GB_H */
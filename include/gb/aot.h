@@ -0,0 +1,64 @@
+#ifndef GB_AOT_H
+#define GB_AOT_H
+
+#include "gb.h"
+#include "gb/cpu.h"
+#include <stdio.h>
+#include <stdint.h>
+
+/**
+ * Blocks compiled ahead of time from the ROM, built with `make AOT=1`.
+ *
+ * `gb-aotc` (see examples/aotc) walks the code of a ROM that is reachable from the entry
+ * point and the interrupt vectors, bank by bank, and writes each block the CPU decodes
+ * there as a C function. Compiled to a shared object and loaded with `gb_aot_load` after
+ * the ROM, the blocks decoded from ROM run their function instead of the interpreter.
+ * Code in RAM, which can change, and code the walk did not find are interpreted.
+ *
+ * The functions are called the same way as translated blocks, see jit.h, and return to
+ * the interpreter the same way, also when an operation switches the bank they run from. Operations on
+ * registers are written out in C, the others call the function of the operation that
+ * is generated together with the CPU loop, from the table of the instance that runs
+ * them. Nothing in the shared object is written, instances load it at once.
+ */
+
+/* Version of the generated code, shared objects of another version are not loaded. */
+#define GB_AOT_VERSION 2
+
+/* Cartridge header from the title up to and including the global checksum. */
+#define GB_AOT_HEADER_LOC 0x0134
+#define GB_AOT_HEADER_SIZE 0x1C
+
+/* Compiled block at an offset in the ROM. */
+typedef
+struct aot_block
+{
+	uint32_t rom;
+	gb_cpu_code code;
+}
+gb_aot_block;
+
+/**
+ * Write the blocks of the ROM of `size` bytes as C to `f`.
+ * Returns the number of blocks written.
+ */
+int gb_aot_compile (const uint8_t * /* rom */, size_t /* size */, FILE * /* f */) ;
+
+/**
+ * Load the blocks compiled from the ROM that has been loaded.
+ * Returns non-zero in case the shared object could not be loaded or was compiled from
+ * another ROM.
+ */
+int gb_aot_load (gb_t *, const char * /* path */) ;
+
+/**
+ * Compiled block starting at the host memory, NULL if there is none.
+ */
+gb_cpu_code gb_aot_code (gb_t *, const uint8_t * /* mem */) ;
+
+/**
+ * Unload the blocks.
+ */
+void gb_aot_quit (gb_t *) ;
+
+#endif
@@ -1,21 +1,110 @@
 #ifndef GB_APU
 #define GB_APU
 
+#include "gb.h"
+#include <stdint.h>
 #include <stdlib.h>
 
+#define GB_APU_SAMPLE_BUFFER_SIZE 8192
+
+/**
+ * Channel envelope handling volume.
+ * Keeps a pointer to the register with the information for the specific envelope.
+ */
+typedef
+struct envelope
+{
+	// counter
+	uint8_t cc;
+
+	// register
+	uint8_t *R;
+
+	// enabled flag
+	uint8_t enabled;
+
+	// volume
+	uint8_t vol;
+}
+envelope;
+
+/**
+ * APU state.
+ *
+ * The sound registers live in CPU RAM, these are pointers to them.
+ */
+typedef
+struct apu
+{
+	/* Registers */
+	uint8_t *nr10, *nr11, *nr12, *nr13, *nr14;
+	uint8_t *nr21, *nr22, *nr23, *nr24;
+	uint8_t *nr30, *nr31, *nr32, *nr33, *nr34;
+	uint8_t *wav_pat;
+	uint8_t *nr41, *nr42, *nr43, *nr44;
+	uint8_t *nr50, *nr51, *nr52;
+
+	/* Flag enabled channels. */
+	uint8_t enabled_ch;
+
+	/* Channel 1: Tone + Sweep */
+	int ch1_cc;
+	uint8_t ch1_duty_cc;
+	uint8_t ch1_len;
+	uint16_t ch1_shadow;
+	uint8_t ch1_sweep_cc;
+	envelope ch1_env;
+
+	/* Channel 2: Tone */
+	int ch2_cc;
+	uint8_t ch2_duty_cc;
+	uint8_t ch2_len;
+	envelope ch2_env;
+
+	/* Channel 3: Wave */
+	int wav_cc;
+	uint8_t wav_duty;
+	uint16_t wav_len;
+
+	/* Channel 4: Noise */
+	int noi_cc;
+	uint16_t lfsr;
+	uint16_t noi_len;
+	envelope noi_env;
+
+	/* Frame sequencer and its timer. */
+	uint8_t fs;
+	int fs_cc;
+
+	/* CPU cycle up to which the APU has been stepped. */
+	uint64_t cc;
+
+	/* Sampling */
+	int sample_rate;
+	float samples[GB_APU_SAMPLE_BUFFER_SIZE + 2];
+	int samples_len;
+	int apucc;
+}
+gb_apu;
+
 /**
  * Reset the APU.
  */
-void gb_apu_reset () ;
+void gb_apu_reset (gb_t *, int /* sample rate */) ;
 
 /**
  * Step the APU according to the number CPU cycles provided.
  */
-void gb_apu_step (uint32_t /* cc */) ;
+void gb_apu_step (gb_t *, uint32_t /* cc */) ;
+
+/**
+ * Step the APU up to the current CPU cycle.
+ */
+void gb_apu_sync (gb_t *) ;
 
 /**
  * Copy sampled samples to the buffer and set the size parameter to the length of the buffer.
  */
-void gb_apu_samples (float* /* buffer */, size_t* /* samples */) ;
+void gb_apu_samples (gb_t *, float* /* buffer */, size_t* /* samples */) ;
 
 #endif
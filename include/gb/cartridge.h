@@ -1,6 +1,7 @@
 #ifndef GB_FILE
 #define GB_FILE
 
+#include "gb.h"
 #include <stdint.h>
 #include <stdio.h>
 
@@ -54,6 +55,6 @@ void gb_print_header_info (gb_cartridge_header /* hdr */) ;
  *
  * `RAM` points to the allocated RAM memory that the MBC can write to/switch banks/etc.
  */
-int gb_load_mbc (gb_cartridge_header /* h */, uint8_t * /* RAM */) ;
+int gb_load_mbc (gb_t *, gb_cartridge_header /* h */, uint8_t * /* RAM */) ;
 
 #endif /* _GB_FILE_ */
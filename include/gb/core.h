@@ -0,0 +1,44 @@
+#ifndef GB_CORE_H
+#define GB_CORE_H
+
+#include "gb.h"
+#include "gb/cpu.h"
+#include "gb/ppu.h"
+#include "gb/apu.h"
+#include "gb/io.h"
+#include "gb/mbc.h"
+#include "gb/sched.h"
+
+#define GB_MAX_STEP_CALLBACKS 5
+
+/**
+ * An emulator instance.
+ *
+ * Each unit keeps its state in its own member so the units only need the handle to
+ * find it.
+ */
+struct gb
+{
+	gb_cpu cpu;
+	gb_ppu ppu;
+	gb_apu apu;
+	gb_io io;
+	gb_mbc mbc;
+	gb_sched sched;
+
+	int sample_rate;
+
+	/* Timing accuracy to load the next game with. */
+	gb_accuracy accuracy;
+
+	/* Number of CPU cycles that have run since the game was loaded. */
+	uint64_t cc;
+
+	/* Cycle at which the last requested step ends. */
+	uint64_t step_end;
+
+	int n_step_cbs;
+	void (*step_cbs[GB_MAX_STEP_CALLBACKS]) (gb_t *, uint32_t);
+};
+
+#endif /* GB_CORE_H */
@@ -1,79 +1,353 @@
 #ifndef GB_CPU_H
 #define GB_CPU_H
 
+#include "gb.h"
 #include <stdint.h>
 
 #define ROM_BANK_SIZE 0x4000
 #define RAM_BANK_SIZE 0x2000
+
 #define OAM_LOC 0xFE00
 
 #define GB_DIV_CLOCK 16384
 #define GB_DIV_CC 256 // CPU CLOCK / DIV CLOCK
 
+/**
+ * Read from RAM handler.
+ *
+ * This is a function that takes the address as first parameter and the current value in memory
+ * at that address.
+ *
+ * In case the handler affects the RAM address and normal execution should be stopped an non-zero
+ * value should be returned by the handler, else zero.
+ */
+typedef int (*read_handler) (gb_t *, uint16_t, uint8_t*) ;
+
+/**
+ * Store to RAM handler.
+ *
+ * This is a function that takes the address as first parameter and the value that is to be
+ * stored as second.
+ *
+ * In case the handler affects the RAM address and normal execution should be stopped an non-zero
+ * value should be returned by the handler, else zero.
+ */
+typedef int (*store_handler) (gb_t *, uint16_t, uint8_t);
+
+#define MAX_HANDLERS 32
+
+/* Memory is mapped in pages of 256 bytes. */
+#define GB_CPU_PAGE_SIZE 0x100
+#define GB_CPU_PAGES 0x100
+
+/* IO registers at $FF00 - $FF7F. */
+#define GB_CPU_IO_LOC 0xFF00
+#define GB_CPU_IO_REGISTERS 0x80
+
+/**
+ * Handlers are dispatched from a slot for each page below the IO registers and one for
+ * each IO register, see `gb_cpu_handlers`.
+ */
+#define GB_CPU_HANDLER_SLOTS (GB_CPU_IO_LOC / GB_CPU_PAGE_SIZE + GB_CPU_IO_REGISTERS)
+
+/* End of the handlers of a slot. */
+#define GB_CPU_NO_HANDLER 0xFF
+
+/* Which accesses to map with `gb_cpu_map`. */
+#define GB_CPU_MAP_READ 0x01
+#define GB_CPU_MAP_STORE 0x02
+
+/* Decoded blocks hold at most this many operations and never cross a page. */
+#define GB_CPU_BLOCK_OPS 16
+/* Number of decoded blocks that are cached, a power of two. */
+#define GB_CPU_BLOCKS 1024
+/* Maximum number of pages of RAM with cached blocks. */
+#define GB_CPU_CODE_PAGES 16
+/* Pages whose blocks have been invalidated this many times are not cached anymore. */
+#define GB_CPU_CODE_WRITES 16
+
+/**
+ * CPU registers.
+ */
+typedef
+struct cpu_regs
+{
+	uint16_t af;
+	uint16_t bc;
+	uint16_t de;
+	uint16_t hl;
+	uint16_t sp;
+	uint16_t pc;
+
+	/**
+	 * The flags are computed lazily: the last operation that sets them is kept with its
+	 * operands (or result) and carry, and F is only brought up to date once it is read.
+	 */
+	uint8_t flags_op;
+	uint8_t flags_a;
+	uint8_t flags_b;
+	uint8_t flags_c;
+}
+gb_cpu_regs;
+
+/**
+ * A decoded operation: opcode, with CB prefixed ones at 0x100 + opcode, the immediate
+ * operand, the number of bytes and the cycle of its first memory access.
+ *
+ * The first operation of a sequence that is run as one has the opcode 0x200 + index of
+ * the sequence in `gb_cpu_fusions`, the operations after it keep their own.
+ */
+typedef
+struct cpu_insn
+{
+	uint16_t op;
+	uint16_t imm;
+	uint8_t len;
+	uint8_t at;
+}
+gb_cpu_insn;
+
+/* Fused sequences: the number of operations followed by their opcodes. */
+extern const uint16_t gb_cpu_fusions[][4];
+
+/**
+ * Native code of a translated block. Runs the operations of the block from the start
+ * until the cycle given or until the interpreter needs to take over, and returns the
+ * number of operations it ran.
+ */
+typedef int (*gb_cpu_code) (gb_t *, gb_cpu_regs *, uint64_t) ;
+
+/* Operation called by translated code, returns the number of cycles it took. */
+typedef int (*gb_jit_op) (gb_t *, gb_cpu_regs *, uint16_t /* immediate */) ;
+
+/**
+ * A block of decoded operations that run one after the other, ending at an operation
+ * that can jump.
+ *
+ * Blocks are keyed by the host memory of the first operation, so blocks of different
+ * ROM or WRAM banks at the same address are kept apart.
+ */
+typedef
+struct cpu_block
+{
+	const uint8_t *mem;
+	/* number of operations. */
+	uint8_t n;
+	/* sum of the base cycles of the operations. */
+	uint16_t cc;
+	/**
+	 * the block ends with a jump and changes nothing but registers. when it jumps back
+	 * to its start with the registers as they were it polls memory that can only
+	 * change with an event.
+	 */
+	uint8_t idle;
+	gb_cpu_insn ops[GB_CPU_BLOCK_OPS];
+
+	/* number of times the block has been entered and its translation, see jit.h. */
+	uint16_t hits;
+	gb_cpu_code code;
+}
+gb_cpu_block;
+
+/**
+ * Address ranges and priorities of the registered read or store handlers.
+ * Each slot lists the handlers whose range covers part of it, by priority, so an access
+ * only asks the handlers that can claim it. A slot with a single handler that covers all
+ * of it, like most IO registers, has it as direct entry which is called as is.
+ */
+typedef
+struct gb_cpu_handlers
+{
+	uint16_t lo[MAX_HANDLERS], hi[MAX_HANDLERS];
+	int priority[MAX_HANDLERS];
+	int n;
+
+	uint8_t slots[GB_CPU_HANDLER_SLOTS][MAX_HANDLERS + 1];
+	uint8_t direct[GB_CPU_HANDLER_SLOTS];
+}
+gb_cpu_handlers;
+
+/**
+ * CPU state: registers, memory and the registered memory handlers.
+ */
+typedef
+struct cpu
+{
+	/* registers, only up to date when the CPU is not running. */
+	gb_cpu_regs regs;
+
+	/* HALT flag. */
+	uint8_t f_halt;
+
+	/* Interrupt Master Enable flag (IME). */
+	uint8_t ime;
+
+	/* keep track of DIV and TIMA cycles. */
+	int divcc;
+	int timacc;
+
+	/* CPU cycle up to which the timers have been incremented. */
+	uint64_t timer_cc;
+
+	/* the timers have been read since the start of the last idle loop iteration. */
+	uint8_t timer_read;
+
+	/* page of the block being run, -1 outside of `gb_cpu_run`. */
+	int run_page;
+
+	/**
+	 * run memory accesses at the M-cycle they happen in, see `gb_set_accuracy`, and the
+	 * cycle of the next access of the running operation, 0 outside of one.
+	 */
+	uint8_t accurate;
+	uint64_t access_cc;
+
+	/* RAM memory. */
+	uint8_t ram[1 << 16];
+
+	/* CGB WRAM banks 1-7 and the one currently mapped at $D000. */
+	uint8_t wram[0x7000];
+	uint8_t *wram_bank;
+
+	/* ROM data. */
+	const uint8_t *rom;
+
+	/**
+	 * n_rom_banks keeps track of the total number of banks in the cartridge.
+	 * This is needed because some games seem to write a higher value than allowed.
+	 */
+	int n_rom_banks;
+
+	/**
+	 * Memory map with a host pointer for each page. Reads and stores to pages that are
+	 * not mapped (NULL) go through the registered handlers instead.
+	 */
+	uint8_t *read_map[GB_CPU_PAGES];
+	uint8_t *store_map[GB_CPU_PAGES];
+
+	/* Cached decoded blocks and the block for operations that can not be cached. */
+	gb_cpu_block blocks[GB_CPU_BLOCKS];
+	gb_cpu_block uncached;
+
+	/**
+	 * Pages of RAM that blocks were decoded from are taken out of the store map, so a
+	 * store to them goes through the slow path which invalidates the blocks and maps
+	 * the pages again. This holds the mapping they had.
+	 */
+	uint8_t *code_store[GB_CPU_PAGES];
+	/* Host memory of the pages above. */
+	uint8_t *code_pages[GB_CPU_CODE_PAGES];
+	int n_code_pages;
+	/* Number of times the blocks of each page have been invalidated. */
+	uint8_t code_writes[GB_CPU_PAGES];
+
+	/* Executable memory for translated blocks and how much of it is used. */
+	uint8_t *jit;
+	size_t jit_used;
+
+	/**
+	 * Shared object with the blocks compiled ahead of time, see aot.h, and the functions
+	 * of the operations they call.
+	 */
+	void *aot;
+	const struct aot_block *aot_blocks;
+	int n_aot_blocks;
+	const gb_jit_op *aot_ops;
+
+	read_handler read_handlers[MAX_HANDLERS];
+	gb_cpu_handlers reads;
+
+	store_handler store_handlers[MAX_HANDLERS];
+	gb_cpu_handlers stores;
+}
+gb_cpu;
+
 /**
  * Step the CPU one operation.
+ * Returns the number of cycles it took, which have been added to the cycle count.
+ */
+int gb_cpu_step (gb_t *) ;
+
+/**
+ * Run the CPU until `budget` cycles have been used or the next scheduled event is due.
+ * At least one operation is run, the registers are kept local to the loop meanwhile.
+ * Returns the number of cycles that ran, which have been added to the cycle count.
  */
-int gb_cpu_step () ;
+uint32_t gb_cpu_run (gb_t *, uint32_t /* budget */) ;
 
 /**
  * Reset the CPU.
  *
  * Pass 0 or 1 for DMG compability mode.
  */
-void gb_cpu_reset (uint8_t) ;
+void gb_cpu_reset (gb_t *, uint8_t) ;
 
 /**
  * Get a pointer to a location within the RAM.
  * USE WITH CAUTION!
  */
-uint8_t* gb_cpu_mem (uint16_t /* offset */) ;
+uint8_t* gb_cpu_mem (gb_t *, uint16_t /* offset */) ;
 
 /**
  * Load data total ROM data and give the number of banks.
+ *
+ * The data is not copied, ROM banks are read straight from it so it needs to stay
+ * valid while the game runs.
  */
-void gb_cpu_load_rom (int /* banks */, const uint8_t* /* data */) ;
+void gb_cpu_load_rom (gb_t *, int /* banks */, const uint8_t* /* data */) ;
 
 /**
  * Switch ROM bank one with the given bank number (of total in ROM).
+ *
+ * This only points the memory map at the bank within the ROM data.
  */
-void gb_cpu_switch_rom_bank (int /* bank */);
+void gb_cpu_switch_rom_bank (gb_t *, int /* bank */);
 
 /**
  * Load data into RAM bank.
  */
-void gb_cpu_load_ram (uint8_t* /* data */) ;
+void gb_cpu_load_ram (gb_t *, uint8_t* /* data */) ;
 
 /**
- * Read from RAM handler.
+ * Add a callback (read_handler) for when trying to read from memory at [lo, hi].
  *
- * This is a function that takes the address as first parameter and the current value in memory
- * at that address.
+ * Handlers with a higher priority are called first, the ones with the same priority in
+ * the order they were added, until one returns non-zero. Addresses from $FF80 (HRAM and
+ * IE) and pages mapped with `gb_cpu_map` never go through the handlers.
  *
- * In case the handler affects the RAM address and normal execution should be stopped an non-zero
- * value should be returned by the handler, else zero.
+ * Returns non-zero in case the range is not valid or MAX_HANDLERS have been added.
  */
-typedef int (*read_handler) (uint16_t, uint8_t*) ;
+int gb_cpu_register_read_handler (gb_t *, uint16_t /* lo */, uint16_t /* hi */, int /* priority */, read_handler /* handler */) ;
 
 /**
- * Add a callback (read_handler) for when trying to read from memory.
+ * Add a callback when storing to RAM at [lo, hi], see above.
+ * The value is stored to RAM after the handlers unless one of them returns non-zero.
  */
-void gb_cpu_register_read_handler (read_handler /* handler */) ;
+int gb_cpu_register_store_handler (gb_t *, uint16_t /* lo */, uint16_t /* hi */, int /* priority */, store_handler /* handler */) ;
 
 /**
- * Store to RAM handler.
+ * Map the memory at [address, address + size) directly to host memory for the accesses
+ * given by the GB_CPU_MAP_* flags. Mapping NULL sends the accesses through the
+ * handlers instead. Changing what is mapped for reads ends the running CPU after the
+ * operation, as the block it runs might have been decoded from the memory mapped before.
  *
- * This is a function that takes the address as first parameter and the value that is to be
- * stored as second.
+ * Address and size need to be multiples of GB_CPU_PAGE_SIZE.
+ */
+void gb_cpu_map (gb_t *, uint16_t /* address */, uint32_t /* size */, uint8_t * /* memory */, int /* flags */) ;
+
+/**
+ * Drop all decoded blocks.
  *
- * In case the handler affects the RAM address and normal execution should be stopped an non-zero
- * value should be returned by the handler, else zero.
+ * Needs to be done when memory that code might run from is changed without going
+ * through the CPU, e.g. with `gb_cpu_mem`.
  */
-typedef int (*store_handler) (uint16_t, uint8_t);
+void gb_cpu_flush (gb_t *) ;
 
 /**
- * Add a callback when storing to RAM.
+ * Decode the operation in the host memory the same way the CPU does.
+ * Returns non-zero in case it ends a block.
  */
-void gb_cpu_register_store_handler (store_handler /* handler */) ;
+int gb_cpu_decode (const uint8_t * /* mem */, gb_cpu_insn *) ;
 
 /**
  * Bit 0: V-Blank  Interrupt Enable  (INT 40h)  (1=Enable)
@@ -93,6 +367,6 @@ enum interrupt_flag
 }
 interrupt_flag;
 
-void gb_cpu_flag_interrupt (interrupt_flag /* flag */) ;
+void gb_cpu_flag_interrupt (gb_t *, interrupt_flag /* flag */) ;
 
 #endif
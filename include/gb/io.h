@@ -1,29 +1,29 @@
 #ifndef GB_IO_H
 #define GB_IO_H
 
-#define GB_IO_P1_LOC 0xFF00
+#include "gb.h"
+#include <stdint.h>
 
-/* reset the IO controller. */
-void gb_io_reset () ;
+#define GB_IO_P1_LOC 0xFF00
 
-/* joypad keys. */
-typedef enum gb_io_button
+/* joypad state. */
+typedef
+struct io
 {
-	gb_io_b_right = 0,
-	gb_io_b_left = 1,
-	gb_io_b_up = 2,
-	gb_io_b_down = 3,
-	gb_io_b_a = 4,
-	gb_io_b_b = 5,
-	gb_io_b_select = 6,
-	gb_io_b_start = 7,
+	uint8_t *p1;
+
+	/* State for each key set as : DOWN | UP | LEFT | RIGHT | START | SELECT | B | A */
+	uint8_t key_states;
 }
-gb_io_button;
+gb_io;
+
+/* reset the IO controller. */
+void gb_io_reset (gb_t *) ;
 
 /* emulate pressing the given button. */
-void gb_io_press_button (gb_io_button /* button */);
+void gb_io_press_button (gb_t *, gb_io_button /* button */);
 
 /* emulate releasing the given button. */
-void gb_io_release_button (gb_io_button /* button */);
+void gb_io_release_button (gb_t *, gb_io_button /* button */);
 
 #endif /* GB_IO_H */
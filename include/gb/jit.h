@@ -0,0 +1,46 @@
+#ifndef GB_JIT_H
+#define GB_JIT_H
+
+#include "gb.h"
+#include "gb/cpu.h"
+#include <stdint.h>
+
+/**
+ * Translation of decoded blocks to x86-64 code, built with `make JIT=1`.
+ *
+ * Simple operations on registers are emitted as native code, the rest call the
+ * function of the operation that is generated together with the CPU loop. Cycles are
+ * counted after each operation, and the translated code returns to the interpreter as
+ * soon as an event is due, an interrupt is to be taken, the block was invalidated by
+ * a store to its memory or the memory it was decoded from was remapped, e.g. by a bank
+ * switch.
+ *
+ * Operations that access IO registers through $FF00 + n or $FF00 + C and HALT/STOP end
+ * the translation, the interpreter runs them.
+ */
+
+/* Number of times a block is run by the interpreter before it is translated. */
+#define GB_JIT_THRESHOLD 16
+
+/**
+ * Size of the executable memory, all translations are dropped once it is full. It is
+ * only writable while a translation is emitted.
+ */
+#define GB_JIT_SIZE (4 << 20)
+
+/* Functions of all operations, CB prefixed ones at 0x100 + opcode. */
+extern const gb_jit_op jit_operations[0x200];
+
+/**
+ * Translate the block.
+ * Returns NULL in case the block does not start with an operation that can be
+ * translated or there is no executable memory.
+ */
+gb_cpu_code gb_jit_translate (gb_t *, gb_cpu_block *) ;
+
+/**
+ * Release the executable memory.
+ */
+void gb_jit_quit (gb_t *) ;
+
+#endif
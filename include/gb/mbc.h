@@ -12,6 +12,30 @@
  *
  * Each kind of supported MBC should implement a version of this.
  * */
-typedef void (* mbc_loader) (uint8_t*) ;
+typedef void (* mbc_loader) (gb_t *, uint8_t*) ;
+
+/**
+ * MBC state.
+ *
+ * Common registers for all controllers and then the state specific to the one loaded.
+ */
+typedef
+struct mbc
+{
+	/* cartridge RAM. */
+	uint8_t *ram;
+	size_t ram_size;
+
+	/* RAM enabled register. */
+	uint8_t ram_enabled;
+
+	union
+	{
+		gb_mbc1 mbc1;
+		gb_mbc3 mbc3;
+		gb_mbc5 mbc5;
+	};
+}
+gb_mbc;
 
 #endif
@@ -1,8 +1,9 @@
 #ifndef GB_MBC0
 #define GB_MBC0
 
+#include "gb.h"
 #include <stdint.h>
 
-void gb_mbc0_load (uint8_t*) ;
+void gb_mbc0_load (gb_t *, uint8_t*) ;
 
 #endif
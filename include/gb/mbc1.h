@@ -1,8 +1,22 @@
 #ifndef GB_MBC1
 #define GB_MBC1
 
+#include "gb.h"
 #include <stdint.h>
 
-void gb_mbc1_load (uint8_t* /* RAM */);
+/* MBC1 bank registers. */
+typedef
+struct mbc1
+{
+	/* ROM/RAM mode select. */
+	uint8_t select_mode;
+
+	uint8_t bank_lo;
+	uint8_t bank_hi;
+	uint8_t bank_ram;
+}
+gb_mbc1;
+
+void gb_mbc1_load (gb_t *, uint8_t* /* RAM */);
 
 #endif
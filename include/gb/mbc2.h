@@ -1,8 +1,9 @@
 #ifndef GB_MBC2
 #define GB_MBC2
 
+#include "gb.h"
 #include <stdint.h>
 
-void gb_mbc2_load (uint8_t* /* RAM */);
+void gb_mbc2_load (gb_t *, uint8_t* /* RAM */);
 
 #endif
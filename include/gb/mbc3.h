@@ -1,8 +1,46 @@
 #ifndef GB_MBC3
 #define GB_MBC3
 
+#include "gb.h"
 #include <stdint.h>
 
-void gb_mbc3_load (uint8_t*) ;
+/* MBC3 bank registers and real time clock. */
+typedef
+struct mbc3
+{
+	/* RTC registers and the one currently selected. */
+	uint8_t rtc[5];
+	uint8_t *rtc_;
+
+	/* Keep track of CPU clock cycles. */
+	uint32_t cc;
+
+	/* CPU cycle up to which the clock has been stepped. */
+	uint64_t synced;
+
+	/**
+	 * Timer in seconds.
+	 *
+	 * 32 bits should hold for about 136 years.
+	 */
+	uint32_t timer;
+
+	/* Keep track if the day counter overflowed. */
+	uint8_t day_count_overflow;
+
+	/* ROM bank number. */
+	uint8_t rom_bank;
+
+	/* current RAM bank. */
+	uint8_t ram_bank;
+
+	uint8_t flag_read_rtc;
+
+	/* Flag to indicate if the $00 was written to $6000-7FFF. */
+	uint8_t f_rtc_latched;
+}
+gb_mbc3;
+
+void gb_mbc3_load (gb_t *, uint8_t*) ;
 
 #endif
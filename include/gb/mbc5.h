@@ -1,8 +1,19 @@
 #ifndef GB_MBC5
 #define GB_MBC5
 
+#include "gb.h"
 #include <stdint.h>
 
-void gb_mbc5_load (uint8_t*) ;
+/* MBC5 ROM and RAM bank numbers. */
+typedef
+struct mbc5
+{
+	uint8_t bank_rom_lo;
+	uint8_t bank_rom_hi;
+	uint8_t bank_ram;
+}
+gb_mbc5;
+
+void gb_mbc5_load (gb_t *, uint8_t*) ;
 
 #endif
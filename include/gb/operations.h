@@ -1,5 +1,5 @@
 /**
-* operations.h: contains all the CPU operations mapped by opcode.
+* operations.h: contains all the CPU operations mapped by opcode and the loop running them.
 * This file has been autogenerated by using `lua instructions.lua`.
 */
 
@@ -14,1548 +14,3416 @@ struct operation
 	// name is the debugging name of the operation.
 	const char* name;
 
-	// the instruction to be executed
-	const int (*instruction)();
-
 	// number of bytes the operation consumes
 	const uint8_t b;
 
 	// number of cycles the operation needs.
 	// in some cases there might be more in the case of e.g. branching.
 	const uint8_t cc;
+
+	// the operation can change the program counter.
+	const uint8_t jump;
+
+	// the operation changes nothing but registers, so it can be part of an idle loop.
+	const uint8_t idle;
 }
 operation;
 
-int invalid_op () { fprintf (stderr, "$%.4X: INVALID OPERATION\n", pc); return 0; }
-int __ld__B_n__ () { uint8_t n = RAM (pc ++); B = n; return 8; }
-int __ld__C_n__ () { uint8_t n = RAM (pc ++); C = n; return 8; }
-int __ld__D_n__ () { uint8_t n = RAM (pc ++); D = n; return 8; }
-int __ld__E_n__ () { uint8_t n = RAM (pc ++); E = n; return 8; }
-int __ld__H_n__ () { uint8_t n = RAM (pc ++); H = n; return 8; }
-int __ld__L_n__ () { uint8_t n = RAM (pc ++); L = n; return 8; }
-int __ld__A_B__ () { A = B; return 4; }
-int __ld__A_C__ () { A = C; return 4; }
-int __ld__A_D__ () { A = D; return 4; }
-int __ld__A_E__ () { A = E; return 4; }
-int __ld__A_H__ () { A = H; return 4; }
-int __ld__A_L__ () { A = L; return 4; }
-int __ld__A__HL___ () { A = RAM (HL); return 8; }
-int __ld__B_B__ () { B = B; return 4; }
-int __ld__B_C__ () { B = C; return 4; }
-int __ld__B_D__ () { B = D; return 4; }
-int __ld__B_E__ () { B = E; return 4; }
-int __ld__B_H__ () { B = H; return 4; }
-int __ld__B_L__ () { B = L; return 4; }
-int __ld__B__HL___ () { B = RAM (HL); return 8; }
-int __ld__C_B__ () { C = B; return 4; }
-int __ld__C_C__ () { C = C; return 4; }
-int __ld__C_D__ () { C = D; return 4; }
-int __ld__C_E__ () { C = E; return 4; }
-int __ld__C_H__ () { C = H; return 4; }
-int __ld__C_L__ () { C = L; return 4; }
-int __ld__C__HL___ () { C = RAM (HL); return 8; }
-int __ld__D_B__ () { D = B; return 4; }
-int __ld__D_C__ () { D = C; return 4; }
-int __ld__D_D__ () { D = D; return 4; }
-int __ld__D_E__ () { D = E; return 4; }
-int __ld__D_H__ () { D = H; return 4; }
-int __ld__D_L__ () { D = L; return 4; }
-int __ld__D__HL___ () { D = RAM (HL); return 8; }
-int __ld__E_B__ () { E = B; return 4; }
-int __ld__E_C__ () { E = C; return 4; }
-int __ld__E_D__ () { E = D; return 4; }
-int __ld__E_E__ () { E = E; return 4; }
-int __ld__E_H__ () { E = H; return 4; }
-int __ld__E_L__ () { E = L; return 4; }
-int __ld__E__HL___ () { E = RAM (HL); return 8; }
-int __ld__H_B__ () { H = B; return 4; }
-int __ld__H_C__ () { H = C; return 4; }
-int __ld__H_D__ () { H = D; return 4; }
-int __ld__H_E__ () { H = E; return 4; }
-int __ld__H_H__ () { H = H; return 4; }
-int __ld__H_L__ () { H = L; return 4; }
-int __ld__H__HL___ () { H = RAM (HL); return 8; }
-int __ld__L_B__ () { L = B; return 4; }
-int __ld__L_C__ () { L = C; return 4; }
-int __ld__L_D__ () { L = D; return 4; }
-int __ld__L_E__ () { L = E; return 4; }
-int __ld__L_H__ () { L = H; return 4; }
-int __ld__L_L__ () { L = L; return 4; }
-int __ld__L__HL___ () { L = RAM (HL); return 8; }
-int __ld___HL__B__ () { STORE ((HL),B); return 8; }
-int __ld___HL__C__ () { STORE ((HL),C); return 8; }
-int __ld___HL__D__ () { STORE ((HL),D); return 8; }
-int __ld___HL__E__ () { STORE ((HL),E); return 8; }
-int __ld___HL__H__ () { STORE ((HL),H); return 8; }
-int __ld___HL__L__ () { STORE ((HL),L); return 8; }
-int __ld___HL__n__ () { uint8_t n = RAM (pc ++); STORE ((HL),n); return 12; }
-int __ld__A__BC___ () { A = RAM (BC); return 8; }
-int __ld__A__DE___ () { A = RAM (DE); return 8; }
-int __ld__A__nn___ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); A = RAM (nn); return 16; }
-int __ld__A_n__ () { uint8_t n = RAM (pc ++); A = n; return 8; }
-int __ld__A_A__ () { A = A; return 4; }
-int __ld__B_A__ () { B = A; return 4; }
-int __ld__C_A__ () { C = A; return 4; }
-int __ld__D_A__ () { D = A; return 4; }
-int __ld__E_A__ () { E = A; return 4; }
-int __ld__H_A__ () { H = A; return 4; }
-int __ld__L_A__ () { L = A; return 4; }
-int __ld___BC__A__ () { STORE ((BC),A); return 8; }
-int __ld___DE__A__ () { STORE ((DE),A); return 8; }
-int __ld___HL__A__ () { STORE ((HL),A); return 8; }
-int __ld___nn__A__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); STORE ((nn),A); return 16; }
-int __ld__A__C___ () { uint16_t nn = 0xFF00 | C; A = RAM (nn); return 8; }
-int __ld___C__A__ () { uint16_t nn = 0xFF00 | C; STORE ((nn),A); return 8; }
-int __ldd__A__HL___ () { A = RAM (HL); HL --; return 8; }
-int __ldd___HL__A__ () { STORE ((HL),A); HL --; return 8; }
-int __ldi__A__HL___ () { A = RAM (HL); HL ++; return 8; }
-int __ldi___HL__A__ () { STORE ((HL),A); HL ++; return 8; }
-int __ld___n__A__ () { uint16_t n = 0xFF00 | RAM (pc ++); STORE ((n),A); return 12; }
-int __ld__A__n___ () { uint16_t n = 0xFF00 | RAM (pc ++); A = RAM (n); return 12; }
-int __ld__BC_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); BC = nn; return 12; }
-int __ld__DE_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); DE = nn; return 12; }
-int __ld__HL_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); HL = nn; return 12; }
-int __ld__SP_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); SP = nn; return 12; }
-int __ld__SP_HL__ () { SP = HL; return 8; }
-int __ldhl__n__ () { uint8_t n = RAM (pc ++); ldhl (n); return 12; }
-int __ld___nn__SP__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); STORE ((nn),SP); STORE (nn + 1, SP >> 8); return 20; }
-int __push__AF__ () { push (AF); return 16; }
-int __push__BC__ () { push (BC); return 16; }
-int __push__DE__ () { push (DE); return 16; }
-int __push__HL__ () { push (HL); return 16; }
-int __pop__AF__ () { pop (&AF); F &= 0xF0; return 12; }
-int __pop__BC__ () { pop (&BC); return 12; }
-int __pop__DE__ () { pop (&DE); return 12; }
-int __pop__HL__ () { pop (&HL); return 12; }
-int __add__A__ () { add (A); return 4; }
-int __add__B__ () { add (B); return 4; }
-int __add__C__ () { add (C); return 4; }
-int __add__D__ () { add (D); return 4; }
-int __add__E__ () { add (E); return 4; }
-int __add__H__ () { add (H); return 4; }
-int __add__L__ () { add (L); return 4; }
-int __add___HL___ () { add (RAM (HL)); return 8; }
-int __add__n__ () { uint8_t n = RAM (pc ++); add (n); return 8; }
-int __adc__A__ () { adc (A); return 4; }
-int __adc__B__ () { adc (B); return 4; }
-int __adc__C__ () { adc (C); return 4; }
-int __adc__D__ () { adc (D); return 4; }
-int __adc__E__ () { adc (E); return 4; }
-int __adc__H__ () { adc (H); return 4; }
-int __adc__L__ () { adc (L); return 4; }
-int __adc___HL___ () { adc (RAM (HL)); return 8; }
-int __adc__n__ () { uint8_t n = RAM (pc ++); adc (n); return 8; }
-int __sub__A__ () { sub (A); return 4; }
-int __sub__B__ () { sub (B); return 4; }
-int __sub__C__ () { sub (C); return 4; }
-int __sub__D__ () { sub (D); return 4; }
-int __sub__E__ () { sub (E); return 4; }
-int __sub__H__ () { sub (H); return 4; }
-int __sub__L__ () { sub (L); return 4; }
-int __sub___HL___ () { sub (RAM (HL)); return 8; }
-int __sub__n__ () { uint8_t n = RAM (pc ++); sub (n); return 8; }
-int __sbc__A__ () { sbc (A); return 4; }
-int __sbc__B__ () { sbc (B); return 4; }
-int __sbc__C__ () { sbc (C); return 4; }
-int __sbc__D__ () { sbc (D); return 4; }
-int __sbc__E__ () { sbc (E); return 4; }
-int __sbc__H__ () { sbc (H); return 4; }
-int __sbc__L__ () { sbc (L); return 4; }
-int __sbc___HL___ () { sbc (RAM (HL)); return 8; }
-int __sbc__n__ () { uint8_t n = RAM (pc ++); sbc (n); return 8; }
-int __and__A__ () { and (A); return 4; }
-int __and__B__ () { and (B); return 4; }
-int __and__C__ () { and (C); return 4; }
-int __and__D__ () { and (D); return 4; }
-int __and__E__ () { and (E); return 4; }
-int __and__H__ () { and (H); return 4; }
-int __and__L__ () { and (L); return 4; }
-int __and___HL___ () { and (RAM (HL)); return 8; }
-int __and__n__ () { uint8_t n = RAM (pc ++); and (n); return 8; }
-int __or__A__ () { or (A); return 4; }
-int __or__B__ () { or (B); return 4; }
-int __or__C__ () { or (C); return 4; }
-int __or__D__ () { or (D); return 4; }
-int __or__E__ () { or (E); return 4; }
-int __or__H__ () { or (H); return 4; }
-int __or__L__ () { or (L); return 4; }
-int __or___HL___ () { or (RAM (HL)); return 8; }
-int __or__n__ () { uint8_t n = RAM (pc ++); or (n); return 8; }
-int __xor__A__ () { xor (A); return 4; }
-int __xor__B__ () { xor (B); return 4; }
-int __xor__C__ () { xor (C); return 4; }
-int __xor__D__ () { xor (D); return 4; }
-int __xor__E__ () { xor (E); return 4; }
-int __xor__H__ () { xor (H); return 4; }
-int __xor__L__ () { xor (L); return 4; }
-int __xor___HL___ () { xor (RAM (HL)); return 8; }
-int __xor__n__ () { uint8_t n = RAM (pc ++); xor (n); return 8; }
-int __cp__A__ () { cp (A); return 4; }
-int __cp__B__ () { cp (B); return 4; }
-int __cp__C__ () { cp (C); return 4; }
-int __cp__D__ () { cp (D); return 4; }
-int __cp__E__ () { cp (E); return 4; }
-int __cp__H__ () { cp (H); return 4; }
-int __cp__L__ () { cp (L); return 4; }
-int __cp___HL___ () { cp (RAM (HL)); return 8; }
-int __cp__n__ () { uint8_t n = RAM (pc ++); cp (n); return 8; }
-int __inc__A__ () { inc (&A); return 4; }
-int __inc__B__ () { inc (&B); return 4; }
-int __inc__C__ () { inc (&C); return 4; }
-int __inc__D__ () { inc (&D); return 4; }
-int __inc__E__ () { inc (&E); return 4; }
-int __inc__H__ () { inc (&H); return 4; }
-int __inc__L__ () { inc (&L); return 4; }
-int __inc___HL___ () { uint8_t n = RAM (HL); inc (&n); STORE (HL, n); return 12; }
-int __dec__A__ () { dec (&A); return 4; }
-int __dec__B__ () { dec (&B); return 4; }
-int __dec__C__ () { dec (&C); return 4; }
-int __dec__D__ () { dec (&D); return 4; }
-int __dec__E__ () { dec (&E); return 4; }
-int __dec__H__ () { dec (&H); return 4; }
-int __dec__L__ () { dec (&L); return 4; }
-int __dec___HL___ () { uint8_t n = RAM (HL); dec (&n); STORE (HL, n); return 12; }
-int __addhl__BC__ () { addhl (BC); return 8; }
-int __addhl__DE__ () { addhl (DE); return 8; }
-int __addhl__HL__ () { addhl (HL); return 8; }
-int __addhl__SP__ () { addhl (SP); return 8; }
-int __addsp__n__ () { uint8_t n = RAM (pc ++); addsp (n); return 16; }
-int __inc16__BC__ () { inc16 (&BC); return 8; }
-int __inc16__DE__ () { inc16 (&DE); return 8; }
-int __inc16__HL__ () { inc16 (&HL); return 8; }
-int __inc16__SP__ () { inc16 (&SP); return 8; }
-int __dec16__BC__ () { dec16 (&BC); return 8; }
-int __dec16__DE__ () { dec16 (&DE); return 8; }
-int __dec16__HL__ () { dec16 (&HL); return 8; }
-int __dec16__SP__ () { dec16 (&SP); return 8; }
-int __swap__A__ () { swap (&A); return 8; }
-int __swap__B__ () { swap (&B); return 8; }
-int __swap__C__ () { swap (&C); return 8; }
-int __swap__D__ () { swap (&D); return 8; }
-int __swap__E__ () { swap (&E); return 8; }
-int __swap__H__ () { swap (&H); return 8; }
-int __swap__L__ () { swap (&L); return 8; }
-int __swap___HL___ () { uint8_t n = RAM (HL); swap (&n); STORE (HL, n); return 16; }
-int __daa__ () { daa (); return 4; }
-int __cpl__ () { cpl (); return 4; }
-int __ccf__ () { ccf (); return 4; }
-int __scf__ () { scf (); return 4; }
-int __nop__ () { nop (); return 4; }
-int __halt__ () { halt (); return 4; }
-int __stop__ () { stop (); return 4; }
-int __di__ () { di (); return 4; }
-int __ei__ () { ei (); return 4; }
-int __rlca__ () { rlca (); return 4; }
-int __rla__ () { rla (); return 4; }
-int __rrca__ () { rrca (); return 4; }
-int __rra__ () { rra (); return 4; }
-int __rlc__A__ () { rlc (&A); return 8; }
-int __rlc__B__ () { rlc (&B); return 8; }
-int __rlc__C__ () { rlc (&C); return 8; }
-int __rlc__D__ () { rlc (&D); return 8; }
-int __rlc__E__ () { rlc (&E); return 8; }
-int __rlc__H__ () { rlc (&H); return 8; }
-int __rlc__L__ () { rlc (&L); return 8; }
-int __rlc___HL___ () { uint8_t n = RAM (HL); rlc (&n); STORE (HL, n); return 16; }
-int __rl__A__ () { rl (&A); return 8; }
-int __rl__B__ () { rl (&B); return 8; }
-int __rl__C__ () { rl (&C); return 8; }
-int __rl__D__ () { rl (&D); return 8; }
-int __rl__E__ () { rl (&E); return 8; }
-int __rl__H__ () { rl (&H); return 8; }
-int __rl__L__ () { rl (&L); return 8; }
-int __rl___HL___ () { uint8_t n = RAM (HL); rl (&n); STORE (HL, n); return 16; }
-int __rrc__A__ () { rrc (&A); return 8; }
-int __rrc__B__ () { rrc (&B); return 8; }
-int __rrc__C__ () { rrc (&C); return 8; }
-int __rrc__D__ () { rrc (&D); return 8; }
-int __rrc__E__ () { rrc (&E); return 8; }
-int __rrc__H__ () { rrc (&H); return 8; }
-int __rrc__L__ () { rrc (&L); return 8; }
-int __rrc___HL___ () { uint8_t n = RAM (HL); rrc (&n); STORE (HL, n); return 16; }
-int __rr__A__ () { rr (&A); return 8; }
-int __rr__B__ () { rr (&B); return 8; }
-int __rr__C__ () { rr (&C); return 8; }
-int __rr__D__ () { rr (&D); return 8; }
-int __rr__E__ () { rr (&E); return 8; }
-int __rr__H__ () { rr (&H); return 8; }
-int __rr__L__ () { rr (&L); return 8; }
-int __rr___HL___ () { uint8_t n = RAM (HL); rr (&n); STORE (HL, n); return 16; }
-int __sla__A__ () { sla (&A); return 8; }
-int __sla__B__ () { sla (&B); return 8; }
-int __sla__C__ () { sla (&C); return 8; }
-int __sla__D__ () { sla (&D); return 8; }
-int __sla__E__ () { sla (&E); return 8; }
-int __sla__H__ () { sla (&H); return 8; }
-int __sla__L__ () { sla (&L); return 8; }
-int __sla___HL___ () { uint8_t n = RAM (HL); sla (&n); STORE (HL, n); return 16; }
-int __sra__A__ () { sra (&A); return 8; }
-int __sra__B__ () { sra (&B); return 8; }
-int __sra__C__ () { sra (&C); return 8; }
-int __sra__D__ () { sra (&D); return 8; }
-int __sra__E__ () { sra (&E); return 8; }
-int __sra__H__ () { sra (&H); return 8; }
-int __sra__L__ () { sra (&L); return 8; }
-int __sra___HL___ () { uint8_t n = RAM (HL); sra (&n); STORE (HL, n); return 16; }
-int __srl__A__ () { srl (&A); return 8; }
-int __srl__B__ () { srl (&B); return 8; }
-int __srl__C__ () { srl (&C); return 8; }
-int __srl__D__ () { srl (&D); return 8; }
-int __srl__E__ () { srl (&E); return 8; }
-int __srl__H__ () { srl (&H); return 8; }
-int __srl__L__ () { srl (&L); return 8; }
-int __srl___HL___ () { uint8_t n = RAM (HL); srl (&n); STORE (HL, n); return 16; }
-int __bit__A_0__ () { bit (A,0); return 8; }
-int __bit__A_1__ () { bit (A,1); return 8; }
-int __bit__A_2__ () { bit (A,2); return 8; }
-int __bit__A_3__ () { bit (A,3); return 8; }
-int __bit__A_4__ () { bit (A,4); return 8; }
-int __bit__A_5__ () { bit (A,5); return 8; }
-int __bit__A_6__ () { bit (A,6); return 8; }
-int __bit__A_7__ () { bit (A,7); return 8; }
-int __bit__B_0__ () { bit (B,0); return 8; }
-int __bit__B_1__ () { bit (B,1); return 8; }
-int __bit__B_2__ () { bit (B,2); return 8; }
-int __bit__B_3__ () { bit (B,3); return 8; }
-int __bit__B_4__ () { bit (B,4); return 8; }
-int __bit__B_5__ () { bit (B,5); return 8; }
-int __bit__B_6__ () { bit (B,6); return 8; }
-int __bit__B_7__ () { bit (B,7); return 8; }
-int __bit__C_0__ () { bit (C,0); return 8; }
-int __bit__C_1__ () { bit (C,1); return 8; }
-int __bit__C_2__ () { bit (C,2); return 8; }
-int __bit__C_3__ () { bit (C,3); return 8; }
-int __bit__C_4__ () { bit (C,4); return 8; }
-int __bit__C_5__ () { bit (C,5); return 8; }
-int __bit__C_6__ () { bit (C,6); return 8; }
-int __bit__C_7__ () { bit (C,7); return 8; }
-int __bit__D_0__ () { bit (D,0); return 8; }
-int __bit__D_1__ () { bit (D,1); return 8; }
-int __bit__D_2__ () { bit (D,2); return 8; }
-int __bit__D_3__ () { bit (D,3); return 8; }
-int __bit__D_4__ () { bit (D,4); return 8; }
-int __bit__D_5__ () { bit (D,5); return 8; }
-int __bit__D_6__ () { bit (D,6); return 8; }
-int __bit__D_7__ () { bit (D,7); return 8; }
-int __bit__E_0__ () { bit (E,0); return 8; }
-int __bit__E_1__ () { bit (E,1); return 8; }
-int __bit__E_2__ () { bit (E,2); return 8; }
-int __bit__E_3__ () { bit (E,3); return 8; }
-int __bit__E_4__ () { bit (E,4); return 8; }
-int __bit__E_5__ () { bit (E,5); return 8; }
-int __bit__E_6__ () { bit (E,6); return 8; }
-int __bit__E_7__ () { bit (E,7); return 8; }
-int __bit__H_0__ () { bit (H,0); return 8; }
-int __bit__H_1__ () { bit (H,1); return 8; }
-int __bit__H_2__ () { bit (H,2); return 8; }
-int __bit__H_3__ () { bit (H,3); return 8; }
-int __bit__H_4__ () { bit (H,4); return 8; }
-int __bit__H_5__ () { bit (H,5); return 8; }
-int __bit__H_6__ () { bit (H,6); return 8; }
-int __bit__H_7__ () { bit (H,7); return 8; }
-int __bit__L_0__ () { bit (L,0); return 8; }
-int __bit__L_1__ () { bit (L,1); return 8; }
-int __bit__L_2__ () { bit (L,2); return 8; }
-int __bit__L_3__ () { bit (L,3); return 8; }
-int __bit__L_4__ () { bit (L,4); return 8; }
-int __bit__L_5__ () { bit (L,5); return 8; }
-int __bit__L_6__ () { bit (L,6); return 8; }
-int __bit__L_7__ () { bit (L,7); return 8; }
-int __bit___HL__0__ () { bit (RAM (HL),0); return 12; }
-int __bit___HL__1__ () { bit (RAM (HL),1); return 12; }
-int __bit___HL__2__ () { bit (RAM (HL),2); return 12; }
-int __bit___HL__3__ () { bit (RAM (HL),3); return 12; }
-int __bit___HL__4__ () { bit (RAM (HL),4); return 12; }
-int __bit___HL__5__ () { bit (RAM (HL),5); return 12; }
-int __bit___HL__6__ () { bit (RAM (HL),6); return 12; }
-int __bit___HL__7__ () { bit (RAM (HL),7); return 12; }
-int __set__A_0__ () { set (&A,0); return 8; }
-int __set__A_1__ () { set (&A,1); return 8; }
-int __set__A_2__ () { set (&A,2); return 8; }
-int __set__A_3__ () { set (&A,3); return 8; }
-int __set__A_4__ () { set (&A,4); return 8; }
-int __set__A_5__ () { set (&A,5); return 8; }
-int __set__A_6__ () { set (&A,6); return 8; }
-int __set__A_7__ () { set (&A,7); return 8; }
-int __set__B_0__ () { set (&B,0); return 8; }
-int __set__B_1__ () { set (&B,1); return 8; }
-int __set__B_2__ () { set (&B,2); return 8; }
-int __set__B_3__ () { set (&B,3); return 8; }
-int __set__B_4__ () { set (&B,4); return 8; }
-int __set__B_5__ () { set (&B,5); return 8; }
-int __set__B_6__ () { set (&B,6); return 8; }
-int __set__B_7__ () { set (&B,7); return 8; }
-int __set__C_0__ () { set (&C,0); return 8; }
-int __set__C_1__ () { set (&C,1); return 8; }
-int __set__C_2__ () { set (&C,2); return 8; }
-int __set__C_3__ () { set (&C,3); return 8; }
-int __set__C_4__ () { set (&C,4); return 8; }
-int __set__C_5__ () { set (&C,5); return 8; }
-int __set__C_6__ () { set (&C,6); return 8; }
-int __set__C_7__ () { set (&C,7); return 8; }
-int __set__D_0__ () { set (&D,0); return 8; }
-int __set__D_1__ () { set (&D,1); return 8; }
-int __set__D_2__ () { set (&D,2); return 8; }
-int __set__D_3__ () { set (&D,3); return 8; }
-int __set__D_4__ () { set (&D,4); return 8; }
-int __set__D_5__ () { set (&D,5); return 8; }
-int __set__D_6__ () { set (&D,6); return 8; }
-int __set__D_7__ () { set (&D,7); return 8; }
-int __set__E_0__ () { set (&E,0); return 8; }
-int __set__E_1__ () { set (&E,1); return 8; }
-int __set__E_2__ () { set (&E,2); return 8; }
-int __set__E_3__ () { set (&E,3); return 8; }
-int __set__E_4__ () { set (&E,4); return 8; }
-int __set__E_5__ () { set (&E,5); return 8; }
-int __set__E_6__ () { set (&E,6); return 8; }
-int __set__E_7__ () { set (&E,7); return 8; }
-int __set__H_0__ () { set (&H,0); return 8; }
-int __set__H_1__ () { set (&H,1); return 8; }
-int __set__H_2__ () { set (&H,2); return 8; }
-int __set__H_3__ () { set (&H,3); return 8; }
-int __set__H_4__ () { set (&H,4); return 8; }
-int __set__H_5__ () { set (&H,5); return 8; }
-int __set__H_6__ () { set (&H,6); return 8; }
-int __set__H_7__ () { set (&H,7); return 8; }
-int __set__L_0__ () { set (&L,0); return 8; }
-int __set__L_1__ () { set (&L,1); return 8; }
-int __set__L_2__ () { set (&L,2); return 8; }
-int __set__L_3__ () { set (&L,3); return 8; }
-int __set__L_4__ () { set (&L,4); return 8; }
-int __set__L_5__ () { set (&L,5); return 8; }
-int __set__L_6__ () { set (&L,6); return 8; }
-int __set__L_7__ () { set (&L,7); return 8; }
-int __set___HL__0__ () { uint8_t n = RAM (HL); set (&n,0); STORE (HL, n); return 16; }
-int __set___HL__1__ () { uint8_t n = RAM (HL); set (&n,1); STORE (HL, n); return 16; }
-int __set___HL__2__ () { uint8_t n = RAM (HL); set (&n,2); STORE (HL, n); return 16; }
-int __set___HL__3__ () { uint8_t n = RAM (HL); set (&n,3); STORE (HL, n); return 16; }
-int __set___HL__4__ () { uint8_t n = RAM (HL); set (&n,4); STORE (HL, n); return 16; }
-int __set___HL__5__ () { uint8_t n = RAM (HL); set (&n,5); STORE (HL, n); return 16; }
-int __set___HL__6__ () { uint8_t n = RAM (HL); set (&n,6); STORE (HL, n); return 16; }
-int __set___HL__7__ () { uint8_t n = RAM (HL); set (&n,7); STORE (HL, n); return 16; }
-int __res__A_0__ () { res (&A,0); return 8; }
-int __res__A_1__ () { res (&A,1); return 8; }
-int __res__A_2__ () { res (&A,2); return 8; }
-int __res__A_3__ () { res (&A,3); return 8; }
-int __res__A_4__ () { res (&A,4); return 8; }
-int __res__A_5__ () { res (&A,5); return 8; }
-int __res__A_6__ () { res (&A,6); return 8; }
-int __res__A_7__ () { res (&A,7); return 8; }
-int __res__B_0__ () { res (&B,0); return 8; }
-int __res__B_1__ () { res (&B,1); return 8; }
-int __res__B_2__ () { res (&B,2); return 8; }
-int __res__B_3__ () { res (&B,3); return 8; }
-int __res__B_4__ () { res (&B,4); return 8; }
-int __res__B_5__ () { res (&B,5); return 8; }
-int __res__B_6__ () { res (&B,6); return 8; }
-int __res__B_7__ () { res (&B,7); return 8; }
-int __res__C_0__ () { res (&C,0); return 8; }
-int __res__C_1__ () { res (&C,1); return 8; }
-int __res__C_2__ () { res (&C,2); return 8; }
-int __res__C_3__ () { res (&C,3); return 8; }
-int __res__C_4__ () { res (&C,4); return 8; }
-int __res__C_5__ () { res (&C,5); return 8; }
-int __res__C_6__ () { res (&C,6); return 8; }
-int __res__C_7__ () { res (&C,7); return 8; }
-int __res__D_0__ () { res (&D,0); return 8; }
-int __res__D_1__ () { res (&D,1); return 8; }
-int __res__D_2__ () { res (&D,2); return 8; }
-int __res__D_3__ () { res (&D,3); return 8; }
-int __res__D_4__ () { res (&D,4); return 8; }
-int __res__D_5__ () { res (&D,5); return 8; }
-int __res__D_6__ () { res (&D,6); return 8; }
-int __res__D_7__ () { res (&D,7); return 8; }
-int __res__E_0__ () { res (&E,0); return 8; }
-int __res__E_1__ () { res (&E,1); return 8; }
-int __res__E_2__ () { res (&E,2); return 8; }
-int __res__E_3__ () { res (&E,3); return 8; }
-int __res__E_4__ () { res (&E,4); return 8; }
-int __res__E_5__ () { res (&E,5); return 8; }
-int __res__E_6__ () { res (&E,6); return 8; }
-int __res__E_7__ () { res (&E,7); return 8; }
-int __res__H_0__ () { res (&H,0); return 8; }
-int __res__H_1__ () { res (&H,1); return 8; }
-int __res__H_2__ () { res (&H,2); return 8; }
-int __res__H_3__ () { res (&H,3); return 8; }
-int __res__H_4__ () { res (&H,4); return 8; }
-int __res__H_5__ () { res (&H,5); return 8; }
-int __res__H_6__ () { res (&H,6); return 8; }
-int __res__H_7__ () { res (&H,7); return 8; }
-int __res__L_0__ () { res (&L,0); return 8; }
-int __res__L_1__ () { res (&L,1); return 8; }
-int __res__L_2__ () { res (&L,2); return 8; }
-int __res__L_3__ () { res (&L,3); return 8; }
-int __res__L_4__ () { res (&L,4); return 8; }
-int __res__L_5__ () { res (&L,5); return 8; }
-int __res__L_6__ () { res (&L,6); return 8; }
-int __res__L_7__ () { res (&L,7); return 8; }
-int __res___HL__0__ () { uint8_t n = RAM (HL); res (&n,0); STORE (HL, n); return 16; }
-int __res___HL__1__ () { uint8_t n = RAM (HL); res (&n,1); STORE (HL, n); return 16; }
-int __res___HL__2__ () { uint8_t n = RAM (HL); res (&n,2); STORE (HL, n); return 16; }
-int __res___HL__3__ () { uint8_t n = RAM (HL); res (&n,3); STORE (HL, n); return 16; }
-int __res___HL__4__ () { uint8_t n = RAM (HL); res (&n,4); STORE (HL, n); return 16; }
-int __res___HL__5__ () { uint8_t n = RAM (HL); res (&n,5); STORE (HL, n); return 16; }
-int __res___HL__6__ () { uint8_t n = RAM (HL); res (&n,6); STORE (HL, n); return 16; }
-int __res___HL__7__ () { uint8_t n = RAM (HL); res (&n,7); STORE (HL, n); return 16; }
-int __jp__nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); jp (nn); return 16; }
-int __jpcc__JP_CC_NZ_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); jpcc (JP_CC_NZ,nn); return 12; }
-int __jpcc__JP_CC_Z_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); jpcc (JP_CC_Z,nn); return 12; }
-int __jpcc__JP_CC_NC_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); jpcc (JP_CC_NC,nn); return 12; }
-int __jpcc__JP_CC_C_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); jpcc (JP_CC_C,nn); return 12; }
-int __jp__HL__ () { jp (HL); return 4; }
-int __jr__n__ () { uint8_t n = RAM (pc ++); jr (n); return 12; }
-int __jrcc__JP_CC_NZ_n__ () { uint8_t n = RAM (pc ++); jrcc (JP_CC_NZ,n); return 8; }
-int __jrcc__JP_CC_Z_n__ () { uint8_t n = RAM (pc ++); jrcc (JP_CC_Z,n); return 8; }
-int __jrcc__JP_CC_NC_n__ () { uint8_t n = RAM (pc ++); jrcc (JP_CC_NC,n); return 8; }
-int __jrcc__JP_CC_C_n__ () { uint8_t n = RAM (pc ++); jrcc (JP_CC_C,n); return 8; }
-int __call__nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); call (nn); return 24; }
-int __callcc__JP_CC_NZ_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); callcc (JP_CC_NZ,nn); return 12; }
-int __callcc__JP_CC_Z_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); callcc (JP_CC_Z,nn); return 12; }
-int __callcc__JP_CC_NC_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); callcc (JP_CC_NC,nn); return 12; }
-int __callcc__JP_CC_C_nn__ () { uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); callcc (JP_CC_C,nn); return 12; }
-int __rst__0x00__ () { rst (0x00); return 16; }
-int __rst__0x08__ () { rst (0x08); return 16; }
-int __rst__0x10__ () { rst (0x10); return 16; }
-int __rst__0x18__ () { rst (0x18); return 16; }
-int __rst__0x20__ () { rst (0x20); return 16; }
-int __rst__0x28__ () { rst (0x28); return 16; }
-int __rst__0x30__ () { rst (0x30); return 16; }
-int __rst__0x38__ () { rst (0x38); return 16; }
-int __ret__ () { ret (); return 16; }
-int __retcc__JP_CC_NZ__ () { retcc (JP_CC_NZ); return 8; }
-int __retcc__JP_CC_Z__ () { retcc (JP_CC_Z); return 8; }
-int __retcc__JP_CC_NC__ () { retcc (JP_CC_NC); return 8; }
-int __retcc__JP_CC_C__ () { retcc (JP_CC_C); return 8; }
-int __reti__ () { reti (); return 16; }
-
 const operation operations_cb[256] = {
 // 00: RLC B
-{ "RLC B", &__rlc__B__, 0, 8 },
+{ "RLC B", 2, 8, 0, 1 },
 // 01: RLC C
-{ "RLC C", &__rlc__C__, 0, 8 },
+{ "RLC C", 2, 8, 0, 1 },
 // 02: RLC D
-{ "RLC D", &__rlc__D__, 0, 8 },
+{ "RLC D", 2, 8, 0, 1 },
 // 03: RLC E
-{ "RLC E", &__rlc__E__, 0, 8 },
+{ "RLC E", 2, 8, 0, 1 },
 // 04: RLC H
-{ "RLC H", &__rlc__H__, 0, 8 },
+{ "RLC H", 2, 8, 0, 1 },
 // 05: RLC L
-{ "RLC L", &__rlc__L__, 0, 8 },
+{ "RLC L", 2, 8, 0, 1 },
 // 06: RLC (HL)
-{ "RLC (HL)", &__rlc___HL___, 0, 16 },
+{ "RLC (HL)", 2, 16, 0, 0 },
 // 07: RLC A
-{ "RLC A", &__rlc__A__, 0, 8 },
+{ "RLC A", 2, 8, 0, 1 },
 // 08: RRC B
-{ "RRC B", &__rrc__B__, 0, 8 },
+{ "RRC B", 2, 8, 0, 1 },
 // 09: RRC C
-{ "RRC C", &__rrc__C__, 0, 8 },
+{ "RRC C", 2, 8, 0, 1 },
 // 0A: RRC D
-{ "RRC D", &__rrc__D__, 0, 8 },
+{ "RRC D", 2, 8, 0, 1 },
 // 0B: RRC E
-{ "RRC E", &__rrc__E__, 0, 8 },
+{ "RRC E", 2, 8, 0, 1 },
 // 0C: RRC H
-{ "RRC H", &__rrc__H__, 0, 8 },
+{ "RRC H", 2, 8, 0, 1 },
 // 0D: RRC L
-{ "RRC L", &__rrc__L__, 0, 8 },
+{ "RRC L", 2, 8, 0, 1 },
 // 0E: RRC (HL)
-{ "RRC (HL)", &__rrc___HL___, 0, 16 },
+{ "RRC (HL)", 2, 16, 0, 0 },
 // 0F: RRC A
-{ "RRC A", &__rrc__A__, 0, 8 },
+{ "RRC A", 2, 8, 0, 1 },
 // 10: RL B
-{ "RL B", &__rl__B__, 0, 8 },
+{ "RL B", 2, 8, 0, 1 },
 // 11: RL C
-{ "RL C", &__rl__C__, 0, 8 },
+{ "RL C", 2, 8, 0, 1 },
 // 12: RL D
-{ "RL D", &__rl__D__, 0, 8 },
+{ "RL D", 2, 8, 0, 1 },
 // 13: RL E
-{ "RL E", &__rl__E__, 0, 8 },
+{ "RL E", 2, 8, 0, 1 },
 // 14: RL H
-{ "RL H", &__rl__H__, 0, 8 },
+{ "RL H", 2, 8, 0, 1 },
 // 15: RL L
-{ "RL L", &__rl__L__, 0, 8 },
+{ "RL L", 2, 8, 0, 1 },
 // 16: RL (HL)
-{ "RL (HL)", &__rl___HL___, 0, 16 },
+{ "RL (HL)", 2, 16, 0, 0 },
 // 17: RL A
-{ "RL A", &__rl__A__, 0, 8 },
+{ "RL A", 2, 8, 0, 1 },
 // 18: RR B
-{ "RR B", &__rr__B__, 0, 8 },
+{ "RR B", 2, 8, 0, 1 },
 // 19: RR C
-{ "RR C", &__rr__C__, 0, 8 },
+{ "RR C", 2, 8, 0, 1 },
 // 1A: RR D
-{ "RR D", &__rr__D__, 0, 8 },
+{ "RR D", 2, 8, 0, 1 },
 // 1B: RR E
-{ "RR E", &__rr__E__, 0, 8 },
+{ "RR E", 2, 8, 0, 1 },
 // 1C: RR H
-{ "RR H", &__rr__H__, 0, 8 },
+{ "RR H", 2, 8, 0, 1 },
 // 1D: RR L
-{ "RR L", &__rr__L__, 0, 8 },
+{ "RR L", 2, 8, 0, 1 },
 // 1E: RR (HL)
-{ "RR (HL)", &__rr___HL___, 0, 16 },
+{ "RR (HL)", 2, 16, 0, 0 },
 // 1F: RR A
-{ "RR A", &__rr__A__, 0, 8 },
+{ "RR A", 2, 8, 0, 1 },
 // 20: SLA B
-{ "SLA B", &__sla__B__, 0, 8 },
+{ "SLA B", 2, 8, 0, 1 },
 // 21: SLA C
-{ "SLA C", &__sla__C__, 0, 8 },
+{ "SLA C", 2, 8, 0, 1 },
 // 22: SLA D
-{ "SLA D", &__sla__D__, 0, 8 },
+{ "SLA D", 2, 8, 0, 1 },
 // 23: SLA E
-{ "SLA E", &__sla__E__, 0, 8 },
+{ "SLA E", 2, 8, 0, 1 },
 // 24: SLA H
-{ "SLA H", &__sla__H__, 0, 8 },
+{ "SLA H", 2, 8, 0, 1 },
 // 25: SLA L
-{ "SLA L", &__sla__L__, 0, 8 },
+{ "SLA L", 2, 8, 0, 1 },
 // 26: SLA (HL)
-{ "SLA (HL)", &__sla___HL___, 0, 16 },
+{ "SLA (HL)", 2, 16, 0, 0 },
 // 27: SLA A
-{ "SLA A", &__sla__A__, 0, 8 },
+{ "SLA A", 2, 8, 0, 1 },
 // 28: SRA B
-{ "SRA B", &__sra__B__, 0, 8 },
+{ "SRA B", 2, 8, 0, 1 },
 // 29: SRA C
-{ "SRA C", &__sra__C__, 0, 8 },
+{ "SRA C", 2, 8, 0, 1 },
 // 2A: SRA D
-{ "SRA D", &__sra__D__, 0, 8 },
+{ "SRA D", 2, 8, 0, 1 },
 // 2B: SRA E
-{ "SRA E", &__sra__E__, 0, 8 },
+{ "SRA E", 2, 8, 0, 1 },
 // 2C: SRA H
-{ "SRA H", &__sra__H__, 0, 8 },
+{ "SRA H", 2, 8, 0, 1 },
 // 2D: SRA L
-{ "SRA L", &__sra__L__, 0, 8 },
+{ "SRA L", 2, 8, 0, 1 },
 // 2E: SRA (HL)
-{ "SRA (HL)", &__sra___HL___, 0, 16 },
+{ "SRA (HL)", 2, 16, 0, 0 },
 // 2F: SRA A
-{ "SRA A", &__sra__A__, 0, 8 },
+{ "SRA A", 2, 8, 0, 1 },
 // 30: SWAP B
-{ "SWAP B", &__swap__B__, 0, 8 },
+{ "SWAP B", 2, 8, 0, 1 },
 // 31: SWAP C
-{ "SWAP C", &__swap__C__, 0, 8 },
+{ "SWAP C", 2, 8, 0, 1 },
 // 32: SWAP D
-{ "SWAP D", &__swap__D__, 0, 8 },
+{ "SWAP D", 2, 8, 0, 1 },
 // 33: SWAP E
-{ "SWAP E", &__swap__E__, 0, 8 },
+{ "SWAP E", 2, 8, 0, 1 },
 // 34: SWAP H
-{ "SWAP H", &__swap__H__, 0, 8 },
+{ "SWAP H", 2, 8, 0, 1 },
 // 35: SWAP L
-{ "SWAP L", &__swap__L__, 0, 8 },
+{ "SWAP L", 2, 8, 0, 1 },
 // 36: SWAP (HL)
-{ "SWAP (HL)", &__swap___HL___, 0, 16 },
+{ "SWAP (HL)", 2, 16, 0, 0 },
 // 37: SWAP A
-{ "SWAP A", &__swap__A__, 0, 8 },
+{ "SWAP A", 2, 8, 0, 1 },
 // 38: SRL B
-{ "SRL B", &__srl__B__, 0, 8 },
+{ "SRL B", 2, 8, 0, 1 },
 // 39: SRL C
-{ "SRL C", &__srl__C__, 0, 8 },
+{ "SRL C", 2, 8, 0, 1 },
 // 3A: SRL D
-{ "SRL D", &__srl__D__, 0, 8 },
+{ "SRL D", 2, 8, 0, 1 },
 // 3B: SRL E
-{ "SRL E", &__srl__E__, 0, 8 },
+{ "SRL E", 2, 8, 0, 1 },
 // 3C: SRL H
-{ "SRL H", &__srl__H__, 0, 8 },
+{ "SRL H", 2, 8, 0, 1 },
 // 3D: SRL L
-{ "SRL L", &__srl__L__, 0, 8 },
+{ "SRL L", 2, 8, 0, 1 },
 // 3E: SRL (HL)
-{ "SRL (HL)", &__srl___HL___, 0, 16 },
+{ "SRL (HL)", 2, 16, 0, 0 },
 // 3F: SRL A
-{ "SRL A", &__srl__A__, 0, 8 },
+{ "SRL A", 2, 8, 0, 1 },
 // 40: BIT B,0
-{ "BIT B,0", &__bit__B_0__, 0, 8 },
+{ "BIT B,0", 2, 8, 0, 1 },
 // 41: BIT C,0
-{ "BIT C,0", &__bit__C_0__, 0, 8 },
+{ "BIT C,0", 2, 8, 0, 1 },
 // 42: BIT D,0
-{ "BIT D,0", &__bit__D_0__, 0, 8 },
+{ "BIT D,0", 2, 8, 0, 1 },
 // 43: BIT E,0
-{ "BIT E,0", &__bit__E_0__, 0, 8 },
+{ "BIT E,0", 2, 8, 0, 1 },
 // 44: BIT H,0
-{ "BIT H,0", &__bit__H_0__, 0, 8 },
+{ "BIT H,0", 2, 8, 0, 1 },
 // 45: BIT L,0
-{ "BIT L,0", &__bit__L_0__, 0, 8 },
+{ "BIT L,0", 2, 8, 0, 1 },
 // 46: BIT (HL),0
-{ "BIT (HL),0", &__bit___HL__0__, 0, 12 },
+{ "BIT (HL),0", 2, 12, 0, 1 },
 // 47: BIT A,0
-{ "BIT A,0", &__bit__A_0__, 0, 8 },
+{ "BIT A,0", 2, 8, 0, 1 },
 // 48: BIT B,1
-{ "BIT B,1", &__bit__B_1__, 0, 8 },
+{ "BIT B,1", 2, 8, 0, 1 },
 // 49: BIT C,1
-{ "BIT C,1", &__bit__C_1__, 0, 8 },
+{ "BIT C,1", 2, 8, 0, 1 },
 // 4A: BIT D,1
-{ "BIT D,1", &__bit__D_1__, 0, 8 },
+{ "BIT D,1", 2, 8, 0, 1 },
 // 4B: BIT E,1
-{ "BIT E,1", &__bit__E_1__, 0, 8 },
+{ "BIT E,1", 2, 8, 0, 1 },
 // 4C: BIT H,1
-{ "BIT H,1", &__bit__H_1__, 0, 8 },
+{ "BIT H,1", 2, 8, 0, 1 },
 // 4D: BIT L,1
-{ "BIT L,1", &__bit__L_1__, 0, 8 },
+{ "BIT L,1", 2, 8, 0, 1 },
 // 4E: BIT (HL),1
-{ "BIT (HL),1", &__bit___HL__1__, 0, 12 },
+{ "BIT (HL),1", 2, 12, 0, 1 },
 // 4F: BIT A,1
-{ "BIT A,1", &__bit__A_1__, 0, 8 },
+{ "BIT A,1", 2, 8, 0, 1 },
 // 50: BIT B,2
-{ "BIT B,2", &__bit__B_2__, 0, 8 },
+{ "BIT B,2", 2, 8, 0, 1 },
 // 51: BIT C,2
-{ "BIT C,2", &__bit__C_2__, 0, 8 },
+{ "BIT C,2", 2, 8, 0, 1 },
 // 52: BIT D,2
-{ "BIT D,2", &__bit__D_2__, 0, 8 },
+{ "BIT D,2", 2, 8, 0, 1 },
 // 53: BIT E,2
-{ "BIT E,2", &__bit__E_2__, 0, 8 },
+{ "BIT E,2", 2, 8, 0, 1 },
 // 54: BIT H,2
-{ "BIT H,2", &__bit__H_2__, 0, 8 },
+{ "BIT H,2", 2, 8, 0, 1 },
 // 55: BIT L,2
-{ "BIT L,2", &__bit__L_2__, 0, 8 },
+{ "BIT L,2", 2, 8, 0, 1 },
 // 56: BIT (HL),2
-{ "BIT (HL),2", &__bit___HL__2__, 0, 12 },
+{ "BIT (HL),2", 2, 12, 0, 1 },
 // 57: BIT A,2
-{ "BIT A,2", &__bit__A_2__, 0, 8 },
+{ "BIT A,2", 2, 8, 0, 1 },
 // 58: BIT B,3
-{ "BIT B,3", &__bit__B_3__, 0, 8 },
+{ "BIT B,3", 2, 8, 0, 1 },
 // 59: BIT C,3
-{ "BIT C,3", &__bit__C_3__, 0, 8 },
+{ "BIT C,3", 2, 8, 0, 1 },
 // 5A: BIT D,3
-{ "BIT D,3", &__bit__D_3__, 0, 8 },
+{ "BIT D,3", 2, 8, 0, 1 },
 // 5B: BIT E,3
-{ "BIT E,3", &__bit__E_3__, 0, 8 },
+{ "BIT E,3", 2, 8, 0, 1 },
 // 5C: BIT H,3
-{ "BIT H,3", &__bit__H_3__, 0, 8 },
+{ "BIT H,3", 2, 8, 0, 1 },
 // 5D: BIT L,3
-{ "BIT L,3", &__bit__L_3__, 0, 8 },
+{ "BIT L,3", 2, 8, 0, 1 },
 // 5E: BIT (HL),3
-{ "BIT (HL),3", &__bit___HL__3__, 0, 12 },
+{ "BIT (HL),3", 2, 12, 0, 1 },
 // 5F: BIT A,3
-{ "BIT A,3", &__bit__A_3__, 0, 8 },
+{ "BIT A,3", 2, 8, 0, 1 },
 // 60: BIT B,4
-{ "BIT B,4", &__bit__B_4__, 0, 8 },
+{ "BIT B,4", 2, 8, 0, 1 },
 // 61: BIT C,4
-{ "BIT C,4", &__bit__C_4__, 0, 8 },
+{ "BIT C,4", 2, 8, 0, 1 },
 // 62: BIT D,4
-{ "BIT D,4", &__bit__D_4__, 0, 8 },
+{ "BIT D,4", 2, 8, 0, 1 },
 // 63: BIT E,4
-{ "BIT E,4", &__bit__E_4__, 0, 8 },
+{ "BIT E,4", 2, 8, 0, 1 },
 // 64: BIT H,4
-{ "BIT H,4", &__bit__H_4__, 0, 8 },
+{ "BIT H,4", 2, 8, 0, 1 },
 // 65: BIT L,4
-{ "BIT L,4", &__bit__L_4__, 0, 8 },
+{ "BIT L,4", 2, 8, 0, 1 },
 // 66: BIT (HL),4
-{ "BIT (HL),4", &__bit___HL__4__, 0, 12 },
+{ "BIT (HL),4", 2, 12, 0, 1 },
 // 67: BIT A,4
-{ "BIT A,4", &__bit__A_4__, 0, 8 },
+{ "BIT A,4", 2, 8, 0, 1 },
 // 68: BIT B,5
-{ "BIT B,5", &__bit__B_5__, 0, 8 },
+{ "BIT B,5", 2, 8, 0, 1 },
 // 69: BIT C,5
-{ "BIT C,5", &__bit__C_5__, 0, 8 },
+{ "BIT C,5", 2, 8, 0, 1 },
 // 6A: BIT D,5
-{ "BIT D,5", &__bit__D_5__, 0, 8 },
+{ "BIT D,5", 2, 8, 0, 1 },
 // 6B: BIT E,5
-{ "BIT E,5", &__bit__E_5__, 0, 8 },
+{ "BIT E,5", 2, 8, 0, 1 },
 // 6C: BIT H,5
-{ "BIT H,5", &__bit__H_5__, 0, 8 },
+{ "BIT H,5", 2, 8, 0, 1 },
 // 6D: BIT L,5
-{ "BIT L,5", &__bit__L_5__, 0, 8 },
+{ "BIT L,5", 2, 8, 0, 1 },
 // 6E: BIT (HL),5
-{ "BIT (HL),5", &__bit___HL__5__, 0, 12 },
+{ "BIT (HL),5", 2, 12, 0, 1 },
 // 6F: BIT A,5
-{ "BIT A,5", &__bit__A_5__, 0, 8 },
+{ "BIT A,5", 2, 8, 0, 1 },
 // 70: BIT B,6
-{ "BIT B,6", &__bit__B_6__, 0, 8 },
+{ "BIT B,6", 2, 8, 0, 1 },
 // 71: BIT C,6
-{ "BIT C,6", &__bit__C_6__, 0, 8 },
+{ "BIT C,6", 2, 8, 0, 1 },
 // 72: BIT D,6
-{ "BIT D,6", &__bit__D_6__, 0, 8 },
+{ "BIT D,6", 2, 8, 0, 1 },
 // 73: BIT E,6
-{ "BIT E,6", &__bit__E_6__, 0, 8 },
+{ "BIT E,6", 2, 8, 0, 1 },
 // 74: BIT H,6
-{ "BIT H,6", &__bit__H_6__, 0, 8 },
+{ "BIT H,6", 2, 8, 0, 1 },
 // 75: BIT L,6
-{ "BIT L,6", &__bit__L_6__, 0, 8 },
+{ "BIT L,6", 2, 8, 0, 1 },
 // 76: BIT (HL),6
-{ "BIT (HL),6", &__bit___HL__6__, 0, 12 },
+{ "BIT (HL),6", 2, 12, 0, 1 },
 // 77: BIT A,6
-{ "BIT A,6", &__bit__A_6__, 0, 8 },
+{ "BIT A,6", 2, 8, 0, 1 },
 // 78: BIT B,7
-{ "BIT B,7", &__bit__B_7__, 0, 8 },
+{ "BIT B,7", 2, 8, 0, 1 },
 // 79: BIT C,7
-{ "BIT C,7", &__bit__C_7__, 0, 8 },
+{ "BIT C,7", 2, 8, 0, 1 },
 // 7A: BIT D,7
-{ "BIT D,7", &__bit__D_7__, 0, 8 },
+{ "BIT D,7", 2, 8, 0, 1 },
 // 7B: BIT E,7
-{ "BIT E,7", &__bit__E_7__, 0, 8 },
+{ "BIT E,7", 2, 8, 0, 1 },
 // 7C: BIT H,7
-{ "BIT H,7", &__bit__H_7__, 0, 8 },
+{ "BIT H,7", 2, 8, 0, 1 },
 // 7D: BIT L,7
-{ "BIT L,7", &__bit__L_7__, 0, 8 },
+{ "BIT L,7", 2, 8, 0, 1 },
 // 7E: BIT (HL),7
-{ "BIT (HL),7", &__bit___HL__7__, 0, 12 },
+{ "BIT (HL),7", 2, 12, 0, 1 },
 // 7F: BIT A,7
-{ "BIT A,7", &__bit__A_7__, 0, 8 },
+{ "BIT A,7", 2, 8, 0, 1 },
 // 80: RES B,0
-{ "RES B,0", &__res__B_0__, 0, 8 },
+{ "RES B,0", 2, 8, 0, 1 },
 // 81: RES C,0
-{ "RES C,0", &__res__C_0__, 0, 8 },
+{ "RES C,0", 2, 8, 0, 1 },
 // 82: RES D,0
-{ "RES D,0", &__res__D_0__, 0, 8 },
+{ "RES D,0", 2, 8, 0, 1 },
 // 83: RES E,0
-{ "RES E,0", &__res__E_0__, 0, 8 },
+{ "RES E,0", 2, 8, 0, 1 },
 // 84: RES H,0
-{ "RES H,0", &__res__H_0__, 0, 8 },
+{ "RES H,0", 2, 8, 0, 1 },
 // 85: RES L,0
-{ "RES L,0", &__res__L_0__, 0, 8 },
+{ "RES L,0", 2, 8, 0, 1 },
 // 86: RES (HL),0
-{ "RES (HL),0", &__res___HL__0__, 0, 16 },
+{ "RES (HL),0", 2, 16, 0, 0 },
 // 87: RES A,0
-{ "RES A,0", &__res__A_0__, 0, 8 },
+{ "RES A,0", 2, 8, 0, 1 },
 // 88: RES B,1
-{ "RES B,1", &__res__B_1__, 0, 8 },
+{ "RES B,1", 2, 8, 0, 1 },
 // 89: RES C,1
-{ "RES C,1", &__res__C_1__, 0, 8 },
+{ "RES C,1", 2, 8, 0, 1 },
 // 8A: RES D,1
-{ "RES D,1", &__res__D_1__, 0, 8 },
+{ "RES D,1", 2, 8, 0, 1 },
 // 8B: RES E,1
-{ "RES E,1", &__res__E_1__, 0, 8 },
+{ "RES E,1", 2, 8, 0, 1 },
 // 8C: RES H,1
-{ "RES H,1", &__res__H_1__, 0, 8 },
+{ "RES H,1", 2, 8, 0, 1 },
 // 8D: RES L,1
-{ "RES L,1", &__res__L_1__, 0, 8 },
+{ "RES L,1", 2, 8, 0, 1 },
 // 8E: RES (HL),1
-{ "RES (HL),1", &__res___HL__1__, 0, 16 },
+{ "RES (HL),1", 2, 16, 0, 0 },
 // 8F: RES A,1
-{ "RES A,1", &__res__A_1__, 0, 8 },
+{ "RES A,1", 2, 8, 0, 1 },
 // 90: RES B,2
-{ "RES B,2", &__res__B_2__, 0, 8 },
+{ "RES B,2", 2, 8, 0, 1 },
 // 91: RES C,2
-{ "RES C,2", &__res__C_2__, 0, 8 },
+{ "RES C,2", 2, 8, 0, 1 },
 // 92: RES D,2
-{ "RES D,2", &__res__D_2__, 0, 8 },
+{ "RES D,2", 2, 8, 0, 1 },
 // 93: RES E,2
-{ "RES E,2", &__res__E_2__, 0, 8 },
+{ "RES E,2", 2, 8, 0, 1 },
 // 94: RES H,2
-{ "RES H,2", &__res__H_2__, 0, 8 },
+{ "RES H,2", 2, 8, 0, 1 },
 // 95: RES L,2
-{ "RES L,2", &__res__L_2__, 0, 8 },
+{ "RES L,2", 2, 8, 0, 1 },
 // 96: RES (HL),2
-{ "RES (HL),2", &__res___HL__2__, 0, 16 },
+{ "RES (HL),2", 2, 16, 0, 0 },
 // 97: RES A,2
-{ "RES A,2", &__res__A_2__, 0, 8 },
+{ "RES A,2", 2, 8, 0, 1 },
 // 98: RES B,3
-{ "RES B,3", &__res__B_3__, 0, 8 },
+{ "RES B,3", 2, 8, 0, 1 },
 // 99: RES C,3
-{ "RES C,3", &__res__C_3__, 0, 8 },
+{ "RES C,3", 2, 8, 0, 1 },
 // 9A: RES D,3
-{ "RES D,3", &__res__D_3__, 0, 8 },
+{ "RES D,3", 2, 8, 0, 1 },
 // 9B: RES E,3
-{ "RES E,3", &__res__E_3__, 0, 8 },
+{ "RES E,3", 2, 8, 0, 1 },
 // 9C: RES H,3
-{ "RES H,3", &__res__H_3__, 0, 8 },
+{ "RES H,3", 2, 8, 0, 1 },
 // 9D: RES L,3
-{ "RES L,3", &__res__L_3__, 0, 8 },
+{ "RES L,3", 2, 8, 0, 1 },
 // 9E: RES (HL),3
-{ "RES (HL),3", &__res___HL__3__, 0, 16 },
+{ "RES (HL),3", 2, 16, 0, 0 },
 // 9F: RES A,3
-{ "RES A,3", &__res__A_3__, 0, 8 },
+{ "RES A,3", 2, 8, 0, 1 },
 // A0: RES B,4
-{ "RES B,4", &__res__B_4__, 0, 8 },
+{ "RES B,4", 2, 8, 0, 1 },
 // A1: RES C,4
-{ "RES C,4", &__res__C_4__, 0, 8 },
+{ "RES C,4", 2, 8, 0, 1 },
 // A2: RES D,4
-{ "RES D,4", &__res__D_4__, 0, 8 },
+{ "RES D,4", 2, 8, 0, 1 },
 // A3: RES E,4
-{ "RES E,4", &__res__E_4__, 0, 8 },
+{ "RES E,4", 2, 8, 0, 1 },
 // A4: RES H,4
-{ "RES H,4", &__res__H_4__, 0, 8 },
+{ "RES H,4", 2, 8, 0, 1 },
 // A5: RES L,4
-{ "RES L,4", &__res__L_4__, 0, 8 },
+{ "RES L,4", 2, 8, 0, 1 },
 // A6: RES (HL),4
-{ "RES (HL),4", &__res___HL__4__, 0, 16 },
+{ "RES (HL),4", 2, 16, 0, 0 },
 // A7: RES A,4
-{ "RES A,4", &__res__A_4__, 0, 8 },
+{ "RES A,4", 2, 8, 0, 1 },
 // A8: RES B,5
-{ "RES B,5", &__res__B_5__, 0, 8 },
+{ "RES B,5", 2, 8, 0, 1 },
 // A9: RES C,5
-{ "RES C,5", &__res__C_5__, 0, 8 },
+{ "RES C,5", 2, 8, 0, 1 },
 // AA: RES D,5
-{ "RES D,5", &__res__D_5__, 0, 8 },
+{ "RES D,5", 2, 8, 0, 1 },
 // AB: RES E,5
-{ "RES E,5", &__res__E_5__, 0, 8 },
+{ "RES E,5", 2, 8, 0, 1 },
 // AC: RES H,5
-{ "RES H,5", &__res__H_5__, 0, 8 },
+{ "RES H,5", 2, 8, 0, 1 },
 // AD: RES L,5
-{ "RES L,5", &__res__L_5__, 0, 8 },
+{ "RES L,5", 2, 8, 0, 1 },
 // AE: RES (HL),5
-{ "RES (HL),5", &__res___HL__5__, 0, 16 },
+{ "RES (HL),5", 2, 16, 0, 0 },
 // AF: RES A,5
-{ "RES A,5", &__res__A_5__, 0, 8 },
+{ "RES A,5", 2, 8, 0, 1 },
 // B0: RES B,6
-{ "RES B,6", &__res__B_6__, 0, 8 },
+{ "RES B,6", 2, 8, 0, 1 },
 // B1: RES C,6
-{ "RES C,6", &__res__C_6__, 0, 8 },
+{ "RES C,6", 2, 8, 0, 1 },
 // B2: RES D,6
-{ "RES D,6", &__res__D_6__, 0, 8 },
+{ "RES D,6", 2, 8, 0, 1 },
 // B3: RES E,6
-{ "RES E,6", &__res__E_6__, 0, 8 },
+{ "RES E,6", 2, 8, 0, 1 },
 // B4: RES H,6
-{ "RES H,6", &__res__H_6__, 0, 8 },
+{ "RES H,6", 2, 8, 0, 1 },
 // B5: RES L,6
-{ "RES L,6", &__res__L_6__, 0, 8 },
+{ "RES L,6", 2, 8, 0, 1 },
 // B6: RES (HL),6
-{ "RES (HL),6", &__res___HL__6__, 0, 16 },
+{ "RES (HL),6", 2, 16, 0, 0 },
 // B7: RES A,6
-{ "RES A,6", &__res__A_6__, 0, 8 },
+{ "RES A,6", 2, 8, 0, 1 },
 // B8: RES B,7
-{ "RES B,7", &__res__B_7__, 0, 8 },
+{ "RES B,7", 2, 8, 0, 1 },
 // B9: RES C,7
-{ "RES C,7", &__res__C_7__, 0, 8 },
+{ "RES C,7", 2, 8, 0, 1 },
 // BA: RES D,7
-{ "RES D,7", &__res__D_7__, 0, 8 },
+{ "RES D,7", 2, 8, 0, 1 },
 // BB: RES E,7
-{ "RES E,7", &__res__E_7__, 0, 8 },
+{ "RES E,7", 2, 8, 0, 1 },
 // BC: RES H,7
-{ "RES H,7", &__res__H_7__, 0, 8 },
+{ "RES H,7", 2, 8, 0, 1 },
 // BD: RES L,7
-{ "RES L,7", &__res__L_7__, 0, 8 },
+{ "RES L,7", 2, 8, 0, 1 },
 // BE: RES (HL),7
-{ "RES (HL),7", &__res___HL__7__, 0, 16 },
+{ "RES (HL),7", 2, 16, 0, 0 },
 // BF: RES A,7
-{ "RES A,7", &__res__A_7__, 0, 8 },
+{ "RES A,7", 2, 8, 0, 1 },
 // C0: SET B,0
-{ "SET B,0", &__set__B_0__, 0, 8 },
+{ "SET B,0", 2, 8, 0, 1 },
 // C1: SET C,0
-{ "SET C,0", &__set__C_0__, 0, 8 },
+{ "SET C,0", 2, 8, 0, 1 },
 // C2: SET D,0
-{ "SET D,0", &__set__D_0__, 0, 8 },
+{ "SET D,0", 2, 8, 0, 1 },
 // C3: SET E,0
-{ "SET E,0", &__set__E_0__, 0, 8 },
+{ "SET E,0", 2, 8, 0, 1 },
 // C4: SET H,0
-{ "SET H,0", &__set__H_0__, 0, 8 },
+{ "SET H,0", 2, 8, 0, 1 },
 // C5: SET L,0
-{ "SET L,0", &__set__L_0__, 0, 8 },
+{ "SET L,0", 2, 8, 0, 1 },
 // C6: SET (HL),0
-{ "SET (HL),0", &__set___HL__0__, 0, 16 },
+{ "SET (HL),0", 2, 16, 0, 0 },
 // C7: SET A,0
-{ "SET A,0", &__set__A_0__, 0, 8 },
+{ "SET A,0", 2, 8, 0, 1 },
 // C8: SET B,1
-{ "SET B,1", &__set__B_1__, 0, 8 },
+{ "SET B,1", 2, 8, 0, 1 },
 // C9: SET C,1
-{ "SET C,1", &__set__C_1__, 0, 8 },
+{ "SET C,1", 2, 8, 0, 1 },
 // CA: SET D,1
-{ "SET D,1", &__set__D_1__, 0, 8 },
+{ "SET D,1", 2, 8, 0, 1 },
 // CB: SET E,1
-{ "SET E,1", &__set__E_1__, 0, 8 },
+{ "SET E,1", 2, 8, 0, 1 },
 // CC: SET H,1
-{ "SET H,1", &__set__H_1__, 0, 8 },
+{ "SET H,1", 2, 8, 0, 1 },
 // CD: SET L,1
-{ "SET L,1", &__set__L_1__, 0, 8 },
+{ "SET L,1", 2, 8, 0, 1 },
 // CE: SET (HL),1
-{ "SET (HL),1", &__set___HL__1__, 0, 16 },
+{ "SET (HL),1", 2, 16, 0, 0 },
 // CF: SET A,1
-{ "SET A,1", &__set__A_1__, 0, 8 },
+{ "SET A,1", 2, 8, 0, 1 },
 // D0: SET B,2
-{ "SET B,2", &__set__B_2__, 0, 8 },
+{ "SET B,2", 2, 8, 0, 1 },
 // D1: SET C,2
-{ "SET C,2", &__set__C_2__, 0, 8 },
+{ "SET C,2", 2, 8, 0, 1 },
 // D2: SET D,2
-{ "SET D,2", &__set__D_2__, 0, 8 },
+{ "SET D,2", 2, 8, 0, 1 },
 // D3: SET E,2
-{ "SET E,2", &__set__E_2__, 0, 8 },
+{ "SET E,2", 2, 8, 0, 1 },
 // D4: SET H,2
-{ "SET H,2", &__set__H_2__, 0, 8 },
+{ "SET H,2", 2, 8, 0, 1 },
 // D5: SET L,2
-{ "SET L,2", &__set__L_2__, 0, 8 },
+{ "SET L,2", 2, 8, 0, 1 },
 // D6: SET (HL),2
-{ "SET (HL),2", &__set___HL__2__, 0, 16 },
+{ "SET (HL),2", 2, 16, 0, 0 },
 // D7: SET A,2
-{ "SET A,2", &__set__A_2__, 0, 8 },
+{ "SET A,2", 2, 8, 0, 1 },
 // D8: SET B,3
-{ "SET B,3", &__set__B_3__, 0, 8 },
+{ "SET B,3", 2, 8, 0, 1 },
 // D9: SET C,3
-{ "SET C,3", &__set__C_3__, 0, 8 },
+{ "SET C,3", 2, 8, 0, 1 },
 // DA: SET D,3
-{ "SET D,3", &__set__D_3__, 0, 8 },
+{ "SET D,3", 2, 8, 0, 1 },
 // DB: SET E,3
-{ "SET E,3", &__set__E_3__, 0, 8 },
+{ "SET E,3", 2, 8, 0, 1 },
 // DC: SET H,3
-{ "SET H,3", &__set__H_3__, 0, 8 },
+{ "SET H,3", 2, 8, 0, 1 },
 // DD: SET L,3
-{ "SET L,3", &__set__L_3__, 0, 8 },
+{ "SET L,3", 2, 8, 0, 1 },
 // DE: SET (HL),3
-{ "SET (HL),3", &__set___HL__3__, 0, 16 },
+{ "SET (HL),3", 2, 16, 0, 0 },
 // DF: SET A,3
-{ "SET A,3", &__set__A_3__, 0, 8 },
+{ "SET A,3", 2, 8, 0, 1 },
 // E0: SET B,4
-{ "SET B,4", &__set__B_4__, 0, 8 },
+{ "SET B,4", 2, 8, 0, 1 },
 // E1: SET C,4
-{ "SET C,4", &__set__C_4__, 0, 8 },
+{ "SET C,4", 2, 8, 0, 1 },
 // E2: SET D,4
-{ "SET D,4", &__set__D_4__, 0, 8 },
+{ "SET D,4", 2, 8, 0, 1 },
 // E3: SET E,4
-{ "SET E,4", &__set__E_4__, 0, 8 },
+{ "SET E,4", 2, 8, 0, 1 },
 // E4: SET H,4
-{ "SET H,4", &__set__H_4__, 0, 8 },
+{ "SET H,4", 2, 8, 0, 1 },
 // E5: SET L,4
-{ "SET L,4", &__set__L_4__, 0, 8 },
+{ "SET L,4", 2, 8, 0, 1 },
 // E6: SET (HL),4
-{ "SET (HL),4", &__set___HL__4__, 0, 16 },
+{ "SET (HL),4", 2, 16, 0, 0 },
 // E7: SET A,4
-{ "SET A,4", &__set__A_4__, 0, 8 },
+{ "SET A,4", 2, 8, 0, 1 },
 // E8: SET B,5
-{ "SET B,5", &__set__B_5__, 0, 8 },
+{ "SET B,5", 2, 8, 0, 1 },
 // E9: SET C,5
-{ "SET C,5", &__set__C_5__, 0, 8 },
+{ "SET C,5", 2, 8, 0, 1 },
 // EA: SET D,5
-{ "SET D,5", &__set__D_5__, 0, 8 },
+{ "SET D,5", 2, 8, 0, 1 },
 // EB: SET E,5
-{ "SET E,5", &__set__E_5__, 0, 8 },
+{ "SET E,5", 2, 8, 0, 1 },
 // EC: SET H,5
-{ "SET H,5", &__set__H_5__, 0, 8 },
+{ "SET H,5", 2, 8, 0, 1 },
 // ED: SET L,5
-{ "SET L,5", &__set__L_5__, 0, 8 },
+{ "SET L,5", 2, 8, 0, 1 },
 // EE: SET (HL),5
-{ "SET (HL),5", &__set___HL__5__, 0, 16 },
+{ "SET (HL),5", 2, 16, 0, 0 },
 // EF: SET A,5
-{ "SET A,5", &__set__A_5__, 0, 8 },
+{ "SET A,5", 2, 8, 0, 1 },
 // F0: SET B,6
-{ "SET B,6", &__set__B_6__, 0, 8 },
+{ "SET B,6", 2, 8, 0, 1 },
 // F1: SET C,6
-{ "SET C,6", &__set__C_6__, 0, 8 },
+{ "SET C,6", 2, 8, 0, 1 },
 // F2: SET D,6
-{ "SET D,6", &__set__D_6__, 0, 8 },
+{ "SET D,6", 2, 8, 0, 1 },
 // F3: SET E,6
-{ "SET E,6", &__set__E_6__, 0, 8 },
+{ "SET E,6", 2, 8, 0, 1 },
 // F4: SET H,6
-{ "SET H,6", &__set__H_6__, 0, 8 },
+{ "SET H,6", 2, 8, 0, 1 },
 // F5: SET L,6
-{ "SET L,6", &__set__L_6__, 0, 8 },
+{ "SET L,6", 2, 8, 0, 1 },
 // F6: SET (HL),6
-{ "SET (HL),6", &__set___HL__6__, 0, 16 },
+{ "SET (HL),6", 2, 16, 0, 0 },
 // F7: SET A,6
-{ "SET A,6", &__set__A_6__, 0, 8 },
+{ "SET A,6", 2, 8, 0, 1 },
 // F8: SET B,7
-{ "SET B,7", &__set__B_7__, 0, 8 },
+{ "SET B,7", 2, 8, 0, 1 },
 // F9: SET C,7
-{ "SET C,7", &__set__C_7__, 0, 8 },
+{ "SET C,7", 2, 8, 0, 1 },
 // FA: SET D,7
-{ "SET D,7", &__set__D_7__, 0, 8 },
+{ "SET D,7", 2, 8, 0, 1 },
 // FB: SET E,7
-{ "SET E,7", &__set__E_7__, 0, 8 },
+{ "SET E,7", 2, 8, 0, 1 },
 // FC: SET H,7
-{ "SET H,7", &__set__H_7__, 0, 8 },
+{ "SET H,7", 2, 8, 0, 1 },
 // FD: SET L,7
-{ "SET L,7", &__set__L_7__, 0, 8 },
+{ "SET L,7", 2, 8, 0, 1 },
 // FE: SET (HL),7
-{ "SET (HL),7", &__set___HL__7__, 0, 16 },
+{ "SET (HL),7", 2, 16, 0, 0 },
 // FF: SET A,7
-{ "SET A,7", &__set__A_7__, 0, 8 },
+{ "SET A,7", 2, 8, 0, 1 },
 };
-int __cbxx__() { uint8_t op = RAM (pc ++); return operations_cb[op].instruction(); }
 
 const operation operations[256] = {
 // 00: NOP -/-
-{ "NOP -/-", &__nop__, 0, 4 },
+{ "NOP -/-", 1, 4, 0, 1 },
 // 01: LD BC,nn
-{ "LD BC,nn", &__ld__BC_nn__, 0, 12 },
+{ "LD BC,nn", 3, 12, 0, 1 },
 // 02: LD (BC),A
-{ "LD (BC),A", &__ld___BC__A__, 0, 8 },
+{ "LD (BC),A", 1, 8, 0, 0 },
 // 03: INC16 BC
-{ "INC16 BC", &__inc16__BC__, 0, 8 },
+{ "INC16 BC", 1, 8, 0, 1 },
 // 04: INC B
-{ "INC B", &__inc__B__, 0, 4 },
+{ "INC B", 1, 4, 0, 1 },
 // 05: DEC B
-{ "DEC B", &__dec__B__, 0, 4 },
+{ "DEC B", 1, 4, 0, 1 },
 // 06: LD B,n
-{ "LD B,n", &__ld__B_n__, 0, 8 },
+{ "LD B,n", 2, 8, 0, 1 },
 // 07: RLCA -/-
-{ "RLCA -/-", &__rlca__, 0, 4 },
+{ "RLCA -/-", 1, 4, 0, 1 },
 // 08: LD (nn),SP
-{ "LD (nn),SP", &__ld___nn__SP__, 0, 20 },
+{ "LD (nn),SP", 3, 20, 0, 0 },
 // 09: ADDHL BC
-{ "ADDHL BC", &__addhl__BC__, 0, 8 },
+{ "ADDHL BC", 1, 8, 0, 1 },
 // 0A: LD A,(BC)
-{ "LD A,(BC)", &__ld__A__BC___, 0, 8 },
+{ "LD A,(BC)", 1, 8, 0, 1 },
 // 0B: DEC16 BC
-{ "DEC16 BC", &__dec16__BC__, 0, 8 },
+{ "DEC16 BC", 1, 8, 0, 1 },
 // 0C: INC C
-{ "INC C", &__inc__C__, 0, 4 },
+{ "INC C", 1, 4, 0, 1 },
 // 0D: DEC C
-{ "DEC C", &__dec__C__, 0, 4 },
+{ "DEC C", 1, 4, 0, 1 },
 // 0E: LD C,n
-{ "LD C,n", &__ld__C_n__, 0, 8 },
+{ "LD C,n", 2, 8, 0, 1 },
 // 0F: RRCA -/-
-{ "RRCA -/-", &__rrca__, 0, 4 },
+{ "RRCA -/-", 1, 4, 0, 1 },
 // 10: STOP -/-
-{ "STOP -/-", &__stop__, 0, 4 },
+{ "STOP -/-", 1, 4, 1, 0 },
 // 11: LD DE,nn
-{ "LD DE,nn", &__ld__DE_nn__, 0, 12 },
+{ "LD DE,nn", 3, 12, 0, 1 },
 // 12: LD (DE),A
-{ "LD (DE),A", &__ld___DE__A__, 0, 8 },
+{ "LD (DE),A", 1, 8, 0, 0 },
 // 13: INC16 DE
-{ "INC16 DE", &__inc16__DE__, 0, 8 },
+{ "INC16 DE", 1, 8, 0, 1 },
 // 14: INC D
-{ "INC D", &__inc__D__, 0, 4 },
+{ "INC D", 1, 4, 0, 1 },
 // 15: DEC D
-{ "DEC D", &__dec__D__, 0, 4 },
+{ "DEC D", 1, 4, 0, 1 },
 // 16: LD D,n
-{ "LD D,n", &__ld__D_n__, 0, 8 },
+{ "LD D,n", 2, 8, 0, 1 },
 // 17: RLA -/-
-{ "RLA -/-", &__rla__, 0, 4 },
+{ "RLA -/-", 1, 4, 0, 1 },
 // 18: JR n
-{ "JR n", &__jr__n__, 0, 12 },
+{ "JR n", 2, 12, 1, 1 },
 // 19: ADDHL DE
-{ "ADDHL DE", &__addhl__DE__, 0, 8 },
+{ "ADDHL DE", 1, 8, 0, 1 },
 // 1A: LD A,(DE)
-{ "LD A,(DE)", &__ld__A__DE___, 0, 8 },
+{ "LD A,(DE)", 1, 8, 0, 1 },
 // 1B: DEC16 DE
-{ "DEC16 DE", &__dec16__DE__, 0, 8 },
+{ "DEC16 DE", 1, 8, 0, 1 },
 // 1C: INC E
-{ "INC E", &__inc__E__, 0, 4 },
+{ "INC E", 1, 4, 0, 1 },
 // 1D: DEC E
-{ "DEC E", &__dec__E__, 0, 4 },
+{ "DEC E", 1, 4, 0, 1 },
 // 1E: LD E,n
-{ "LD E,n", &__ld__E_n__, 0, 8 },
+{ "LD E,n", 2, 8, 0, 1 },
 // 1F: RRA -/-
-{ "RRA -/-", &__rra__, 0, 4 },
+{ "RRA -/-", 1, 4, 0, 1 },
 // 20: JRCC JP_CC_NZ,n
-{ "JRCC JP_CC_NZ,n", &__jrcc__JP_CC_NZ_n__, 0, 8 },
+{ "JRCC JP_CC_NZ,n", 2, 8, 1, 1 },
 // 21: LD HL,nn
-{ "LD HL,nn", &__ld__HL_nn__, 0, 12 },
+{ "LD HL,nn", 3, 12, 0, 1 },
 // 22: LDI (HL),A
-{ "LDI (HL),A", &__ldi___HL__A__, 0, 8 },
+{ "LDI (HL),A", 1, 8, 0, 0 },
 // 23: INC16 HL
-{ "INC16 HL", &__inc16__HL__, 0, 8 },
+{ "INC16 HL", 1, 8, 0, 1 },
 // 24: INC H
-{ "INC H", &__inc__H__, 0, 4 },
+{ "INC H", 1, 4, 0, 1 },
 // 25: DEC H
-{ "DEC H", &__dec__H__, 0, 4 },
+{ "DEC H", 1, 4, 0, 1 },
 // 26: LD H,n
-{ "LD H,n", &__ld__H_n__, 0, 8 },
+{ "LD H,n", 2, 8, 0, 1 },
 // 27: DAA -/-
-{ "DAA -/-", &__daa__, 0, 4 },
+{ "DAA -/-", 1, 4, 0, 1 },
 // 28: JRCC JP_CC_Z,n
-{ "JRCC JP_CC_Z,n", &__jrcc__JP_CC_Z_n__, 0, 8 },
+{ "JRCC JP_CC_Z,n", 2, 8, 1, 1 },
 // 29: ADDHL HL
-{ "ADDHL HL", &__addhl__HL__, 0, 8 },
+{ "ADDHL HL", 1, 8, 0, 1 },
 // 2A: LDI A,(HL)
-{ "LDI A,(HL)", &__ldi__A__HL___, 0, 8 },
+{ "LDI A,(HL)", 1, 8, 0, 1 },
 // 2B: DEC16 HL
-{ "DEC16 HL", &__dec16__HL__, 0, 8 },
+{ "DEC16 HL", 1, 8, 0, 1 },
 // 2C: INC L
-{ "INC L", &__inc__L__, 0, 4 },
+{ "INC L", 1, 4, 0, 1 },
 // 2D: DEC L
-{ "DEC L", &__dec__L__, 0, 4 },
+{ "DEC L", 1, 4, 0, 1 },
 // 2E: LD L,n
-{ "LD L,n", &__ld__L_n__, 0, 8 },
+{ "LD L,n", 2, 8, 0, 1 },
 // 2F: CPL -/-
-{ "CPL -/-", &__cpl__, 0, 4 },
+{ "CPL -/-", 1, 4, 0, 1 },
 // 30: JRCC JP_CC_NC,n
-{ "JRCC JP_CC_NC,n", &__jrcc__JP_CC_NC_n__, 0, 8 },
+{ "JRCC JP_CC_NC,n", 2, 8, 1, 1 },
 // 31: LD SP,nn
-{ "LD SP,nn", &__ld__SP_nn__, 0, 12 },
+{ "LD SP,nn", 3, 12, 0, 1 },
 // 32: LDD (HL),A
-{ "LDD (HL),A", &__ldd___HL__A__, 0, 8 },
+{ "LDD (HL),A", 1, 8, 0, 0 },
 // 33: INC16 SP
-{ "INC16 SP", &__inc16__SP__, 0, 8 },
+{ "INC16 SP", 1, 8, 0, 1 },
 // 34: INC (HL)
-{ "INC (HL)", &__inc___HL___, 0, 12 },
+{ "INC (HL)", 1, 12, 0, 0 },
 // 35: DEC (HL)
-{ "DEC (HL)", &__dec___HL___, 0, 12 },
+{ "DEC (HL)", 1, 12, 0, 0 },
 // 36: LD (HL),n
-{ "LD (HL),n", &__ld___HL__n__, 0, 12 },
+{ "LD (HL),n", 2, 12, 0, 0 },
 // 37: SCF -/-
-{ "SCF -/-", &__scf__, 0, 4 },
+{ "SCF -/-", 1, 4, 0, 1 },
 // 38: JRCC JP_CC_C,n
-{ "JRCC JP_CC_C,n", &__jrcc__JP_CC_C_n__, 0, 8 },
+{ "JRCC JP_CC_C,n", 2, 8, 1, 1 },
 // 39: ADDHL SP
-{ "ADDHL SP", &__addhl__SP__, 0, 8 },
+{ "ADDHL SP", 1, 8, 0, 1 },
 // 3A: LDD A,(HL)
-{ "LDD A,(HL)", &__ldd__A__HL___, 0, 8 },
+{ "LDD A,(HL)", 1, 8, 0, 1 },
 // 3B: DEC16 SP
-{ "DEC16 SP", &__dec16__SP__, 0, 8 },
+{ "DEC16 SP", 1, 8, 0, 1 },
 // 3C: INC A
-{ "INC A", &__inc__A__, 0, 4 },
+{ "INC A", 1, 4, 0, 1 },
 // 3D: DEC A
-{ "DEC A", &__dec__A__, 0, 4 },
+{ "DEC A", 1, 4, 0, 1 },
 // 3E: LD A,n
-{ "LD A,n", &__ld__A_n__, 0, 8 },
+{ "LD A,n", 2, 8, 0, 1 },
 // 3F: CCF -/-
-{ "CCF -/-", &__ccf__, 0, 4 },
+{ "CCF -/-", 1, 4, 0, 1 },
 // 40: LD B,B
-{ "LD B,B", &__ld__B_B__, 0, 4 },
+{ "LD B,B", 1, 4, 0, 1 },
 // 41: LD B,C
-{ "LD B,C", &__ld__B_C__, 0, 4 },
+{ "LD B,C", 1, 4, 0, 1 },
 // 42: LD B,D
-{ "LD B,D", &__ld__B_D__, 0, 4 },
+{ "LD B,D", 1, 4, 0, 1 },
 // 43: LD B,E
-{ "LD B,E", &__ld__B_E__, 0, 4 },
+{ "LD B,E", 1, 4, 0, 1 },
 // 44: LD B,H
-{ "LD B,H", &__ld__B_H__, 0, 4 },
+{ "LD B,H", 1, 4, 0, 1 },
 // 45: LD B,L
-{ "LD B,L", &__ld__B_L__, 0, 4 },
+{ "LD B,L", 1, 4, 0, 1 },
 // 46: LD B,(HL)
-{ "LD B,(HL)", &__ld__B__HL___, 0, 8 },
+{ "LD B,(HL)", 1, 8, 0, 1 },
 // 47: LD B,A
-{ "LD B,A", &__ld__B_A__, 0, 4 },
+{ "LD B,A", 1, 4, 0, 1 },
 // 48: LD C,B
-{ "LD C,B", &__ld__C_B__, 0, 4 },
+{ "LD C,B", 1, 4, 0, 1 },
 // 49: LD C,C
-{ "LD C,C", &__ld__C_C__, 0, 4 },
+{ "LD C,C", 1, 4, 0, 1 },
 // 4A: LD C,D
-{ "LD C,D", &__ld__C_D__, 0, 4 },
+{ "LD C,D", 1, 4, 0, 1 },
 // 4B: LD C,E
-{ "LD C,E", &__ld__C_E__, 0, 4 },
+{ "LD C,E", 1, 4, 0, 1 },
 // 4C: LD C,H
-{ "LD C,H", &__ld__C_H__, 0, 4 },
+{ "LD C,H", 1, 4, 0, 1 },
 // 4D: LD C,L
-{ "LD C,L", &__ld__C_L__, 0, 4 },
+{ "LD C,L", 1, 4, 0, 1 },
 // 4E: LD C,(HL)
-{ "LD C,(HL)", &__ld__C__HL___, 0, 8 },
+{ "LD C,(HL)", 1, 8, 0, 1 },
 // 4F: LD C,A
-{ "LD C,A", &__ld__C_A__, 0, 4 },
+{ "LD C,A", 1, 4, 0, 1 },
 // 50: LD D,B
-{ "LD D,B", &__ld__D_B__, 0, 4 },
+{ "LD D,B", 1, 4, 0, 1 },
 // 51: LD D,C
-{ "LD D,C", &__ld__D_C__, 0, 4 },
+{ "LD D,C", 1, 4, 0, 1 },
 // 52: LD D,D
-{ "LD D,D", &__ld__D_D__, 0, 4 },
+{ "LD D,D", 1, 4, 0, 1 },
 // 53: LD D,E
-{ "LD D,E", &__ld__D_E__, 0, 4 },
+{ "LD D,E", 1, 4, 0, 1 },
 // 54: LD D,H
-{ "LD D,H", &__ld__D_H__, 0, 4 },
+{ "LD D,H", 1, 4, 0, 1 },
 // 55: LD D,L
-{ "LD D,L", &__ld__D_L__, 0, 4 },
+{ "LD D,L", 1, 4, 0, 1 },
 // 56: LD D,(HL)
-{ "LD D,(HL)", &__ld__D__HL___, 0, 8 },
+{ "LD D,(HL)", 1, 8, 0, 1 },
 // 57: LD D,A
-{ "LD D,A", &__ld__D_A__, 0, 4 },
+{ "LD D,A", 1, 4, 0, 1 },
 // 58: LD E,B
-{ "LD E,B", &__ld__E_B__, 0, 4 },
+{ "LD E,B", 1, 4, 0, 1 },
 // 59: LD E,C
-{ "LD E,C", &__ld__E_C__, 0, 4 },
+{ "LD E,C", 1, 4, 0, 1 },
 // 5A: LD E,D
-{ "LD E,D", &__ld__E_D__, 0, 4 },
+{ "LD E,D", 1, 4, 0, 1 },
 // 5B: LD E,E
-{ "LD E,E", &__ld__E_E__, 0, 4 },
+{ "LD E,E", 1, 4, 0, 1 },
 // 5C: LD E,H
-{ "LD E,H", &__ld__E_H__, 0, 4 },
+{ "LD E,H", 1, 4, 0, 1 },
 // 5D: LD E,L
-{ "LD E,L", &__ld__E_L__, 0, 4 },
+{ "LD E,L", 1, 4, 0, 1 },
 // 5E: LD E,(HL)
-{ "LD E,(HL)", &__ld__E__HL___, 0, 8 },
+{ "LD E,(HL)", 1, 8, 0, 1 },
 // 5F: LD E,A
-{ "LD E,A", &__ld__E_A__, 0, 4 },
+{ "LD E,A", 1, 4, 0, 1 },
 // 60: LD H,B
-{ "LD H,B", &__ld__H_B__, 0, 4 },
+{ "LD H,B", 1, 4, 0, 1 },
 // 61: LD H,C
-{ "LD H,C", &__ld__H_C__, 0, 4 },
+{ "LD H,C", 1, 4, 0, 1 },
 // 62: LD H,D
-{ "LD H,D", &__ld__H_D__, 0, 4 },
+{ "LD H,D", 1, 4, 0, 1 },
 // 63: LD H,E
-{ "LD H,E", &__ld__H_E__, 0, 4 },
+{ "LD H,E", 1, 4, 0, 1 },
 // 64: LD H,H
-{ "LD H,H", &__ld__H_H__, 0, 4 },
+{ "LD H,H", 1, 4, 0, 1 },
 // 65: LD H,L
-{ "LD H,L", &__ld__H_L__, 0, 4 },
+{ "LD H,L", 1, 4, 0, 1 },
 // 66: LD H,(HL)
-{ "LD H,(HL)", &__ld__H__HL___, 0, 8 },
+{ "LD H,(HL)", 1, 8, 0, 1 },
 // 67: LD H,A
-{ "LD H,A", &__ld__H_A__, 0, 4 },
+{ "LD H,A", 1, 4, 0, 1 },
 // 68: LD L,B
-{ "LD L,B", &__ld__L_B__, 0, 4 },
+{ "LD L,B", 1, 4, 0, 1 },
 // 69: LD L,C
-{ "LD L,C", &__ld__L_C__, 0, 4 },
+{ "LD L,C", 1, 4, 0, 1 },
 // 6A: LD L,D
-{ "LD L,D", &__ld__L_D__, 0, 4 },
+{ "LD L,D", 1, 4, 0, 1 },
 // 6B: LD L,E
-{ "LD L,E", &__ld__L_E__, 0, 4 },
+{ "LD L,E", 1, 4, 0, 1 },
 // 6C: LD L,H
-{ "LD L,H", &__ld__L_H__, 0, 4 },
+{ "LD L,H", 1, 4, 0, 1 },
 // 6D: LD L,L
-{ "LD L,L", &__ld__L_L__, 0, 4 },
+{ "LD L,L", 1, 4, 0, 1 },
 // 6E: LD L,(HL)
-{ "LD L,(HL)", &__ld__L__HL___, 0, 8 },
+{ "LD L,(HL)", 1, 8, 0, 1 },
 // 6F: LD L,A
-{ "LD L,A", &__ld__L_A__, 0, 4 },
+{ "LD L,A", 1, 4, 0, 1 },
 // 70: LD (HL),B
-{ "LD (HL),B", &__ld___HL__B__, 0, 8 },
+{ "LD (HL),B", 1, 8, 0, 0 },
 // 71: LD (HL),C
-{ "LD (HL),C", &__ld___HL__C__, 0, 8 },
+{ "LD (HL),C", 1, 8, 0, 0 },
 // 72: LD (HL),D
-{ "LD (HL),D", &__ld___HL__D__, 0, 8 },
+{ "LD (HL),D", 1, 8, 0, 0 },
 // 73: LD (HL),E
-{ "LD (HL),E", &__ld___HL__E__, 0, 8 },
+{ "LD (HL),E", 1, 8, 0, 0 },
 // 74: LD (HL),H
-{ "LD (HL),H", &__ld___HL__H__, 0, 8 },
+{ "LD (HL),H", 1, 8, 0, 0 },
 // 75: LD (HL),L
-{ "LD (HL),L", &__ld___HL__L__, 0, 8 },
+{ "LD (HL),L", 1, 8, 0, 0 },
 // 76: HALT -/-
-{ "HALT -/-", &__halt__, 0, 4 },
+{ "HALT -/-", 1, 4, 1, 0 },
 // 77: LD (HL),A
-{ "LD (HL),A", &__ld___HL__A__, 0, 8 },
+{ "LD (HL),A", 1, 8, 0, 0 },
 // 78: LD A,B
-{ "LD A,B", &__ld__A_B__, 0, 4 },
+{ "LD A,B", 1, 4, 0, 1 },
 // 79: LD A,C
-{ "LD A,C", &__ld__A_C__, 0, 4 },
+{ "LD A,C", 1, 4, 0, 1 },
 // 7A: LD A,D
-{ "LD A,D", &__ld__A_D__, 0, 4 },
+{ "LD A,D", 1, 4, 0, 1 },
 // 7B: LD A,E
-{ "LD A,E", &__ld__A_E__, 0, 4 },
+{ "LD A,E", 1, 4, 0, 1 },
 // 7C: LD A,H
-{ "LD A,H", &__ld__A_H__, 0, 4 },
+{ "LD A,H", 1, 4, 0, 1 },
 // 7D: LD A,L
-{ "LD A,L", &__ld__A_L__, 0, 4 },
+{ "LD A,L", 1, 4, 0, 1 },
 // 7E: LD A,(HL)
-{ "LD A,(HL)", &__ld__A__HL___, 0, 8 },
+{ "LD A,(HL)", 1, 8, 0, 1 },
 // 7F: LD A,A
-{ "LD A,A", &__ld__A_A__, 0, 4 },
+{ "LD A,A", 1, 4, 0, 1 },
 // 80: ADD B
-{ "ADD B", &__add__B__, 0, 4 },
+{ "ADD B", 1, 4, 0, 1 },
 // 81: ADD C
-{ "ADD C", &__add__C__, 0, 4 },
+{ "ADD C", 1, 4, 0, 1 },
 // 82: ADD D
-{ "ADD D", &__add__D__, 0, 4 },
+{ "ADD D", 1, 4, 0, 1 },
 // 83: ADD E
-{ "ADD E", &__add__E__, 0, 4 },
+{ "ADD E", 1, 4, 0, 1 },
 // 84: ADD H
-{ "ADD H", &__add__H__, 0, 4 },
+{ "ADD H", 1, 4, 0, 1 },
 // 85: ADD L
-{ "ADD L", &__add__L__, 0, 4 },
+{ "ADD L", 1, 4, 0, 1 },
 // 86: ADD (HL)
-{ "ADD (HL)", &__add___HL___, 0, 8 },
+{ "ADD (HL)", 1, 8, 0, 1 },
 // 87: ADD A
-{ "ADD A", &__add__A__, 0, 4 },
+{ "ADD A", 1, 4, 0, 1 },
 // 88: ADC B
-{ "ADC B", &__adc__B__, 0, 4 },
+{ "ADC B", 1, 4, 0, 1 },
 // 89: ADC C
-{ "ADC C", &__adc__C__, 0, 4 },
+{ "ADC C", 1, 4, 0, 1 },
 // 8A: ADC D
-{ "ADC D", &__adc__D__, 0, 4 },
+{ "ADC D", 1, 4, 0, 1 },
 // 8B: ADC E
-{ "ADC E", &__adc__E__, 0, 4 },
+{ "ADC E", 1, 4, 0, 1 },
 // 8C: ADC H
-{ "ADC H", &__adc__H__, 0, 4 },
+{ "ADC H", 1, 4, 0, 1 },
 // 8D: ADC L
-{ "ADC L", &__adc__L__, 0, 4 },
+{ "ADC L", 1, 4, 0, 1 },
 // 8E: ADC (HL)
-{ "ADC (HL)", &__adc___HL___, 0, 8 },
+{ "ADC (HL)", 1, 8, 0, 1 },
 // 8F: ADC A
-{ "ADC A", &__adc__A__, 0, 4 },
+{ "ADC A", 1, 4, 0, 1 },
 // 90: SUB B
-{ "SUB B", &__sub__B__, 0, 4 },
+{ "SUB B", 1, 4, 0, 1 },
 // 91: SUB C
-{ "SUB C", &__sub__C__, 0, 4 },
+{ "SUB C", 1, 4, 0, 1 },
 // 92: SUB D
-{ "SUB D", &__sub__D__, 0, 4 },
+{ "SUB D", 1, 4, 0, 1 },
 // 93: SUB E
-{ "SUB E", &__sub__E__, 0, 4 },
+{ "SUB E", 1, 4, 0, 1 },
 // 94: SUB H
-{ "SUB H", &__sub__H__, 0, 4 },
+{ "SUB H", 1, 4, 0, 1 },
 // 95: SUB L
-{ "SUB L", &__sub__L__, 0, 4 },
+{ "SUB L", 1, 4, 0, 1 },
 // 96: SUB (HL)
-{ "SUB (HL)", &__sub___HL___, 0, 8 },
+{ "SUB (HL)", 1, 8, 0, 1 },
 // 97: SUB A
-{ "SUB A", &__sub__A__, 0, 4 },
+{ "SUB A", 1, 4, 0, 1 },
 // 98: SBC B
-{ "SBC B", &__sbc__B__, 0, 4 },
+{ "SBC B", 1, 4, 0, 1 },
 // 99: SBC C
-{ "SBC C", &__sbc__C__, 0, 4 },
+{ "SBC C", 1, 4, 0, 1 },
 // 9A: SBC D
-{ "SBC D", &__sbc__D__, 0, 4 },
+{ "SBC D", 1, 4, 0, 1 },
 // 9B: SBC E
-{ "SBC E", &__sbc__E__, 0, 4 },
+{ "SBC E", 1, 4, 0, 1 },
 // 9C: SBC H
-{ "SBC H", &__sbc__H__, 0, 4 },
+{ "SBC H", 1, 4, 0, 1 },
 // 9D: SBC L
-{ "SBC L", &__sbc__L__, 0, 4 },
+{ "SBC L", 1, 4, 0, 1 },
 // 9E: SBC (HL)
-{ "SBC (HL)", &__sbc___HL___, 0, 8 },
+{ "SBC (HL)", 1, 8, 0, 1 },
 // 9F: SBC A
-{ "SBC A", &__sbc__A__, 0, 4 },
+{ "SBC A", 1, 4, 0, 1 },
 // A0: AND B
-{ "AND B", &__and__B__, 0, 4 },
+{ "AND B", 1, 4, 0, 1 },
 // A1: AND C
-{ "AND C", &__and__C__, 0, 4 },
+{ "AND C", 1, 4, 0, 1 },
 // A2: AND D
-{ "AND D", &__and__D__, 0, 4 },
+{ "AND D", 1, 4, 0, 1 },
 // A3: AND E
-{ "AND E", &__and__E__, 0, 4 },
+{ "AND E", 1, 4, 0, 1 },
 // A4: AND H
-{ "AND H", &__and__H__, 0, 4 },
+{ "AND H", 1, 4, 0, 1 },
 // A5: AND L
-{ "AND L", &__and__L__, 0, 4 },
+{ "AND L", 1, 4, 0, 1 },
 // A6: AND (HL)
-{ "AND (HL)", &__and___HL___, 0, 8 },
+{ "AND (HL)", 1, 8, 0, 1 },
 // A7: AND A
-{ "AND A", &__and__A__, 0, 4 },
+{ "AND A", 1, 4, 0, 1 },
 // A8: XOR B
-{ "XOR B", &__xor__B__, 0, 4 },
+{ "XOR B", 1, 4, 0, 1 },
 // A9: XOR C
-{ "XOR C", &__xor__C__, 0, 4 },
+{ "XOR C", 1, 4, 0, 1 },
 // AA: XOR D
-{ "XOR D", &__xor__D__, 0, 4 },
+{ "XOR D", 1, 4, 0, 1 },
 // AB: XOR E
-{ "XOR E", &__xor__E__, 0, 4 },
+{ "XOR E", 1, 4, 0, 1 },
 // AC: XOR H
-{ "XOR H", &__xor__H__, 0, 4 },
+{ "XOR H", 1, 4, 0, 1 },
 // AD: XOR L
-{ "XOR L", &__xor__L__, 0, 4 },
+{ "XOR L", 1, 4, 0, 1 },
 // AE: XOR (HL)
-{ "XOR (HL)", &__xor___HL___, 0, 8 },
+{ "XOR (HL)", 1, 8, 0, 1 },
 // AF: XOR A
-{ "XOR A", &__xor__A__, 0, 4 },
+{ "XOR A", 1, 4, 0, 1 },
 // B0: OR B
-{ "OR B", &__or__B__, 0, 4 },
+{ "OR B", 1, 4, 0, 1 },
 // B1: OR C
-{ "OR C", &__or__C__, 0, 4 },
+{ "OR C", 1, 4, 0, 1 },
 // B2: OR D
-{ "OR D", &__or__D__, 0, 4 },
+{ "OR D", 1, 4, 0, 1 },
 // B3: OR E
-{ "OR E", &__or__E__, 0, 4 },
+{ "OR E", 1, 4, 0, 1 },
 // B4: OR H
-{ "OR H", &__or__H__, 0, 4 },
+{ "OR H", 1, 4, 0, 1 },
 // B5: OR L
-{ "OR L", &__or__L__, 0, 4 },
+{ "OR L", 1, 4, 0, 1 },
 // B6: OR (HL)
-{ "OR (HL)", &__or___HL___, 0, 8 },
+{ "OR (HL)", 1, 8, 0, 1 },
 // B7: OR A
-{ "OR A", &__or__A__, 0, 4 },
+{ "OR A", 1, 4, 0, 1 },
 // B8: CP B
-{ "CP B", &__cp__B__, 0, 4 },
+{ "CP B", 1, 4, 0, 1 },
 // B9: CP C
-{ "CP C", &__cp__C__, 0, 4 },
+{ "CP C", 1, 4, 0, 1 },
 // BA: CP D
-{ "CP D", &__cp__D__, 0, 4 },
+{ "CP D", 1, 4, 0, 1 },
 // BB: CP E
-{ "CP E", &__cp__E__, 0, 4 },
+{ "CP E", 1, 4, 0, 1 },
 // BC: CP H
-{ "CP H", &__cp__H__, 0, 4 },
+{ "CP H", 1, 4, 0, 1 },
 // BD: CP L
-{ "CP L", &__cp__L__, 0, 4 },
+{ "CP L", 1, 4, 0, 1 },
 // BE: CP (HL)
-{ "CP (HL)", &__cp___HL___, 0, 8 },
+{ "CP (HL)", 1, 8, 0, 1 },
 // BF: CP A
-{ "CP A", &__cp__A__, 0, 4 },
+{ "CP A", 1, 4, 0, 1 },
 // C0: RETCC JP_CC_NZ
-{ "RETCC JP_CC_NZ", &__retcc__JP_CC_NZ__, 0, 8 },
+{ "RETCC JP_CC_NZ", 1, 8, 1, 0 },
 // C1: POP BC
-{ "POP BC", &__pop__BC__, 0, 12 },
+{ "POP BC", 1, 12, 0, 0 },
 // C2: JPCC JP_CC_NZ,nn
-{ "JPCC JP_CC_NZ,nn", &__jpcc__JP_CC_NZ_nn__, 0, 12 },
+{ "JPCC JP_CC_NZ,nn", 3, 12, 1, 1 },
 // C3: JP nn
-{ "JP nn", &__jp__nn__, 0, 16 },
+{ "JP nn", 3, 16, 1, 1 },
 // C4: CALLCC JP_CC_NZ,nn
-{ "CALLCC JP_CC_NZ,nn", &__callcc__JP_CC_NZ_nn__, 0, 12 },
+{ "CALLCC JP_CC_NZ,nn", 3, 12, 1, 0 },
 // C5: PUSH BC
-{ "PUSH BC", &__push__BC__, 0, 16 },
+{ "PUSH BC", 1, 16, 0, 0 },
 // C6: ADD n
-{ "ADD n", &__add__n__, 0, 8 },
+{ "ADD n", 2, 8, 0, 1 },
 // C7: RST 0x00
-{ "RST 0x00", &__rst__0x00__, 0, 16 },
+{ "RST 0x00", 1, 16, 1, 0 },
 // C8: RETCC JP_CC_Z
-{ "RETCC JP_CC_Z", &__retcc__JP_CC_Z__, 0, 8 },
+{ "RETCC JP_CC_Z", 1, 8, 1, 0 },
 // C9: RET -/-
-{ "RET -/-", &__ret__, 0, 16 },
+{ "RET -/-", 1, 16, 1, 0 },
 // CA: JPCC JP_CC_Z,nn
-{ "JPCC JP_CC_Z,nn", &__jpcc__JP_CC_Z_nn__, 0, 12 },
+{ "JPCC JP_CC_Z,nn", 3, 12, 1, 1 },
 // CB: -- CBXX --
-{ "-- CBXX --", &__cbxx__, 0, 8 },
+{ "-- CBXX --", 2, 8, 0, 0 },
 // CC: CALLCC JP_CC_Z,nn
-{ "CALLCC JP_CC_Z,nn", &__callcc__JP_CC_Z_nn__, 0, 12 },
+{ "CALLCC JP_CC_Z,nn", 3, 12, 1, 0 },
 // CD: CALL nn
-{ "CALL nn", &__call__nn__, 0, 24 },
+{ "CALL nn", 3, 24, 1, 0 },
 // CE: ADC n
-{ "ADC n", &__adc__n__, 0, 8 },
+{ "ADC n", 2, 8, 0, 1 },
 // CF: RST 0x08
-{ "RST 0x08", &__rst__0x08__, 0, 16 },
+{ "RST 0x08", 1, 16, 1, 0 },
 // D0: RETCC JP_CC_NC
-{ "RETCC JP_CC_NC", &__retcc__JP_CC_NC__, 0, 8 },
+{ "RETCC JP_CC_NC", 1, 8, 1, 0 },
 // D1: POP DE
-{ "POP DE", &__pop__DE__, 0, 12 },
+{ "POP DE", 1, 12, 0, 0 },
 // D2: JPCC JP_CC_NC,nn
-{ "JPCC JP_CC_NC,nn", &__jpcc__JP_CC_NC_nn__, 0, 12 },
+{ "JPCC JP_CC_NC,nn", 3, 12, 1, 1 },
 // D3: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // D4: CALLCC JP_CC_NC,nn
-{ "CALLCC JP_CC_NC,nn", &__callcc__JP_CC_NC_nn__, 0, 12 },
+{ "CALLCC JP_CC_NC,nn", 3, 12, 1, 0 },
 // D5: PUSH DE
-{ "PUSH DE", &__push__DE__, 0, 16 },
+{ "PUSH DE", 1, 16, 0, 0 },
 // D6: SUB n
-{ "SUB n", &__sub__n__, 0, 8 },
+{ "SUB n", 2, 8, 0, 1 },
 // D7: RST 0x10
-{ "RST 0x10", &__rst__0x10__, 0, 16 },
+{ "RST 0x10", 1, 16, 1, 0 },
 // D8: RETCC JP_CC_C
-{ "RETCC JP_CC_C", &__retcc__JP_CC_C__, 0, 8 },
+{ "RETCC JP_CC_C", 1, 8, 1, 0 },
 // D9: RETI -/-
-{ "RETI -/-", &__reti__, 0, 16 },
+{ "RETI -/-", 1, 16, 1, 0 },
 // DA: JPCC JP_CC_C,nn
-{ "JPCC JP_CC_C,nn", &__jpcc__JP_CC_C_nn__, 0, 12 },
+{ "JPCC JP_CC_C,nn", 3, 12, 1, 1 },
 // DB: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // DC: CALLCC JP_CC_C,nn
-{ "CALLCC JP_CC_C,nn", &__callcc__JP_CC_C_nn__, 0, 12 },
+{ "CALLCC JP_CC_C,nn", 3, 12, 1, 0 },
 // DD: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // DE: SBC n
-{ "SBC n", &__sbc__n__, 0, 8 },
+{ "SBC n", 2, 8, 0, 1 },
 // DF: RST 0x18
-{ "RST 0x18", &__rst__0x18__, 0, 16 },
+{ "RST 0x18", 1, 16, 1, 0 },
 // E0: LD (n),A
-{ "LD (n),A", &__ld___n__A__, 0, 12 },
+{ "LD (n),A", 2, 12, 0, 0 },
 // E1: POP HL
-{ "POP HL", &__pop__HL__, 0, 12 },
+{ "POP HL", 1, 12, 0, 0 },
 // E2: LD (C),A
-{ "LD (C),A", &__ld___C__A__, 0, 8 },
+{ "LD (C),A", 1, 8, 0, 0 },
 // E3: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // E4: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // E5: PUSH HL
-{ "PUSH HL", &__push__HL__, 0, 16 },
+{ "PUSH HL", 1, 16, 0, 0 },
 // E6: AND n
-{ "AND n", &__and__n__, 0, 8 },
+{ "AND n", 2, 8, 0, 1 },
 // E7: RST 0x20
-{ "RST 0x20", &__rst__0x20__, 0, 16 },
+{ "RST 0x20", 1, 16, 1, 0 },
 // E8: ADDSP n
-{ "ADDSP n", &__addsp__n__, 0, 16 },
+{ "ADDSP n", 2, 16, 0, 1 },
 // E9: JP HL
-{ "JP HL", &__jp__HL__, 0, 4 },
+{ "JP HL", 1, 4, 1, 1 },
 // EA: LD (nn),A
-{ "LD (nn),A", &__ld___nn__A__, 0, 16 },
+{ "LD (nn),A", 3, 16, 0, 0 },
 // EB: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // EC: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // ED: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // EE: XOR n
-{ "XOR n", &__xor__n__, 0, 8 },
+{ "XOR n", 2, 8, 0, 1 },
 // EF: RST 0x28
-{ "RST 0x28", &__rst__0x28__, 0, 16 },
+{ "RST 0x28", 1, 16, 1, 0 },
 // F0: LD A,(n)
-{ "LD A,(n)", &__ld__A__n___, 0, 12 },
+{ "LD A,(n)", 2, 12, 0, 1 },
 // F1: POP AF
-{ "POP AF", &__pop__AF__, 0, 12 },
+{ "POP AF", 1, 12, 0, 0 },
 // F2: LD A,(C)
-{ "LD A,(C)", &__ld__A__C___, 0, 8 },
+{ "LD A,(C)", 1, 8, 0, 1 },
 // F3: DI -/-
-{ "DI -/-", &__di__, 0, 4 },
+{ "DI -/-", 1, 4, 0, 0 },
 // F4: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // F5: PUSH AF
-{ "PUSH AF", &__push__AF__, 0, 16 },
+{ "PUSH AF", 1, 16, 0, 0 },
 // F6: OR n
-{ "OR n", &__or__n__, 0, 8 },
+{ "OR n", 2, 8, 0, 1 },
 // F7: RST 0x30
-{ "RST 0x30", &__rst__0x30__, 0, 16 },
+{ "RST 0x30", 1, 16, 1, 0 },
 // F8: LDHL n
-{ "LDHL n", &__ldhl__n__, 0, 12 },
+{ "LDHL n", 2, 12, 0, 1 },
 // F9: LD SP,HL
-{ "LD SP,HL", &__ld__SP_HL__, 0, 8 },
+{ "LD SP,HL", 1, 8, 0, 1 },
 // FA: LD A,(nn)
-{ "LD A,(nn)", &__ld__A__nn___, 0, 16 },
+{ "LD A,(nn)", 3, 16, 0, 1 },
 // FB: EI -/-
-{ "EI -/-", &__ei__, 0, 4 },
+{ "EI -/-", 1, 4, 0, 0 },
 // FC: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // FD: INVALID
-{ "INVALID", &invalid_op, 0, 0 },
+{ "INVALID", 1, 0, 1, 0 },
 // FE: CP n
-{ "CP n", &__cp__n__, 0, 8 },
+{ "CP n", 2, 8, 0, 1 },
 // FF: RST 0x38
-{ "RST 0x38", &__rst__0x38__, 0, 16 },
+{ "RST 0x38", 1, 16, 1, 0 },
 };
+
+/* Sequences of operations that are run as one, found at 0x200 + index. */
+#define GB_CPU_FUSIONS 16
+const uint16_t gb_cpu_fusions[GB_CPU_FUSIONS][4] = {
+{ 3, 0x02A, 0x012, 0x013 },
+{ 3, 0x00B, 0x078, 0x0B1 },
+{ 3, 0x078, 0x0B1, 0x020 },
+{ 3, 0x022, 0x00B, 0x078 },
+{ 3, 0x0F0, 0x0FE, 0x020 },
+{ 3, 0x01A, 0x022, 0x013 },
+{ 2, 0x0FE, 0x020, 0x000 },
+{ 2, 0x0FE, 0x028, 0x000 },
+{ 2, 0x0F0, 0x0FE, 0x000 },
+{ 2, 0x0B1, 0x020, 0x000 },
+{ 2, 0x005, 0x020, 0x000 },
+{ 2, 0x00D, 0x020, 0x000 },
+{ 2, 0x023, 0x023, 0x000 },
+{ 2, 0x07E, 0x080, 0x000 },
+{ 2, 0x079, 0x022, 0x000 },
+{ 2, 0x0F5, 0x0C1, 0x000 },
+};
+
+#endif /* GB_CPU_OPERATIONS_H */
+
+/**
+ * Run operations until the cycle `end` or until the next event is due. At least one
+ * operation is run.
+ *
+ * Registers are kept in locals for the duration of the run and are written back when
+ * done.
+ *
+ * HALT and interrupts are only looked at when the run starts. Whatever requests or
+ * enables an interrupt, or halts the CPU, schedules GB_EVENT_IRQ to end the run after
+ * the operation, so the loop itself does not check for them. So does a change of the
+ * memory map, e.g. a bank switch, as the block might have been decoded from the memory
+ * mapped before.
+ *
+ * Operations are fetched from decoded blocks, the block is looked up again once all of
+ * its operations have run. Sequences that often follow each other are fused into one
+ * operation, which saves dispatching the ones after the first. Blocks that loop without
+ * doing anything are skipped ahead, see `skip_idle`.
+ *
+ * With CPU_ACCURATE each operation sets the cycle at which it accesses memory, so the
+ * handlers of IO registers run at the M-cycle of the access instead of at the start of
+ * the operation, see `access_begin`. Translated and compiled blocks are not run as
+ * their operations do not keep track of it.
+ */
+static void CPU_RUN (gb_t *gb, uint64_t end)
+{
+	gb_cpu_regs local = gb->cpu.regs, *regs = &local;
+	const gb_cpu_block *block = &no_block, *prev;
+	idle_loop idle = { NULL };
+	gb_cpu_insn insn;
+	unsigned int op, i = 0;
+	int cc;
+
+#ifdef CPU_THREADED
+	static const void *const dispatch_table[] = {
+		&&op_000, &&op_001, &&op_002, &&op_003, &&op_004, &&op_005, &&op_006, &&op_007,
+		&&op_008, &&op_009, &&op_00A, &&op_00B, &&op_00C, &&op_00D, &&op_00E, &&op_00F,
+		&&op_010, &&op_011, &&op_012, &&op_013, &&op_014, &&op_015, &&op_016, &&op_017,
+		&&op_018, &&op_019, &&op_01A, &&op_01B, &&op_01C, &&op_01D, &&op_01E, &&op_01F,
+		&&op_020, &&op_021, &&op_022, &&op_023, &&op_024, &&op_025, &&op_026, &&op_027,
+		&&op_028, &&op_029, &&op_02A, &&op_02B, &&op_02C, &&op_02D, &&op_02E, &&op_02F,
+		&&op_030, &&op_031, &&op_032, &&op_033, &&op_034, &&op_035, &&op_036, &&op_037,
+		&&op_038, &&op_039, &&op_03A, &&op_03B, &&op_03C, &&op_03D, &&op_03E, &&op_03F,
+		&&op_040, &&op_041, &&op_042, &&op_043, &&op_044, &&op_045, &&op_046, &&op_047,
+		&&op_048, &&op_049, &&op_04A, &&op_04B, &&op_04C, &&op_04D, &&op_04E, &&op_04F,
+		&&op_050, &&op_051, &&op_052, &&op_053, &&op_054, &&op_055, &&op_056, &&op_057,
+		&&op_058, &&op_059, &&op_05A, &&op_05B, &&op_05C, &&op_05D, &&op_05E, &&op_05F,
+		&&op_060, &&op_061, &&op_062, &&op_063, &&op_064, &&op_065, &&op_066, &&op_067,
+		&&op_068, &&op_069, &&op_06A, &&op_06B, &&op_06C, &&op_06D, &&op_06E, &&op_06F,
+		&&op_070, &&op_071, &&op_072, &&op_073, &&op_074, &&op_075, &&op_076, &&op_077,
+		&&op_078, &&op_079, &&op_07A, &&op_07B, &&op_07C, &&op_07D, &&op_07E, &&op_07F,
+		&&op_080, &&op_081, &&op_082, &&op_083, &&op_084, &&op_085, &&op_086, &&op_087,
+		&&op_088, &&op_089, &&op_08A, &&op_08B, &&op_08C, &&op_08D, &&op_08E, &&op_08F,
+		&&op_090, &&op_091, &&op_092, &&op_093, &&op_094, &&op_095, &&op_096, &&op_097,
+		&&op_098, &&op_099, &&op_09A, &&op_09B, &&op_09C, &&op_09D, &&op_09E, &&op_09F,
+		&&op_0A0, &&op_0A1, &&op_0A2, &&op_0A3, &&op_0A4, &&op_0A5, &&op_0A6, &&op_0A7,
+		&&op_0A8, &&op_0A9, &&op_0AA, &&op_0AB, &&op_0AC, &&op_0AD, &&op_0AE, &&op_0AF,
+		&&op_0B0, &&op_0B1, &&op_0B2, &&op_0B3, &&op_0B4, &&op_0B5, &&op_0B6, &&op_0B7,
+		&&op_0B8, &&op_0B9, &&op_0BA, &&op_0BB, &&op_0BC, &&op_0BD, &&op_0BE, &&op_0BF,
+		&&op_0C0, &&op_0C1, &&op_0C2, &&op_0C3, &&op_0C4, &&op_0C5, &&op_0C6, &&op_0C7,
+		&&op_0C8, &&op_0C9, &&op_0CA, &&op_invalid, &&op_0CC, &&op_0CD, &&op_0CE, &&op_0CF,
+		&&op_0D0, &&op_0D1, &&op_0D2, &&op_invalid, &&op_0D4, &&op_0D5, &&op_0D6, &&op_0D7,
+		&&op_0D8, &&op_0D9, &&op_0DA, &&op_invalid, &&op_0DC, &&op_invalid, &&op_0DE, &&op_0DF,
+		&&op_0E0, &&op_0E1, &&op_0E2, &&op_invalid, &&op_invalid, &&op_0E5, &&op_0E6, &&op_0E7,
+		&&op_0E8, &&op_0E9, &&op_0EA, &&op_invalid, &&op_invalid, &&op_invalid, &&op_0EE, &&op_0EF,
+		&&op_0F0, &&op_0F1, &&op_0F2, &&op_0F3, &&op_invalid, &&op_0F5, &&op_0F6, &&op_0F7,
+		&&op_0F8, &&op_0F9, &&op_0FA, &&op_0FB, &&op_invalid, &&op_invalid, &&op_0FE, &&op_0FF,
+		&&op_100, &&op_101, &&op_102, &&op_103, &&op_104, &&op_105, &&op_106, &&op_107,
+		&&op_108, &&op_109, &&op_10A, &&op_10B, &&op_10C, &&op_10D, &&op_10E, &&op_10F,
+		&&op_110, &&op_111, &&op_112, &&op_113, &&op_114, &&op_115, &&op_116, &&op_117,
+		&&op_118, &&op_119, &&op_11A, &&op_11B, &&op_11C, &&op_11D, &&op_11E, &&op_11F,
+		&&op_120, &&op_121, &&op_122, &&op_123, &&op_124, &&op_125, &&op_126, &&op_127,
+		&&op_128, &&op_129, &&op_12A, &&op_12B, &&op_12C, &&op_12D, &&op_12E, &&op_12F,
+		&&op_130, &&op_131, &&op_132, &&op_133, &&op_134, &&op_135, &&op_136, &&op_137,
+		&&op_138, &&op_139, &&op_13A, &&op_13B, &&op_13C, &&op_13D, &&op_13E, &&op_13F,
+		&&op_140, &&op_141, &&op_142, &&op_143, &&op_144, &&op_145, &&op_146, &&op_147,
+		&&op_148, &&op_149, &&op_14A, &&op_14B, &&op_14C, &&op_14D, &&op_14E, &&op_14F,
+		&&op_150, &&op_151, &&op_152, &&op_153, &&op_154, &&op_155, &&op_156, &&op_157,
+		&&op_158, &&op_159, &&op_15A, &&op_15B, &&op_15C, &&op_15D, &&op_15E, &&op_15F,
+		&&op_160, &&op_161, &&op_162, &&op_163, &&op_164, &&op_165, &&op_166, &&op_167,
+		&&op_168, &&op_169, &&op_16A, &&op_16B, &&op_16C, &&op_16D, &&op_16E, &&op_16F,
+		&&op_170, &&op_171, &&op_172, &&op_173, &&op_174, &&op_175, &&op_176, &&op_177,
+		&&op_178, &&op_179, &&op_17A, &&op_17B, &&op_17C, &&op_17D, &&op_17E, &&op_17F,
+		&&op_180, &&op_181, &&op_182, &&op_183, &&op_184, &&op_185, &&op_186, &&op_187,
+		&&op_188, &&op_189, &&op_18A, &&op_18B, &&op_18C, &&op_18D, &&op_18E, &&op_18F,
+		&&op_190, &&op_191, &&op_192, &&op_193, &&op_194, &&op_195, &&op_196, &&op_197,
+		&&op_198, &&op_199, &&op_19A, &&op_19B, &&op_19C, &&op_19D, &&op_19E, &&op_19F,
+		&&op_1A0, &&op_1A1, &&op_1A2, &&op_1A3, &&op_1A4, &&op_1A5, &&op_1A6, &&op_1A7,
+		&&op_1A8, &&op_1A9, &&op_1AA, &&op_1AB, &&op_1AC, &&op_1AD, &&op_1AE, &&op_1AF,
+		&&op_1B0, &&op_1B1, &&op_1B2, &&op_1B3, &&op_1B4, &&op_1B5, &&op_1B6, &&op_1B7,
+		&&op_1B8, &&op_1B9, &&op_1BA, &&op_1BB, &&op_1BC, &&op_1BD, &&op_1BE, &&op_1BF,
+		&&op_1C0, &&op_1C1, &&op_1C2, &&op_1C3, &&op_1C4, &&op_1C5, &&op_1C6, &&op_1C7,
+		&&op_1C8, &&op_1C9, &&op_1CA, &&op_1CB, &&op_1CC, &&op_1CD, &&op_1CE, &&op_1CF,
+		&&op_1D0, &&op_1D1, &&op_1D2, &&op_1D3, &&op_1D4, &&op_1D5, &&op_1D6, &&op_1D7,
+		&&op_1D8, &&op_1D9, &&op_1DA, &&op_1DB, &&op_1DC, &&op_1DD, &&op_1DE, &&op_1DF,
+		&&op_1E0, &&op_1E1, &&op_1E2, &&op_1E3, &&op_1E4, &&op_1E5, &&op_1E6, &&op_1E7,
+		&&op_1E8, &&op_1E9, &&op_1EA, &&op_1EB, &&op_1EC, &&op_1ED, &&op_1EE, &&op_1EF,
+		&&op_1F0, &&op_1F1, &&op_1F2, &&op_1F3, &&op_1F4, &&op_1F5, &&op_1F6, &&op_1F7,
+		&&op_1F8, &&op_1F9, &&op_1FA, &&op_1FB, &&op_1FC, &&op_1FD, &&op_1FE, &&op_1FF,
+		&&op_200,
+		&&op_201,
+		&&op_202,
+		&&op_203,
+		&&op_204,
+		&&op_205,
+		&&op_206,
+		&&op_207,
+		&&op_208,
+		&&op_209,
+		&&op_20A,
+		&&op_20B,
+		&&op_20C,
+		&&op_20D,
+		&&op_20E,
+		&&op_20F,
+	};
+#define OP(x) op_##x:
+#define INVALID op_invalid:
+#define DISPATCH(op) goto *dispatch_table[op];
+#else
+#define OP(x) case 0x##x:
+#define INVALID default:
+#define DISPATCH(op) switch (op)
+#endif
+#define NEXT goto next
+#define IMM8 ((uint8_t) insn.imm)
+#define IMM16 (insn.imm)
+
+// go on with the next operation of a fused sequence, unless it has to be run on its own
+// as the block was invalidated or an event is due in between.
+#define FUSE \
+	gb->cc += cc; \
+	cc = 0; \
+	if (i >= block->n || gb->cc >= end || gb->cc >= gb->sched.next) NEXT; \
+	insn = block->ops[i ++]; \
+	PC += insn.len; \
+	ACCESS_AT ();
+
+#ifdef CPU_ACCURATE
+// memory is accessed in the M-cycles after the operation and its operands are fetched
+#define ACCESS_AT() gb->cpu.access_cc = gb->cc + cc + insn.at
+#else
+#define ACCESS_AT()
+#endif
+
+	if (f_halt)
+	{
+		// stay halted until an interrupt is requested, which only an event can do, so
+		// the clock moves on to it in steps of 4 cycles
+		if (!IRQ)
+		{
+			uint64_t until = end < gb->sched.next ? end : gb->sched.next;
+			gb->cc += until > gb->cc ? (until - gb->cc + 3) & ~3ULL : 4;
+			return;
+		}
+		f_halt = 0;
+	}
+
+	cc = 0;
+	if (ime && IRQ)
+	{
+#ifdef CPU_ACCURATE
+		// the return address is pushed in the 4th and 5th M-cycle of the 5 it takes
+		gb->cpu.access_cc = gb->cc + 12;
+		interrupt (gb, regs);
+		cc = 20;
+#else
+		interrupt (gb, regs);
+		cc = 5;
+#endif
+	}
+
+	do
+	{
+#ifdef DEBUG_CPU
+		SYNC_FLAGS ();
+		printf ("$%.4X: ", PC);
+		printf
+		(
+			"%-20s AF = x%.4X BC = x%.4X DE = x%.4X HL = x%.4X SP = x%.4X IF = x%.2X IE = 0x%.2X IME = %d\n",
+			RAM (PC) == 0xCB ? operations_cb[RAM (PC + 1)].name : operations[RAM (PC)].name,
+			AF, BC, DE, HL, SP, IF, IE, ime
+		);
+#endif
+
+		if (i >= block->n)
+		{
+			prev = block;
+			block = get_block (gb, PC);
+			gb->cpu.run_page = PC >> 8;
+			i = 0;
+
+			if (block->idle)
+				skip_idle (gb, regs, block, prev, &idle, end);
+#if (defined(CPU_JIT) || defined(CPU_AOT)) && !defined(CPU_ACCURATE)
+			// run the translated block, it returns how many operations it got through
+			gb_cpu_code code = jit_code (gb, block);
+			if (code && cc == 0)
+			{
+				i = code (gb, regs, end);
+				continue;
+			}
+#endif
+		}
+		insn = block->ops[i ++];
+		PC += insn.len;
+		op = insn.op;
+		ACCESS_AT ();
+
+		DISPATCH (op)
+		{
+			// NOP -/-
+			OP (000) { nop (gb, regs); cc += 4; } NEXT;
+			// LD BC,nn
+			OP (001) { uint16_t nn = IMM16; BC = nn; cc += 12; } NEXT;
+			// LD (BC),A
+			OP (002) { STORE ((BC),A); cc += 8; } NEXT;
+			// INC16 BC
+			OP (003) { inc16 (gb, regs, &BC); cc += 8; } NEXT;
+			// INC B
+			OP (004) { inc (gb, regs, &B); cc += 4; } NEXT;
+			// DEC B
+			OP (005) { dec (gb, regs, &B); cc += 4; } NEXT;
+			// LD B,n
+			OP (006) { uint8_t n = IMM8; B = n; cc += 8; } NEXT;
+			// RLCA -/-
+			OP (007) { rlca (gb, regs); cc += 4; } NEXT;
+			// LD (nn),SP
+			OP (008) { uint16_t nn = IMM16; STORE ((nn),SP); STORE (nn + 1, SP >> 8); cc += 20; } NEXT;
+			// ADDHL BC
+			OP (009) { addhl (gb, regs, BC); cc += 8; } NEXT;
+			// LD A,(BC)
+			OP (00A) { A = RAM (BC); cc += 8; } NEXT;
+			// DEC16 BC
+			OP (00B) { dec16 (gb, regs, &BC); cc += 8; } NEXT;
+			// INC C
+			OP (00C) { inc (gb, regs, &C); cc += 4; } NEXT;
+			// DEC C
+			OP (00D) { dec (gb, regs, &C); cc += 4; } NEXT;
+			// LD C,n
+			OP (00E) { uint8_t n = IMM8; C = n; cc += 8; } NEXT;
+			// RRCA -/-
+			OP (00F) { rrca (gb, regs); cc += 4; } NEXT;
+			// STOP -/-
+			OP (010) { stop (gb, regs); cc += 4; } NEXT;
+			// LD DE,nn
+			OP (011) { uint16_t nn = IMM16; DE = nn; cc += 12; } NEXT;
+			// LD (DE),A
+			OP (012) { STORE ((DE),A); cc += 8; } NEXT;
+			// INC16 DE
+			OP (013) { inc16 (gb, regs, &DE); cc += 8; } NEXT;
+			// INC D
+			OP (014) { inc (gb, regs, &D); cc += 4; } NEXT;
+			// DEC D
+			OP (015) { dec (gb, regs, &D); cc += 4; } NEXT;
+			// LD D,n
+			OP (016) { uint8_t n = IMM8; D = n; cc += 8; } NEXT;
+			// RLA -/-
+			OP (017) { rla (gb, regs); cc += 4; } NEXT;
+			// JR n
+			OP (018) { uint8_t n = IMM8; jr (gb, regs, n); cc += 12; } NEXT;
+			// ADDHL DE
+			OP (019) { addhl (gb, regs, DE); cc += 8; } NEXT;
+			// LD A,(DE)
+			OP (01A) { A = RAM (DE); cc += 8; } NEXT;
+			// DEC16 DE
+			OP (01B) { dec16 (gb, regs, &DE); cc += 8; } NEXT;
+			// INC E
+			OP (01C) { inc (gb, regs, &E); cc += 4; } NEXT;
+			// DEC E
+			OP (01D) { dec (gb, regs, &E); cc += 4; } NEXT;
+			// LD E,n
+			OP (01E) { uint8_t n = IMM8; E = n; cc += 8; } NEXT;
+			// RRA -/-
+			OP (01F) { rra (gb, regs); cc += 4; } NEXT;
+			// JRCC JP_CC_NZ,n
+			OP (020) { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NZ,n); cc += 8; } NEXT;
+			// LD HL,nn
+			OP (021) { uint16_t nn = IMM16; HL = nn; cc += 12; } NEXT;
+			// LDI (HL),A
+			OP (022) { STORE ((HL),A); HL ++; cc += 8; } NEXT;
+			// INC16 HL
+			OP (023) { inc16 (gb, regs, &HL); cc += 8; } NEXT;
+			// INC H
+			OP (024) { inc (gb, regs, &H); cc += 4; } NEXT;
+			// DEC H
+			OP (025) { dec (gb, regs, &H); cc += 4; } NEXT;
+			// LD H,n
+			OP (026) { uint8_t n = IMM8; H = n; cc += 8; } NEXT;
+			// DAA -/-
+			OP (027) { daa (gb, regs); cc += 4; } NEXT;
+			// JRCC JP_CC_Z,n
+			OP (028) { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_Z,n); cc += 8; } NEXT;
+			// ADDHL HL
+			OP (029) { addhl (gb, regs, HL); cc += 8; } NEXT;
+			// LDI A,(HL)
+			OP (02A) { A = RAM (HL); HL ++; cc += 8; } NEXT;
+			// DEC16 HL
+			OP (02B) { dec16 (gb, regs, &HL); cc += 8; } NEXT;
+			// INC L
+			OP (02C) { inc (gb, regs, &L); cc += 4; } NEXT;
+			// DEC L
+			OP (02D) { dec (gb, regs, &L); cc += 4; } NEXT;
+			// LD L,n
+			OP (02E) { uint8_t n = IMM8; L = n; cc += 8; } NEXT;
+			// CPL -/-
+			OP (02F) { cpl (gb, regs); cc += 4; } NEXT;
+			// JRCC JP_CC_NC,n
+			OP (030) { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NC,n); cc += 8; } NEXT;
+			// LD SP,nn
+			OP (031) { uint16_t nn = IMM16; SP = nn; cc += 12; } NEXT;
+			// LDD (HL),A
+			OP (032) { STORE ((HL),A); HL --; cc += 8; } NEXT;
+			// INC16 SP
+			OP (033) { inc16 (gb, regs, &SP); cc += 8; } NEXT;
+			// INC (HL)
+			OP (034) { uint8_t n = RAM (HL); inc (gb, regs, &n); STORE (HL, n); cc += 12; } NEXT;
+			// DEC (HL)
+			OP (035) { uint8_t n = RAM (HL); dec (gb, regs, &n); STORE (HL, n); cc += 12; } NEXT;
+			// LD (HL),n
+			OP (036) { uint8_t n = IMM8; STORE ((HL),n); cc += 12; } NEXT;
+			// SCF -/-
+			OP (037) { scf (gb, regs); cc += 4; } NEXT;
+			// JRCC JP_CC_C,n
+			OP (038) { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_C,n); cc += 8; } NEXT;
+			// ADDHL SP
+			OP (039) { addhl (gb, regs, SP); cc += 8; } NEXT;
+			// LDD A,(HL)
+			OP (03A) { A = RAM (HL); HL --; cc += 8; } NEXT;
+			// DEC16 SP
+			OP (03B) { dec16 (gb, regs, &SP); cc += 8; } NEXT;
+			// INC A
+			OP (03C) { inc (gb, regs, &A); cc += 4; } NEXT;
+			// DEC A
+			OP (03D) { dec (gb, regs, &A); cc += 4; } NEXT;
+			// LD A,n
+			OP (03E) { uint8_t n = IMM8; A = n; cc += 8; } NEXT;
+			// CCF -/-
+			OP (03F) { ccf (gb, regs); cc += 4; } NEXT;
+			// LD B,B
+			OP (040) { B = B; cc += 4; } NEXT;
+			// LD B,C
+			OP (041) { B = C; cc += 4; } NEXT;
+			// LD B,D
+			OP (042) { B = D; cc += 4; } NEXT;
+			// LD B,E
+			OP (043) { B = E; cc += 4; } NEXT;
+			// LD B,H
+			OP (044) { B = H; cc += 4; } NEXT;
+			// LD B,L
+			OP (045) { B = L; cc += 4; } NEXT;
+			// LD B,(HL)
+			OP (046) { B = RAM (HL); cc += 8; } NEXT;
+			// LD B,A
+			OP (047) { B = A; cc += 4; } NEXT;
+			// LD C,B
+			OP (048) { C = B; cc += 4; } NEXT;
+			// LD C,C
+			OP (049) { C = C; cc += 4; } NEXT;
+			// LD C,D
+			OP (04A) { C = D; cc += 4; } NEXT;
+			// LD C,E
+			OP (04B) { C = E; cc += 4; } NEXT;
+			// LD C,H
+			OP (04C) { C = H; cc += 4; } NEXT;
+			// LD C,L
+			OP (04D) { C = L; cc += 4; } NEXT;
+			// LD C,(HL)
+			OP (04E) { C = RAM (HL); cc += 8; } NEXT;
+			// LD C,A
+			OP (04F) { C = A; cc += 4; } NEXT;
+			// LD D,B
+			OP (050) { D = B; cc += 4; } NEXT;
+			// LD D,C
+			OP (051) { D = C; cc += 4; } NEXT;
+			// LD D,D
+			OP (052) { D = D; cc += 4; } NEXT;
+			// LD D,E
+			OP (053) { D = E; cc += 4; } NEXT;
+			// LD D,H
+			OP (054) { D = H; cc += 4; } NEXT;
+			// LD D,L
+			OP (055) { D = L; cc += 4; } NEXT;
+			// LD D,(HL)
+			OP (056) { D = RAM (HL); cc += 8; } NEXT;
+			// LD D,A
+			OP (057) { D = A; cc += 4; } NEXT;
+			// LD E,B
+			OP (058) { E = B; cc += 4; } NEXT;
+			// LD E,C
+			OP (059) { E = C; cc += 4; } NEXT;
+			// LD E,D
+			OP (05A) { E = D; cc += 4; } NEXT;
+			// LD E,E
+			OP (05B) { E = E; cc += 4; } NEXT;
+			// LD E,H
+			OP (05C) { E = H; cc += 4; } NEXT;
+			// LD E,L
+			OP (05D) { E = L; cc += 4; } NEXT;
+			// LD E,(HL)
+			OP (05E) { E = RAM (HL); cc += 8; } NEXT;
+			// LD E,A
+			OP (05F) { E = A; cc += 4; } NEXT;
+			// LD H,B
+			OP (060) { H = B; cc += 4; } NEXT;
+			// LD H,C
+			OP (061) { H = C; cc += 4; } NEXT;
+			// LD H,D
+			OP (062) { H = D; cc += 4; } NEXT;
+			// LD H,E
+			OP (063) { H = E; cc += 4; } NEXT;
+			// LD H,H
+			OP (064) { H = H; cc += 4; } NEXT;
+			// LD H,L
+			OP (065) { H = L; cc += 4; } NEXT;
+			// LD H,(HL)
+			OP (066) { H = RAM (HL); cc += 8; } NEXT;
+			// LD H,A
+			OP (067) { H = A; cc += 4; } NEXT;
+			// LD L,B
+			OP (068) { L = B; cc += 4; } NEXT;
+			// LD L,C
+			OP (069) { L = C; cc += 4; } NEXT;
+			// LD L,D
+			OP (06A) { L = D; cc += 4; } NEXT;
+			// LD L,E
+			OP (06B) { L = E; cc += 4; } NEXT;
+			// LD L,H
+			OP (06C) { L = H; cc += 4; } NEXT;
+			// LD L,L
+			OP (06D) { L = L; cc += 4; } NEXT;
+			// LD L,(HL)
+			OP (06E) { L = RAM (HL); cc += 8; } NEXT;
+			// LD L,A
+			OP (06F) { L = A; cc += 4; } NEXT;
+			// LD (HL),B
+			OP (070) { STORE ((HL),B); cc += 8; } NEXT;
+			// LD (HL),C
+			OP (071) { STORE ((HL),C); cc += 8; } NEXT;
+			// LD (HL),D
+			OP (072) { STORE ((HL),D); cc += 8; } NEXT;
+			// LD (HL),E
+			OP (073) { STORE ((HL),E); cc += 8; } NEXT;
+			// LD (HL),H
+			OP (074) { STORE ((HL),H); cc += 8; } NEXT;
+			// LD (HL),L
+			OP (075) { STORE ((HL),L); cc += 8; } NEXT;
+			// HALT -/-
+			OP (076) { halt (gb, regs); cc += 4; } NEXT;
+			// LD (HL),A
+			OP (077) { STORE ((HL),A); cc += 8; } NEXT;
+			// LD A,B
+			OP (078) { A = B; cc += 4; } NEXT;
+			// LD A,C
+			OP (079) { A = C; cc += 4; } NEXT;
+			// LD A,D
+			OP (07A) { A = D; cc += 4; } NEXT;
+			// LD A,E
+			OP (07B) { A = E; cc += 4; } NEXT;
+			// LD A,H
+			OP (07C) { A = H; cc += 4; } NEXT;
+			// LD A,L
+			OP (07D) { A = L; cc += 4; } NEXT;
+			// LD A,(HL)
+			OP (07E) { A = RAM (HL); cc += 8; } NEXT;
+			// LD A,A
+			OP (07F) { A = A; cc += 4; } NEXT;
+			// ADD B
+			OP (080) { add (gb, regs, B); cc += 4; } NEXT;
+			// ADD C
+			OP (081) { add (gb, regs, C); cc += 4; } NEXT;
+			// ADD D
+			OP (082) { add (gb, regs, D); cc += 4; } NEXT;
+			// ADD E
+			OP (083) { add (gb, regs, E); cc += 4; } NEXT;
+			// ADD H
+			OP (084) { add (gb, regs, H); cc += 4; } NEXT;
+			// ADD L
+			OP (085) { add (gb, regs, L); cc += 4; } NEXT;
+			// ADD (HL)
+			OP (086) { add (gb, regs, RAM (HL)); cc += 8; } NEXT;
+			// ADD A
+			OP (087) { add (gb, regs, A); cc += 4; } NEXT;
+			// ADC B
+			OP (088) { adc (gb, regs, B); cc += 4; } NEXT;
+			// ADC C
+			OP (089) { adc (gb, regs, C); cc += 4; } NEXT;
+			// ADC D
+			OP (08A) { adc (gb, regs, D); cc += 4; } NEXT;
+			// ADC E
+			OP (08B) { adc (gb, regs, E); cc += 4; } NEXT;
+			// ADC H
+			OP (08C) { adc (gb, regs, H); cc += 4; } NEXT;
+			// ADC L
+			OP (08D) { adc (gb, regs, L); cc += 4; } NEXT;
+			// ADC (HL)
+			OP (08E) { adc (gb, regs, RAM (HL)); cc += 8; } NEXT;
+			// ADC A
+			OP (08F) { adc (gb, regs, A); cc += 4; } NEXT;
+			// SUB B
+			OP (090) { sub (gb, regs, B); cc += 4; } NEXT;
+			// SUB C
+			OP (091) { sub (gb, regs, C); cc += 4; } NEXT;
+			// SUB D
+			OP (092) { sub (gb, regs, D); cc += 4; } NEXT;
+			// SUB E
+			OP (093) { sub (gb, regs, E); cc += 4; } NEXT;
+			// SUB H
+			OP (094) { sub (gb, regs, H); cc += 4; } NEXT;
+			// SUB L
+			OP (095) { sub (gb, regs, L); cc += 4; } NEXT;
+			// SUB (HL)
+			OP (096) { sub (gb, regs, RAM (HL)); cc += 8; } NEXT;
+			// SUB A
+			OP (097) { sub (gb, regs, A); cc += 4; } NEXT;
+			// SBC B
+			OP (098) { sbc (gb, regs, B); cc += 4; } NEXT;
+			// SBC C
+			OP (099) { sbc (gb, regs, C); cc += 4; } NEXT;
+			// SBC D
+			OP (09A) { sbc (gb, regs, D); cc += 4; } NEXT;
+			// SBC E
+			OP (09B) { sbc (gb, regs, E); cc += 4; } NEXT;
+			// SBC H
+			OP (09C) { sbc (gb, regs, H); cc += 4; } NEXT;
+			// SBC L
+			OP (09D) { sbc (gb, regs, L); cc += 4; } NEXT;
+			// SBC (HL)
+			OP (09E) { sbc (gb, regs, RAM (HL)); cc += 8; } NEXT;
+			// SBC A
+			OP (09F) { sbc (gb, regs, A); cc += 4; } NEXT;
+			// AND B
+			OP (0A0) { and (gb, regs, B); cc += 4; } NEXT;
+			// AND C
+			OP (0A1) { and (gb, regs, C); cc += 4; } NEXT;
+			// AND D
+			OP (0A2) { and (gb, regs, D); cc += 4; } NEXT;
+			// AND E
+			OP (0A3) { and (gb, regs, E); cc += 4; } NEXT;
+			// AND H
+			OP (0A4) { and (gb, regs, H); cc += 4; } NEXT;
+			// AND L
+			OP (0A5) { and (gb, regs, L); cc += 4; } NEXT;
+			// AND (HL)
+			OP (0A6) { and (gb, regs, RAM (HL)); cc += 8; } NEXT;
+			// AND A
+			OP (0A7) { and (gb, regs, A); cc += 4; } NEXT;
+			// XOR B
+			OP (0A8) { xor (gb, regs, B); cc += 4; } NEXT;
+			// XOR C
+			OP (0A9) { xor (gb, regs, C); cc += 4; } NEXT;
+			// XOR D
+			OP (0AA) { xor (gb, regs, D); cc += 4; } NEXT;
+			// XOR E
+			OP (0AB) { xor (gb, regs, E); cc += 4; } NEXT;
+			// XOR H
+			OP (0AC) { xor (gb, regs, H); cc += 4; } NEXT;
+			// XOR L
+			OP (0AD) { xor (gb, regs, L); cc += 4; } NEXT;
+			// XOR (HL)
+			OP (0AE) { xor (gb, regs, RAM (HL)); cc += 8; } NEXT;
+			// XOR A
+			OP (0AF) { xor (gb, regs, A); cc += 4; } NEXT;
+			// OR B
+			OP (0B0) { or (gb, regs, B); cc += 4; } NEXT;
+			// OR C
+			OP (0B1) { or (gb, regs, C); cc += 4; } NEXT;
+			// OR D
+			OP (0B2) { or (gb, regs, D); cc += 4; } NEXT;
+			// OR E
+			OP (0B3) { or (gb, regs, E); cc += 4; } NEXT;
+			// OR H
+			OP (0B4) { or (gb, regs, H); cc += 4; } NEXT;
+			// OR L
+			OP (0B5) { or (gb, regs, L); cc += 4; } NEXT;
+			// OR (HL)
+			OP (0B6) { or (gb, regs, RAM (HL)); cc += 8; } NEXT;
+			// OR A
+			OP (0B7) { or (gb, regs, A); cc += 4; } NEXT;
+			// CP B
+			OP (0B8) { cp (gb, regs, B); cc += 4; } NEXT;
+			// CP C
+			OP (0B9) { cp (gb, regs, C); cc += 4; } NEXT;
+			// CP D
+			OP (0BA) { cp (gb, regs, D); cc += 4; } NEXT;
+			// CP E
+			OP (0BB) { cp (gb, regs, E); cc += 4; } NEXT;
+			// CP H
+			OP (0BC) { cp (gb, regs, H); cc += 4; } NEXT;
+			// CP L
+			OP (0BD) { cp (gb, regs, L); cc += 4; } NEXT;
+			// CP (HL)
+			OP (0BE) { cp (gb, regs, RAM (HL)); cc += 8; } NEXT;
+			// CP A
+			OP (0BF) { cp (gb, regs, A); cc += 4; } NEXT;
+			// RETCC JP_CC_NZ
+			OP (0C0) { cc += retcc (gb, regs, JP_CC_NZ); cc += 8; } NEXT;
+			// POP BC
+			OP (0C1) { pop (gb, regs, &BC); cc += 12; } NEXT;
+			// JPCC JP_CC_NZ,nn
+			OP (0C2) { uint16_t nn = IMM16; cc += jpcc (gb, regs, JP_CC_NZ,nn); cc += 12; } NEXT;
+			// JP nn
+			OP (0C3) { uint16_t nn = IMM16; jp (gb, regs, nn); cc += 16; } NEXT;
+			// CALLCC JP_CC_NZ,nn
+			OP (0C4) { uint16_t nn = IMM16; cc += callcc (gb, regs, JP_CC_NZ,nn); cc += 12; } NEXT;
+			// PUSH BC
+			OP (0C5) { push (gb, regs, BC); cc += 16; } NEXT;
+			// ADD n
+			OP (0C6) { uint8_t n = IMM8; add (gb, regs, n); cc += 8; } NEXT;
+			// RST 0x00
+			OP (0C7) { rst (gb, regs, 0x00); cc += 16; } NEXT;
+			// RETCC JP_CC_Z
+			OP (0C8) { cc += retcc (gb, regs, JP_CC_Z); cc += 8; } NEXT;
+			// RET -/-
+			OP (0C9) { ret (gb, regs); cc += 16; } NEXT;
+			// JPCC JP_CC_Z,nn
+			OP (0CA) { uint16_t nn = IMM16; cc += jpcc (gb, regs, JP_CC_Z,nn); cc += 12; } NEXT;
+			// CALLCC JP_CC_Z,nn
+			OP (0CC) { uint16_t nn = IMM16; cc += callcc (gb, regs, JP_CC_Z,nn); cc += 12; } NEXT;
+			// CALL nn
+			OP (0CD) { uint16_t nn = IMM16; call (gb, regs, nn); cc += 24; } NEXT;
+			// ADC n
+			OP (0CE) { uint8_t n = IMM8; adc (gb, regs, n); cc += 8; } NEXT;
+			// RST 0x08
+			OP (0CF) { rst (gb, regs, 0x08); cc += 16; } NEXT;
+			// RETCC JP_CC_NC
+			OP (0D0) { cc += retcc (gb, regs, JP_CC_NC); cc += 8; } NEXT;
+			// POP DE
+			OP (0D1) { pop (gb, regs, &DE); cc += 12; } NEXT;
+			// JPCC JP_CC_NC,nn
+			OP (0D2) { uint16_t nn = IMM16; cc += jpcc (gb, regs, JP_CC_NC,nn); cc += 12; } NEXT;
+			// CALLCC JP_CC_NC,nn
+			OP (0D4) { uint16_t nn = IMM16; cc += callcc (gb, regs, JP_CC_NC,nn); cc += 12; } NEXT;
+			// PUSH DE
+			OP (0D5) { push (gb, regs, DE); cc += 16; } NEXT;
+			// SUB n
+			OP (0D6) { uint8_t n = IMM8; sub (gb, regs, n); cc += 8; } NEXT;
+			// RST 0x10
+			OP (0D7) { rst (gb, regs, 0x10); cc += 16; } NEXT;
+			// RETCC JP_CC_C
+			OP (0D8) { cc += retcc (gb, regs, JP_CC_C); cc += 8; } NEXT;
+			// RETI -/-
+			OP (0D9) { reti (gb, regs); cc += 16; } NEXT;
+			// JPCC JP_CC_C,nn
+			OP (0DA) { uint16_t nn = IMM16; cc += jpcc (gb, regs, JP_CC_C,nn); cc += 12; } NEXT;
+			// CALLCC JP_CC_C,nn
+			OP (0DC) { uint16_t nn = IMM16; cc += callcc (gb, regs, JP_CC_C,nn); cc += 12; } NEXT;
+			// SBC n
+			OP (0DE) { uint8_t n = IMM8; sbc (gb, regs, n); cc += 8; } NEXT;
+			// RST 0x18
+			OP (0DF) { rst (gb, regs, 0x18); cc += 16; } NEXT;
+			// LD (n),A
+			OP (0E0) { uint16_t n = 0xFF00 | IMM8; STORE ((n),A); cc += 12; } NEXT;
+			// POP HL
+			OP (0E1) { pop (gb, regs, &HL); cc += 12; } NEXT;
+			// LD (C),A
+			OP (0E2) { uint16_t nn = 0xFF00 | C; STORE ((nn),A); cc += 8; } NEXT;
+			// PUSH HL
+			OP (0E5) { push (gb, regs, HL); cc += 16; } NEXT;
+			// AND n
+			OP (0E6) { uint8_t n = IMM8; and (gb, regs, n); cc += 8; } NEXT;
+			// RST 0x20
+			OP (0E7) { rst (gb, regs, 0x20); cc += 16; } NEXT;
+			// ADDSP n
+			OP (0E8) { uint8_t n = IMM8; addsp (gb, regs, n); cc += 16; } NEXT;
+			// JP HL
+			OP (0E9) { jp (gb, regs, HL); cc += 4; } NEXT;
+			// LD (nn),A
+			OP (0EA) { uint16_t nn = IMM16; STORE ((nn),A); cc += 16; } NEXT;
+			// XOR n
+			OP (0EE) { uint8_t n = IMM8; xor (gb, regs, n); cc += 8; } NEXT;
+			// RST 0x28
+			OP (0EF) { rst (gb, regs, 0x28); cc += 16; } NEXT;
+			// LD A,(n)
+			OP (0F0) { uint16_t n = 0xFF00 | IMM8; A = RAM (n); cc += 12; } NEXT;
+			// POP AF
+			OP (0F1) { pop (gb, regs, &AF); F &= 0xF0; DROP_FLAGS (); cc += 12; } NEXT;
+			// LD A,(C)
+			OP (0F2) { uint16_t nn = 0xFF00 | C; A = RAM (nn); cc += 8; } NEXT;
+			// DI -/-
+			OP (0F3) { di (gb, regs); cc += 4; } NEXT;
+			// PUSH AF
+			OP (0F5) { SYNC_FLAGS (); push (gb, regs, AF); cc += 16; } NEXT;
+			// OR n
+			OP (0F6) { uint8_t n = IMM8; or (gb, regs, n); cc += 8; } NEXT;
+			// RST 0x30
+			OP (0F7) { rst (gb, regs, 0x30); cc += 16; } NEXT;
+			// LDHL n
+			OP (0F8) { uint8_t n = IMM8; ldhl (gb, regs, n); cc += 12; } NEXT;
+			// LD SP,HL
+			OP (0F9) { SP = HL; cc += 8; } NEXT;
+			// LD A,(nn)
+			OP (0FA) { uint16_t nn = IMM16; A = RAM (nn); cc += 16; } NEXT;
+			// EI -/-
+			OP (0FB) { ei (gb, regs); cc += 4; } NEXT;
+			// CP n
+			OP (0FE) { uint8_t n = IMM8; cp (gb, regs, n); cc += 8; } NEXT;
+			// RST 0x38
+			OP (0FF) { rst (gb, regs, 0x38); cc += 16; } NEXT;
+			// RLC B
+			OP (100) { rlc (gb, regs, &B); cc += 8; } NEXT;
+			// RLC C
+			OP (101) { rlc (gb, regs, &C); cc += 8; } NEXT;
+			// RLC D
+			OP (102) { rlc (gb, regs, &D); cc += 8; } NEXT;
+			// RLC E
+			OP (103) { rlc (gb, regs, &E); cc += 8; } NEXT;
+			// RLC H
+			OP (104) { rlc (gb, regs, &H); cc += 8; } NEXT;
+			// RLC L
+			OP (105) { rlc (gb, regs, &L); cc += 8; } NEXT;
+			// RLC (HL)
+			OP (106) { uint8_t n = RAM (HL); rlc (gb, regs, &n); STORE (HL, n); cc += 16; } NEXT;
+			// RLC A
+			OP (107) { rlc (gb, regs, &A); cc += 8; } NEXT;
+			// RRC B
+			OP (108) { rrc (gb, regs, &B); cc += 8; } NEXT;
+			// RRC C
+			OP (109) { rrc (gb, regs, &C); cc += 8; } NEXT;
+			// RRC D
+			OP (10A) { rrc (gb, regs, &D); cc += 8; } NEXT;
+			// RRC E
+			OP (10B) { rrc (gb, regs, &E); cc += 8; } NEXT;
+			// RRC H
+			OP (10C) { rrc (gb, regs, &H); cc += 8; } NEXT;
+			// RRC L
+			OP (10D) { rrc (gb, regs, &L); cc += 8; } NEXT;
+			// RRC (HL)
+			OP (10E) { uint8_t n = RAM (HL); rrc (gb, regs, &n); STORE (HL, n); cc += 16; } NEXT;
+			// RRC A
+			OP (10F) { rrc (gb, regs, &A); cc += 8; } NEXT;
+			// RL B
+			OP (110) { rl (gb, regs, &B); cc += 8; } NEXT;
+			// RL C
+			OP (111) { rl (gb, regs, &C); cc += 8; } NEXT;
+			// RL D
+			OP (112) { rl (gb, regs, &D); cc += 8; } NEXT;
+			// RL E
+			OP (113) { rl (gb, regs, &E); cc += 8; } NEXT;
+			// RL H
+			OP (114) { rl (gb, regs, &H); cc += 8; } NEXT;
+			// RL L
+			OP (115) { rl (gb, regs, &L); cc += 8; } NEXT;
+			// RL (HL)
+			OP (116) { uint8_t n = RAM (HL); rl (gb, regs, &n); STORE (HL, n); cc += 16; } NEXT;
+			// RL A
+			OP (117) { rl (gb, regs, &A); cc += 8; } NEXT;
+			// RR B
+			OP (118) { rr (gb, regs, &B); cc += 8; } NEXT;
+			// RR C
+			OP (119) { rr (gb, regs, &C); cc += 8; } NEXT;
+			// RR D
+			OP (11A) { rr (gb, regs, &D); cc += 8; } NEXT;
+			// RR E
+			OP (11B) { rr (gb, regs, &E); cc += 8; } NEXT;
+			// RR H
+			OP (11C) { rr (gb, regs, &H); cc += 8; } NEXT;
+			// RR L
+			OP (11D) { rr (gb, regs, &L); cc += 8; } NEXT;
+			// RR (HL)
+			OP (11E) { uint8_t n = RAM (HL); rr (gb, regs, &n); STORE (HL, n); cc += 16; } NEXT;
+			// RR A
+			OP (11F) { rr (gb, regs, &A); cc += 8; } NEXT;
+			// SLA B
+			OP (120) { sla (gb, regs, &B); cc += 8; } NEXT;
+			// SLA C
+			OP (121) { sla (gb, regs, &C); cc += 8; } NEXT;
+			// SLA D
+			OP (122) { sla (gb, regs, &D); cc += 8; } NEXT;
+			// SLA E
+			OP (123) { sla (gb, regs, &E); cc += 8; } NEXT;
+			// SLA H
+			OP (124) { sla (gb, regs, &H); cc += 8; } NEXT;
+			// SLA L
+			OP (125) { sla (gb, regs, &L); cc += 8; } NEXT;
+			// SLA (HL)
+			OP (126) { uint8_t n = RAM (HL); sla (gb, regs, &n); STORE (HL, n); cc += 16; } NEXT;
+			// SLA A
+			OP (127) { sla (gb, regs, &A); cc += 8; } NEXT;
+			// SRA B
+			OP (128) { sra (gb, regs, &B); cc += 8; } NEXT;
+			// SRA C
+			OP (129) { sra (gb, regs, &C); cc += 8; } NEXT;
+			// SRA D
+			OP (12A) { sra (gb, regs, &D); cc += 8; } NEXT;
+			// SRA E
+			OP (12B) { sra (gb, regs, &E); cc += 8; } NEXT;
+			// SRA H
+			OP (12C) { sra (gb, regs, &H); cc += 8; } NEXT;
+			// SRA L
+			OP (12D) { sra (gb, regs, &L); cc += 8; } NEXT;
+			// SRA (HL)
+			OP (12E) { uint8_t n = RAM (HL); sra (gb, regs, &n); STORE (HL, n); cc += 16; } NEXT;
+			// SRA A
+			OP (12F) { sra (gb, regs, &A); cc += 8; } NEXT;
+			// SWAP B
+			OP (130) { swap (gb, regs, &B); cc += 8; } NEXT;
+			// SWAP C
+			OP (131) { swap (gb, regs, &C); cc += 8; } NEXT;
+			// SWAP D
+			OP (132) { swap (gb, regs, &D); cc += 8; } NEXT;
+			// SWAP E
+			OP (133) { swap (gb, regs, &E); cc += 8; } NEXT;
+			// SWAP H
+			OP (134) { swap (gb, regs, &H); cc += 8; } NEXT;
+			// SWAP L
+			OP (135) { swap (gb, regs, &L); cc += 8; } NEXT;
+			// SWAP (HL)
+			OP (136) { uint8_t n = RAM (HL); swap (gb, regs, &n); STORE (HL, n); cc += 16; } NEXT;
+			// SWAP A
+			OP (137) { swap (gb, regs, &A); cc += 8; } NEXT;
+			// SRL B
+			OP (138) { srl (gb, regs, &B); cc += 8; } NEXT;
+			// SRL C
+			OP (139) { srl (gb, regs, &C); cc += 8; } NEXT;
+			// SRL D
+			OP (13A) { srl (gb, regs, &D); cc += 8; } NEXT;
+			// SRL E
+			OP (13B) { srl (gb, regs, &E); cc += 8; } NEXT;
+			// SRL H
+			OP (13C) { srl (gb, regs, &H); cc += 8; } NEXT;
+			// SRL L
+			OP (13D) { srl (gb, regs, &L); cc += 8; } NEXT;
+			// SRL (HL)
+			OP (13E) { uint8_t n = RAM (HL); srl (gb, regs, &n); STORE (HL, n); cc += 16; } NEXT;
+			// SRL A
+			OP (13F) { srl (gb, regs, &A); cc += 8; } NEXT;
+			// BIT B,0
+			OP (140) { bit (gb, regs, B,0); cc += 8; } NEXT;
+			// BIT C,0
+			OP (141) { bit (gb, regs, C,0); cc += 8; } NEXT;
+			// BIT D,0
+			OP (142) { bit (gb, regs, D,0); cc += 8; } NEXT;
+			// BIT E,0
+			OP (143) { bit (gb, regs, E,0); cc += 8; } NEXT;
+			// BIT H,0
+			OP (144) { bit (gb, regs, H,0); cc += 8; } NEXT;
+			// BIT L,0
+			OP (145) { bit (gb, regs, L,0); cc += 8; } NEXT;
+			// BIT (HL),0
+			OP (146) { bit (gb, regs, RAM (HL),0); cc += 12; } NEXT;
+			// BIT A,0
+			OP (147) { bit (gb, regs, A,0); cc += 8; } NEXT;
+			// BIT B,1
+			OP (148) { bit (gb, regs, B,1); cc += 8; } NEXT;
+			// BIT C,1
+			OP (149) { bit (gb, regs, C,1); cc += 8; } NEXT;
+			// BIT D,1
+			OP (14A) { bit (gb, regs, D,1); cc += 8; } NEXT;
+			// BIT E,1
+			OP (14B) { bit (gb, regs, E,1); cc += 8; } NEXT;
+			// BIT H,1
+			OP (14C) { bit (gb, regs, H,1); cc += 8; } NEXT;
+			// BIT L,1
+			OP (14D) { bit (gb, regs, L,1); cc += 8; } NEXT;
+			// BIT (HL),1
+			OP (14E) { bit (gb, regs, RAM (HL),1); cc += 12; } NEXT;
+			// BIT A,1
+			OP (14F) { bit (gb, regs, A,1); cc += 8; } NEXT;
+			// BIT B,2
+			OP (150) { bit (gb, regs, B,2); cc += 8; } NEXT;
+			// BIT C,2
+			OP (151) { bit (gb, regs, C,2); cc += 8; } NEXT;
+			// BIT D,2
+			OP (152) { bit (gb, regs, D,2); cc += 8; } NEXT;
+			// BIT E,2
+			OP (153) { bit (gb, regs, E,2); cc += 8; } NEXT;
+			// BIT H,2
+			OP (154) { bit (gb, regs, H,2); cc += 8; } NEXT;
+			// BIT L,2
+			OP (155) { bit (gb, regs, L,2); cc += 8; } NEXT;
+			// BIT (HL),2
+			OP (156) { bit (gb, regs, RAM (HL),2); cc += 12; } NEXT;
+			// BIT A,2
+			OP (157) { bit (gb, regs, A,2); cc += 8; } NEXT;
+			// BIT B,3
+			OP (158) { bit (gb, regs, B,3); cc += 8; } NEXT;
+			// BIT C,3
+			OP (159) { bit (gb, regs, C,3); cc += 8; } NEXT;
+			// BIT D,3
+			OP (15A) { bit (gb, regs, D,3); cc += 8; } NEXT;
+			// BIT E,3
+			OP (15B) { bit (gb, regs, E,3); cc += 8; } NEXT;
+			// BIT H,3
+			OP (15C) { bit (gb, regs, H,3); cc += 8; } NEXT;
+			// BIT L,3
+			OP (15D) { bit (gb, regs, L,3); cc += 8; } NEXT;
+			// BIT (HL),3
+			OP (15E) { bit (gb, regs, RAM (HL),3); cc += 12; } NEXT;
+			// BIT A,3
+			OP (15F) { bit (gb, regs, A,3); cc += 8; } NEXT;
+			// BIT B,4
+			OP (160) { bit (gb, regs, B,4); cc += 8; } NEXT;
+			// BIT C,4
+			OP (161) { bit (gb, regs, C,4); cc += 8; } NEXT;
+			// BIT D,4
+			OP (162) { bit (gb, regs, D,4); cc += 8; } NEXT;
+			// BIT E,4
+			OP (163) { bit (gb, regs, E,4); cc += 8; } NEXT;
+			// BIT H,4
+			OP (164) { bit (gb, regs, H,4); cc += 8; } NEXT;
+			// BIT L,4
+			OP (165) { bit (gb, regs, L,4); cc += 8; } NEXT;
+			// BIT (HL),4
+			OP (166) { bit (gb, regs, RAM (HL),4); cc += 12; } NEXT;
+			// BIT A,4
+			OP (167) { bit (gb, regs, A,4); cc += 8; } NEXT;
+			// BIT B,5
+			OP (168) { bit (gb, regs, B,5); cc += 8; } NEXT;
+			// BIT C,5
+			OP (169) { bit (gb, regs, C,5); cc += 8; } NEXT;
+			// BIT D,5
+			OP (16A) { bit (gb, regs, D,5); cc += 8; } NEXT;
+			// BIT E,5
+			OP (16B) { bit (gb, regs, E,5); cc += 8; } NEXT;
+			// BIT H,5
+			OP (16C) { bit (gb, regs, H,5); cc += 8; } NEXT;
+			// BIT L,5
+			OP (16D) { bit (gb, regs, L,5); cc += 8; } NEXT;
+			// BIT (HL),5
+			OP (16E) { bit (gb, regs, RAM (HL),5); cc += 12; } NEXT;
+			// BIT A,5
+			OP (16F) { bit (gb, regs, A,5); cc += 8; } NEXT;
+			// BIT B,6
+			OP (170) { bit (gb, regs, B,6); cc += 8; } NEXT;
+			// BIT C,6
+			OP (171) { bit (gb, regs, C,6); cc += 8; } NEXT;
+			// BIT D,6
+			OP (172) { bit (gb, regs, D,6); cc += 8; } NEXT;
+			// BIT E,6
+			OP (173) { bit (gb, regs, E,6); cc += 8; } NEXT;
+			// BIT H,6
+			OP (174) { bit (gb, regs, H,6); cc += 8; } NEXT;
+			// BIT L,6
+			OP (175) { bit (gb, regs, L,6); cc += 8; } NEXT;
+			// BIT (HL),6
+			OP (176) { bit (gb, regs, RAM (HL),6); cc += 12; } NEXT;
+			// BIT A,6
+			OP (177) { bit (gb, regs, A,6); cc += 8; } NEXT;
+			// BIT B,7
+			OP (178) { bit (gb, regs, B,7); cc += 8; } NEXT;
+			// BIT C,7
+			OP (179) { bit (gb, regs, C,7); cc += 8; } NEXT;
+			// BIT D,7
+			OP (17A) { bit (gb, regs, D,7); cc += 8; } NEXT;
+			// BIT E,7
+			OP (17B) { bit (gb, regs, E,7); cc += 8; } NEXT;
+			// BIT H,7
+			OP (17C) { bit (gb, regs, H,7); cc += 8; } NEXT;
+			// BIT L,7
+			OP (17D) { bit (gb, regs, L,7); cc += 8; } NEXT;
+			// BIT (HL),7
+			OP (17E) { bit (gb, regs, RAM (HL),7); cc += 12; } NEXT;
+			// BIT A,7
+			OP (17F) { bit (gb, regs, A,7); cc += 8; } NEXT;
+			// RES B,0
+			OP (180) { res (gb, regs, &B,0); cc += 8; } NEXT;
+			// RES C,0
+			OP (181) { res (gb, regs, &C,0); cc += 8; } NEXT;
+			// RES D,0
+			OP (182) { res (gb, regs, &D,0); cc += 8; } NEXT;
+			// RES E,0
+			OP (183) { res (gb, regs, &E,0); cc += 8; } NEXT;
+			// RES H,0
+			OP (184) { res (gb, regs, &H,0); cc += 8; } NEXT;
+			// RES L,0
+			OP (185) { res (gb, regs, &L,0); cc += 8; } NEXT;
+			// RES (HL),0
+			OP (186) { uint8_t n = RAM (HL); res (gb, regs, &n,0); STORE (HL, n); cc += 16; } NEXT;
+			// RES A,0
+			OP (187) { res (gb, regs, &A,0); cc += 8; } NEXT;
+			// RES B,1
+			OP (188) { res (gb, regs, &B,1); cc += 8; } NEXT;
+			// RES C,1
+			OP (189) { res (gb, regs, &C,1); cc += 8; } NEXT;
+			// RES D,1
+			OP (18A) { res (gb, regs, &D,1); cc += 8; } NEXT;
+			// RES E,1
+			OP (18B) { res (gb, regs, &E,1); cc += 8; } NEXT;
+			// RES H,1
+			OP (18C) { res (gb, regs, &H,1); cc += 8; } NEXT;
+			// RES L,1
+			OP (18D) { res (gb, regs, &L,1); cc += 8; } NEXT;
+			// RES (HL),1
+			OP (18E) { uint8_t n = RAM (HL); res (gb, regs, &n,1); STORE (HL, n); cc += 16; } NEXT;
+			// RES A,1
+			OP (18F) { res (gb, regs, &A,1); cc += 8; } NEXT;
+			// RES B,2
+			OP (190) { res (gb, regs, &B,2); cc += 8; } NEXT;
+			// RES C,2
+			OP (191) { res (gb, regs, &C,2); cc += 8; } NEXT;
+			// RES D,2
+			OP (192) { res (gb, regs, &D,2); cc += 8; } NEXT;
+			// RES E,2
+			OP (193) { res (gb, regs, &E,2); cc += 8; } NEXT;
+			// RES H,2
+			OP (194) { res (gb, regs, &H,2); cc += 8; } NEXT;
+			// RES L,2
+			OP (195) { res (gb, regs, &L,2); cc += 8; } NEXT;
+			// RES (HL),2
+			OP (196) { uint8_t n = RAM (HL); res (gb, regs, &n,2); STORE (HL, n); cc += 16; } NEXT;
+			// RES A,2
+			OP (197) { res (gb, regs, &A,2); cc += 8; } NEXT;
+			// RES B,3
+			OP (198) { res (gb, regs, &B,3); cc += 8; } NEXT;
+			// RES C,3
+			OP (199) { res (gb, regs, &C,3); cc += 8; } NEXT;
+			// RES D,3
+			OP (19A) { res (gb, regs, &D,3); cc += 8; } NEXT;
+			// RES E,3
+			OP (19B) { res (gb, regs, &E,3); cc += 8; } NEXT;
+			// RES H,3
+			OP (19C) { res (gb, regs, &H,3); cc += 8; } NEXT;
+			// RES L,3
+			OP (19D) { res (gb, regs, &L,3); cc += 8; } NEXT;
+			// RES (HL),3
+			OP (19E) { uint8_t n = RAM (HL); res (gb, regs, &n,3); STORE (HL, n); cc += 16; } NEXT;
+			// RES A,3
+			OP (19F) { res (gb, regs, &A,3); cc += 8; } NEXT;
+			// RES B,4
+			OP (1A0) { res (gb, regs, &B,4); cc += 8; } NEXT;
+			// RES C,4
+			OP (1A1) { res (gb, regs, &C,4); cc += 8; } NEXT;
+			// RES D,4
+			OP (1A2) { res (gb, regs, &D,4); cc += 8; } NEXT;
+			// RES E,4
+			OP (1A3) { res (gb, regs, &E,4); cc += 8; } NEXT;
+			// RES H,4
+			OP (1A4) { res (gb, regs, &H,4); cc += 8; } NEXT;
+			// RES L,4
+			OP (1A5) { res (gb, regs, &L,4); cc += 8; } NEXT;
+			// RES (HL),4
+			OP (1A6) { uint8_t n = RAM (HL); res (gb, regs, &n,4); STORE (HL, n); cc += 16; } NEXT;
+			// RES A,4
+			OP (1A7) { res (gb, regs, &A,4); cc += 8; } NEXT;
+			// RES B,5
+			OP (1A8) { res (gb, regs, &B,5); cc += 8; } NEXT;
+			// RES C,5
+			OP (1A9) { res (gb, regs, &C,5); cc += 8; } NEXT;
+			// RES D,5
+			OP (1AA) { res (gb, regs, &D,5); cc += 8; } NEXT;
+			// RES E,5
+			OP (1AB) { res (gb, regs, &E,5); cc += 8; } NEXT;
+			// RES H,5
+			OP (1AC) { res (gb, regs, &H,5); cc += 8; } NEXT;
+			// RES L,5
+			OP (1AD) { res (gb, regs, &L,5); cc += 8; } NEXT;
+			// RES (HL),5
+			OP (1AE) { uint8_t n = RAM (HL); res (gb, regs, &n,5); STORE (HL, n); cc += 16; } NEXT;
+			// RES A,5
+			OP (1AF) { res (gb, regs, &A,5); cc += 8; } NEXT;
+			// RES B,6
+			OP (1B0) { res (gb, regs, &B,6); cc += 8; } NEXT;
+			// RES C,6
+			OP (1B1) { res (gb, regs, &C,6); cc += 8; } NEXT;
+			// RES D,6
+			OP (1B2) { res (gb, regs, &D,6); cc += 8; } NEXT;
+			// RES E,6
+			OP (1B3) { res (gb, regs, &E,6); cc += 8; } NEXT;
+			// RES H,6
+			OP (1B4) { res (gb, regs, &H,6); cc += 8; } NEXT;
+			// RES L,6
+			OP (1B5) { res (gb, regs, &L,6); cc += 8; } NEXT;
+			// RES (HL),6
+			OP (1B6) { uint8_t n = RAM (HL); res (gb, regs, &n,6); STORE (HL, n); cc += 16; } NEXT;
+			// RES A,6
+			OP (1B7) { res (gb, regs, &A,6); cc += 8; } NEXT;
+			// RES B,7
+			OP (1B8) { res (gb, regs, &B,7); cc += 8; } NEXT;
+			// RES C,7
+			OP (1B9) { res (gb, regs, &C,7); cc += 8; } NEXT;
+			// RES D,7
+			OP (1BA) { res (gb, regs, &D,7); cc += 8; } NEXT;
+			// RES E,7
+			OP (1BB) { res (gb, regs, &E,7); cc += 8; } NEXT;
+			// RES H,7
+			OP (1BC) { res (gb, regs, &H,7); cc += 8; } NEXT;
+			// RES L,7
+			OP (1BD) { res (gb, regs, &L,7); cc += 8; } NEXT;
+			// RES (HL),7
+			OP (1BE) { uint8_t n = RAM (HL); res (gb, regs, &n,7); STORE (HL, n); cc += 16; } NEXT;
+			// RES A,7
+			OP (1BF) { res (gb, regs, &A,7); cc += 8; } NEXT;
+			// SET B,0
+			OP (1C0) { set (gb, regs, &B,0); cc += 8; } NEXT;
+			// SET C,0
+			OP (1C1) { set (gb, regs, &C,0); cc += 8; } NEXT;
+			// SET D,0
+			OP (1C2) { set (gb, regs, &D,0); cc += 8; } NEXT;
+			// SET E,0
+			OP (1C3) { set (gb, regs, &E,0); cc += 8; } NEXT;
+			// SET H,0
+			OP (1C4) { set (gb, regs, &H,0); cc += 8; } NEXT;
+			// SET L,0
+			OP (1C5) { set (gb, regs, &L,0); cc += 8; } NEXT;
+			// SET (HL),0
+			OP (1C6) { uint8_t n = RAM (HL); set (gb, regs, &n,0); STORE (HL, n); cc += 16; } NEXT;
+			// SET A,0
+			OP (1C7) { set (gb, regs, &A,0); cc += 8; } NEXT;
+			// SET B,1
+			OP (1C8) { set (gb, regs, &B,1); cc += 8; } NEXT;
+			// SET C,1
+			OP (1C9) { set (gb, regs, &C,1); cc += 8; } NEXT;
+			// SET D,1
+			OP (1CA) { set (gb, regs, &D,1); cc += 8; } NEXT;
+			// SET E,1
+			OP (1CB) { set (gb, regs, &E,1); cc += 8; } NEXT;
+			// SET H,1
+			OP (1CC) { set (gb, regs, &H,1); cc += 8; } NEXT;
+			// SET L,1
+			OP (1CD) { set (gb, regs, &L,1); cc += 8; } NEXT;
+			// SET (HL),1
+			OP (1CE) { uint8_t n = RAM (HL); set (gb, regs, &n,1); STORE (HL, n); cc += 16; } NEXT;
+			// SET A,1
+			OP (1CF) { set (gb, regs, &A,1); cc += 8; } NEXT;
+			// SET B,2
+			OP (1D0) { set (gb, regs, &B,2); cc += 8; } NEXT;
+			// SET C,2
+			OP (1D1) { set (gb, regs, &C,2); cc += 8; } NEXT;
+			// SET D,2
+			OP (1D2) { set (gb, regs, &D,2); cc += 8; } NEXT;
+			// SET E,2
+			OP (1D3) { set (gb, regs, &E,2); cc += 8; } NEXT;
+			// SET H,2
+			OP (1D4) { set (gb, regs, &H,2); cc += 8; } NEXT;
+			// SET L,2
+			OP (1D5) { set (gb, regs, &L,2); cc += 8; } NEXT;
+			// SET (HL),2
+			OP (1D6) { uint8_t n = RAM (HL); set (gb, regs, &n,2); STORE (HL, n); cc += 16; } NEXT;
+			// SET A,2
+			OP (1D7) { set (gb, regs, &A,2); cc += 8; } NEXT;
+			// SET B,3
+			OP (1D8) { set (gb, regs, &B,3); cc += 8; } NEXT;
+			// SET C,3
+			OP (1D9) { set (gb, regs, &C,3); cc += 8; } NEXT;
+			// SET D,3
+			OP (1DA) { set (gb, regs, &D,3); cc += 8; } NEXT;
+			// SET E,3
+			OP (1DB) { set (gb, regs, &E,3); cc += 8; } NEXT;
+			// SET H,3
+			OP (1DC) { set (gb, regs, &H,3); cc += 8; } NEXT;
+			// SET L,3
+			OP (1DD) { set (gb, regs, &L,3); cc += 8; } NEXT;
+			// SET (HL),3
+			OP (1DE) { uint8_t n = RAM (HL); set (gb, regs, &n,3); STORE (HL, n); cc += 16; } NEXT;
+			// SET A,3
+			OP (1DF) { set (gb, regs, &A,3); cc += 8; } NEXT;
+			// SET B,4
+			OP (1E0) { set (gb, regs, &B,4); cc += 8; } NEXT;
+			// SET C,4
+			OP (1E1) { set (gb, regs, &C,4); cc += 8; } NEXT;
+			// SET D,4
+			OP (1E2) { set (gb, regs, &D,4); cc += 8; } NEXT;
+			// SET E,4
+			OP (1E3) { set (gb, regs, &E,4); cc += 8; } NEXT;
+			// SET H,4
+			OP (1E4) { set (gb, regs, &H,4); cc += 8; } NEXT;
+			// SET L,4
+			OP (1E5) { set (gb, regs, &L,4); cc += 8; } NEXT;
+			// SET (HL),4
+			OP (1E6) { uint8_t n = RAM (HL); set (gb, regs, &n,4); STORE (HL, n); cc += 16; } NEXT;
+			// SET A,4
+			OP (1E7) { set (gb, regs, &A,4); cc += 8; } NEXT;
+			// SET B,5
+			OP (1E8) { set (gb, regs, &B,5); cc += 8; } NEXT;
+			// SET C,5
+			OP (1E9) { set (gb, regs, &C,5); cc += 8; } NEXT;
+			// SET D,5
+			OP (1EA) { set (gb, regs, &D,5); cc += 8; } NEXT;
+			// SET E,5
+			OP (1EB) { set (gb, regs, &E,5); cc += 8; } NEXT;
+			// SET H,5
+			OP (1EC) { set (gb, regs, &H,5); cc += 8; } NEXT;
+			// SET L,5
+			OP (1ED) { set (gb, regs, &L,5); cc += 8; } NEXT;
+			// SET (HL),5
+			OP (1EE) { uint8_t n = RAM (HL); set (gb, regs, &n,5); STORE (HL, n); cc += 16; } NEXT;
+			// SET A,5
+			OP (1EF) { set (gb, regs, &A,5); cc += 8; } NEXT;
+			// SET B,6
+			OP (1F0) { set (gb, regs, &B,6); cc += 8; } NEXT;
+			// SET C,6
+			OP (1F1) { set (gb, regs, &C,6); cc += 8; } NEXT;
+			// SET D,6
+			OP (1F2) { set (gb, regs, &D,6); cc += 8; } NEXT;
+			// SET E,6
+			OP (1F3) { set (gb, regs, &E,6); cc += 8; } NEXT;
+			// SET H,6
+			OP (1F4) { set (gb, regs, &H,6); cc += 8; } NEXT;
+			// SET L,6
+			OP (1F5) { set (gb, regs, &L,6); cc += 8; } NEXT;
+			// SET (HL),6
+			OP (1F6) { uint8_t n = RAM (HL); set (gb, regs, &n,6); STORE (HL, n); cc += 16; } NEXT;
+			// SET A,6
+			OP (1F7) { set (gb, regs, &A,6); cc += 8; } NEXT;
+			// SET B,7
+			OP (1F8) { set (gb, regs, &B,7); cc += 8; } NEXT;
+			// SET C,7
+			OP (1F9) { set (gb, regs, &C,7); cc += 8; } NEXT;
+			// SET D,7
+			OP (1FA) { set (gb, regs, &D,7); cc += 8; } NEXT;
+			// SET E,7
+			OP (1FB) { set (gb, regs, &E,7); cc += 8; } NEXT;
+			// SET H,7
+			OP (1FC) { set (gb, regs, &H,7); cc += 8; } NEXT;
+			// SET L,7
+			OP (1FD) { set (gb, regs, &L,7); cc += 8; } NEXT;
+			// SET (HL),7
+			OP (1FE) { uint8_t n = RAM (HL); set (gb, regs, &n,7); STORE (HL, n); cc += 16; } NEXT;
+			// SET A,7
+			OP (1FF) { set (gb, regs, &A,7); cc += 8; } NEXT;
+			// LDI A,(HL) + LD (DE),A + INC16 DE
+			OP (200) { A = RAM (HL); HL ++; cc += 8; } FUSE { STORE ((DE),A); cc += 8; } FUSE { inc16 (gb, regs, &DE); cc += 8; } NEXT;
+			// DEC16 BC + LD A,B + OR C
+			OP (201) { dec16 (gb, regs, &BC); cc += 8; } FUSE { A = B; cc += 4; } FUSE { or (gb, regs, C); cc += 4; } NEXT;
+			// LD A,B + OR C + JRCC JP_CC_NZ,n
+			OP (202) { A = B; cc += 4; } FUSE { or (gb, regs, C); cc += 4; } FUSE { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NZ,n); cc += 8; } NEXT;
+			// LDI (HL),A + DEC16 BC + LD A,B
+			OP (203) { STORE ((HL),A); HL ++; cc += 8; } FUSE { dec16 (gb, regs, &BC); cc += 8; } FUSE { A = B; cc += 4; } NEXT;
+			// LD A,(n) + CP n + JRCC JP_CC_NZ,n
+			OP (204) { uint16_t n = 0xFF00 | IMM8; A = RAM (n); cc += 12; } FUSE { uint8_t n = IMM8; cp (gb, regs, n); cc += 8; } FUSE { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NZ,n); cc += 8; } NEXT;
+			// LD A,(DE) + LDI (HL),A + INC16 DE
+			OP (205) { A = RAM (DE); cc += 8; } FUSE { STORE ((HL),A); HL ++; cc += 8; } FUSE { inc16 (gb, regs, &DE); cc += 8; } NEXT;
+			// CP n + JRCC JP_CC_NZ,n
+			OP (206) { uint8_t n = IMM8; cp (gb, regs, n); cc += 8; } FUSE { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NZ,n); cc += 8; } NEXT;
+			// CP n + JRCC JP_CC_Z,n
+			OP (207) { uint8_t n = IMM8; cp (gb, regs, n); cc += 8; } FUSE { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_Z,n); cc += 8; } NEXT;
+			// LD A,(n) + CP n
+			OP (208) { uint16_t n = 0xFF00 | IMM8; A = RAM (n); cc += 12; } FUSE { uint8_t n = IMM8; cp (gb, regs, n); cc += 8; } NEXT;
+			// OR C + JRCC JP_CC_NZ,n
+			OP (209) { or (gb, regs, C); cc += 4; } FUSE { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NZ,n); cc += 8; } NEXT;
+			// DEC B + JRCC JP_CC_NZ,n
+			OP (20A) { dec (gb, regs, &B); cc += 4; } FUSE { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NZ,n); cc += 8; } NEXT;
+			// DEC C + JRCC JP_CC_NZ,n
+			OP (20B) { dec (gb, regs, &C); cc += 4; } FUSE { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NZ,n); cc += 8; } NEXT;
+			// INC16 HL + INC16 HL
+			OP (20C) { inc16 (gb, regs, &HL); cc += 8; } FUSE { inc16 (gb, regs, &HL); cc += 8; } NEXT;
+			// LD A,(HL) + ADD B
+			OP (20D) { A = RAM (HL); cc += 8; } FUSE { add (gb, regs, B); cc += 4; } NEXT;
+			// LD A,C + LDI (HL),A
+			OP (20E) { A = C; cc += 4; } FUSE { STORE ((HL),A); HL ++; cc += 8; } NEXT;
+			// PUSH AF + POP BC
+			OP (20F) { SYNC_FLAGS (); push (gb, regs, AF); cc += 16; } FUSE { pop (gb, regs, &BC); cc += 12; } NEXT;
+			// INVALID
+			INVALID { fprintf (stderr, "$%.4X: INVALID OPERATION\n", PC); } NEXT;
+		}
+next:
+		gb->cc += cc;
+		cc = 0;
+	}
+	while (gb->cc < end && gb->cc < gb->sched.next);
+
+#ifdef CPU_ACCURATE
+	// accesses from outside the loop happen at the current cycle
+	gb->cpu.access_cc = 0;
+#endif
+	SYNC_FLAGS ();
+	gb->cpu.regs = local;
+}
+
+#undef OP
+#undef INVALID
+#undef DISPATCH
+#undef NEXT
+#undef FUSE
+#undef ACCESS_AT
+#undef IMM8
+#undef IMM16
+
+#if (defined(CPU_JIT) || defined(CPU_AOT)) && !defined(CPU_ACCURATE)
+#define IMM8 ((uint8_t) imm)
+#define IMM16 (imm)
+
+// NOP -/-
+static int jit_op_000 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { nop (gb, regs); cc += 4; } return cc; }
+// LD BC,nn
+static int jit_op_001 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; BC = nn; cc += 12; } return cc; }
+// LD (BC),A
+static int jit_op_002 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((BC),A); cc += 8; } return cc; }
+// INC16 BC
+static int jit_op_003 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc16 (gb, regs, &BC); cc += 8; } return cc; }
+// INC B
+static int jit_op_004 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc (gb, regs, &B); cc += 4; } return cc; }
+// DEC B
+static int jit_op_005 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec (gb, regs, &B); cc += 4; } return cc; }
+// LD B,n
+static int jit_op_006 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; B = n; cc += 8; } return cc; }
+// RLCA -/-
+static int jit_op_007 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rlca (gb, regs); cc += 4; } return cc; }
+// LD (nn),SP
+static int jit_op_008 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; STORE ((nn),SP); STORE (nn + 1, SP >> 8); cc += 20; } return cc; }
+// ADDHL BC
+static int jit_op_009 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { addhl (gb, regs, BC); cc += 8; } return cc; }
+// LD A,(BC)
+static int jit_op_00A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = RAM (BC); cc += 8; } return cc; }
+// DEC16 BC
+static int jit_op_00B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec16 (gb, regs, &BC); cc += 8; } return cc; }
+// INC C
+static int jit_op_00C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc (gb, regs, &C); cc += 4; } return cc; }
+// DEC C
+static int jit_op_00D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec (gb, regs, &C); cc += 4; } return cc; }
+// LD C,n
+static int jit_op_00E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; C = n; cc += 8; } return cc; }
+// RRCA -/-
+static int jit_op_00F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rrca (gb, regs); cc += 4; } return cc; }
+// STOP -/-
+static int jit_op_010 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { stop (gb, regs); cc += 4; } return cc; }
+// LD DE,nn
+static int jit_op_011 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; DE = nn; cc += 12; } return cc; }
+// LD (DE),A
+static int jit_op_012 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((DE),A); cc += 8; } return cc; }
+// INC16 DE
+static int jit_op_013 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc16 (gb, regs, &DE); cc += 8; } return cc; }
+// INC D
+static int jit_op_014 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc (gb, regs, &D); cc += 4; } return cc; }
+// DEC D
+static int jit_op_015 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec (gb, regs, &D); cc += 4; } return cc; }
+// LD D,n
+static int jit_op_016 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; D = n; cc += 8; } return cc; }
+// RLA -/-
+static int jit_op_017 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rla (gb, regs); cc += 4; } return cc; }
+// JR n
+static int jit_op_018 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; jr (gb, regs, n); cc += 12; } return cc; }
+// ADDHL DE
+static int jit_op_019 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { addhl (gb, regs, DE); cc += 8; } return cc; }
+// LD A,(DE)
+static int jit_op_01A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = RAM (DE); cc += 8; } return cc; }
+// DEC16 DE
+static int jit_op_01B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec16 (gb, regs, &DE); cc += 8; } return cc; }
+// INC E
+static int jit_op_01C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc (gb, regs, &E); cc += 4; } return cc; }
+// DEC E
+static int jit_op_01D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec (gb, regs, &E); cc += 4; } return cc; }
+// LD E,n
+static int jit_op_01E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; E = n; cc += 8; } return cc; }
+// RRA -/-
+static int jit_op_01F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rra (gb, regs); cc += 4; } return cc; }
+// JRCC JP_CC_NZ,n
+static int jit_op_020 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NZ,n); cc += 8; } return cc; }
+// LD HL,nn
+static int jit_op_021 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; HL = nn; cc += 12; } return cc; }
+// LDI (HL),A
+static int jit_op_022 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),A); HL ++; cc += 8; } return cc; }
+// INC16 HL
+static int jit_op_023 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc16 (gb, regs, &HL); cc += 8; } return cc; }
+// INC H
+static int jit_op_024 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc (gb, regs, &H); cc += 4; } return cc; }
+// DEC H
+static int jit_op_025 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec (gb, regs, &H); cc += 4; } return cc; }
+// LD H,n
+static int jit_op_026 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; H = n; cc += 8; } return cc; }
+// DAA -/-
+static int jit_op_027 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { daa (gb, regs); cc += 4; } return cc; }
+// JRCC JP_CC_Z,n
+static int jit_op_028 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_Z,n); cc += 8; } return cc; }
+// ADDHL HL
+static int jit_op_029 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { addhl (gb, regs, HL); cc += 8; } return cc; }
+// LDI A,(HL)
+static int jit_op_02A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = RAM (HL); HL ++; cc += 8; } return cc; }
+// DEC16 HL
+static int jit_op_02B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec16 (gb, regs, &HL); cc += 8; } return cc; }
+// INC L
+static int jit_op_02C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc (gb, regs, &L); cc += 4; } return cc; }
+// DEC L
+static int jit_op_02D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec (gb, regs, &L); cc += 4; } return cc; }
+// LD L,n
+static int jit_op_02E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; L = n; cc += 8; } return cc; }
+// CPL -/-
+static int jit_op_02F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cpl (gb, regs); cc += 4; } return cc; }
+// JRCC JP_CC_NC,n
+static int jit_op_030 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_NC,n); cc += 8; } return cc; }
+// LD SP,nn
+static int jit_op_031 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; SP = nn; cc += 12; } return cc; }
+// LDD (HL),A
+static int jit_op_032 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),A); HL --; cc += 8; } return cc; }
+// INC16 SP
+static int jit_op_033 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc16 (gb, regs, &SP); cc += 8; } return cc; }
+// INC (HL)
+static int jit_op_034 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); inc (gb, regs, &n); STORE (HL, n); cc += 12; } return cc; }
+// DEC (HL)
+static int jit_op_035 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); dec (gb, regs, &n); STORE (HL, n); cc += 12; } return cc; }
+// LD (HL),n
+static int jit_op_036 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; STORE ((HL),n); cc += 12; } return cc; }
+// SCF -/-
+static int jit_op_037 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { scf (gb, regs); cc += 4; } return cc; }
+// JRCC JP_CC_C,n
+static int jit_op_038 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; cc += jrcc (gb, regs, JP_CC_C,n); cc += 8; } return cc; }
+// ADDHL SP
+static int jit_op_039 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { addhl (gb, regs, SP); cc += 8; } return cc; }
+// LDD A,(HL)
+static int jit_op_03A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = RAM (HL); HL --; cc += 8; } return cc; }
+// DEC16 SP
+static int jit_op_03B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec16 (gb, regs, &SP); cc += 8; } return cc; }
+// INC A
+static int jit_op_03C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { inc (gb, regs, &A); cc += 4; } return cc; }
+// DEC A
+static int jit_op_03D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { dec (gb, regs, &A); cc += 4; } return cc; }
+// LD A,n
+static int jit_op_03E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; A = n; cc += 8; } return cc; }
+// CCF -/-
+static int jit_op_03F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { ccf (gb, regs); cc += 4; } return cc; }
+// LD B,B
+static int jit_op_040 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { B = B; cc += 4; } return cc; }
+// LD B,C
+static int jit_op_041 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { B = C; cc += 4; } return cc; }
+// LD B,D
+static int jit_op_042 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { B = D; cc += 4; } return cc; }
+// LD B,E
+static int jit_op_043 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { B = E; cc += 4; } return cc; }
+// LD B,H
+static int jit_op_044 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { B = H; cc += 4; } return cc; }
+// LD B,L
+static int jit_op_045 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { B = L; cc += 4; } return cc; }
+// LD B,(HL)
+static int jit_op_046 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { B = RAM (HL); cc += 8; } return cc; }
+// LD B,A
+static int jit_op_047 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { B = A; cc += 4; } return cc; }
+// LD C,B
+static int jit_op_048 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { C = B; cc += 4; } return cc; }
+// LD C,C
+static int jit_op_049 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { C = C; cc += 4; } return cc; }
+// LD C,D
+static int jit_op_04A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { C = D; cc += 4; } return cc; }
+// LD C,E
+static int jit_op_04B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { C = E; cc += 4; } return cc; }
+// LD C,H
+static int jit_op_04C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { C = H; cc += 4; } return cc; }
+// LD C,L
+static int jit_op_04D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { C = L; cc += 4; } return cc; }
+// LD C,(HL)
+static int jit_op_04E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { C = RAM (HL); cc += 8; } return cc; }
+// LD C,A
+static int jit_op_04F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { C = A; cc += 4; } return cc; }
+// LD D,B
+static int jit_op_050 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { D = B; cc += 4; } return cc; }
+// LD D,C
+static int jit_op_051 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { D = C; cc += 4; } return cc; }
+// LD D,D
+static int jit_op_052 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { D = D; cc += 4; } return cc; }
+// LD D,E
+static int jit_op_053 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { D = E; cc += 4; } return cc; }
+// LD D,H
+static int jit_op_054 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { D = H; cc += 4; } return cc; }
+// LD D,L
+static int jit_op_055 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { D = L; cc += 4; } return cc; }
+// LD D,(HL)
+static int jit_op_056 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { D = RAM (HL); cc += 8; } return cc; }
+// LD D,A
+static int jit_op_057 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { D = A; cc += 4; } return cc; }
+// LD E,B
+static int jit_op_058 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { E = B; cc += 4; } return cc; }
+// LD E,C
+static int jit_op_059 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { E = C; cc += 4; } return cc; }
+// LD E,D
+static int jit_op_05A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { E = D; cc += 4; } return cc; }
+// LD E,E
+static int jit_op_05B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { E = E; cc += 4; } return cc; }
+// LD E,H
+static int jit_op_05C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { E = H; cc += 4; } return cc; }
+// LD E,L
+static int jit_op_05D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { E = L; cc += 4; } return cc; }
+// LD E,(HL)
+static int jit_op_05E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { E = RAM (HL); cc += 8; } return cc; }
+// LD E,A
+static int jit_op_05F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { E = A; cc += 4; } return cc; }
+// LD H,B
+static int jit_op_060 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { H = B; cc += 4; } return cc; }
+// LD H,C
+static int jit_op_061 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { H = C; cc += 4; } return cc; }
+// LD H,D
+static int jit_op_062 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { H = D; cc += 4; } return cc; }
+// LD H,E
+static int jit_op_063 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { H = E; cc += 4; } return cc; }
+// LD H,H
+static int jit_op_064 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { H = H; cc += 4; } return cc; }
+// LD H,L
+static int jit_op_065 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { H = L; cc += 4; } return cc; }
+// LD H,(HL)
+static int jit_op_066 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { H = RAM (HL); cc += 8; } return cc; }
+// LD H,A
+static int jit_op_067 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { H = A; cc += 4; } return cc; }
+// LD L,B
+static int jit_op_068 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { L = B; cc += 4; } return cc; }
+// LD L,C
+static int jit_op_069 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { L = C; cc += 4; } return cc; }
+// LD L,D
+static int jit_op_06A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { L = D; cc += 4; } return cc; }
+// LD L,E
+static int jit_op_06B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { L = E; cc += 4; } return cc; }
+// LD L,H
+static int jit_op_06C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { L = H; cc += 4; } return cc; }
+// LD L,L
+static int jit_op_06D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { L = L; cc += 4; } return cc; }
+// LD L,(HL)
+static int jit_op_06E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { L = RAM (HL); cc += 8; } return cc; }
+// LD L,A
+static int jit_op_06F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { L = A; cc += 4; } return cc; }
+// LD (HL),B
+static int jit_op_070 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),B); cc += 8; } return cc; }
+// LD (HL),C
+static int jit_op_071 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),C); cc += 8; } return cc; }
+// LD (HL),D
+static int jit_op_072 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),D); cc += 8; } return cc; }
+// LD (HL),E
+static int jit_op_073 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),E); cc += 8; } return cc; }
+// LD (HL),H
+static int jit_op_074 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),H); cc += 8; } return cc; }
+// LD (HL),L
+static int jit_op_075 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),L); cc += 8; } return cc; }
+// HALT -/-
+static int jit_op_076 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { halt (gb, regs); cc += 4; } return cc; }
+// LD (HL),A
+static int jit_op_077 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { STORE ((HL),A); cc += 8; } return cc; }
+// LD A,B
+static int jit_op_078 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = B; cc += 4; } return cc; }
+// LD A,C
+static int jit_op_079 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = C; cc += 4; } return cc; }
+// LD A,D
+static int jit_op_07A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = D; cc += 4; } return cc; }
+// LD A,E
+static int jit_op_07B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = E; cc += 4; } return cc; }
+// LD A,H
+static int jit_op_07C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = H; cc += 4; } return cc; }
+// LD A,L
+static int jit_op_07D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = L; cc += 4; } return cc; }
+// LD A,(HL)
+static int jit_op_07E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = RAM (HL); cc += 8; } return cc; }
+// LD A,A
+static int jit_op_07F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { A = A; cc += 4; } return cc; }
+// ADD B
+static int jit_op_080 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { add (gb, regs, B); cc += 4; } return cc; }
+// ADD C
+static int jit_op_081 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { add (gb, regs, C); cc += 4; } return cc; }
+// ADD D
+static int jit_op_082 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { add (gb, regs, D); cc += 4; } return cc; }
+// ADD E
+static int jit_op_083 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { add (gb, regs, E); cc += 4; } return cc; }
+// ADD H
+static int jit_op_084 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { add (gb, regs, H); cc += 4; } return cc; }
+// ADD L
+static int jit_op_085 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { add (gb, regs, L); cc += 4; } return cc; }
+// ADD (HL)
+static int jit_op_086 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { add (gb, regs, RAM (HL)); cc += 8; } return cc; }
+// ADD A
+static int jit_op_087 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { add (gb, regs, A); cc += 4; } return cc; }
+// ADC B
+static int jit_op_088 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { adc (gb, regs, B); cc += 4; } return cc; }
+// ADC C
+static int jit_op_089 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { adc (gb, regs, C); cc += 4; } return cc; }
+// ADC D
+static int jit_op_08A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { adc (gb, regs, D); cc += 4; } return cc; }
+// ADC E
+static int jit_op_08B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { adc (gb, regs, E); cc += 4; } return cc; }
+// ADC H
+static int jit_op_08C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { adc (gb, regs, H); cc += 4; } return cc; }
+// ADC L
+static int jit_op_08D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { adc (gb, regs, L); cc += 4; } return cc; }
+// ADC (HL)
+static int jit_op_08E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { adc (gb, regs, RAM (HL)); cc += 8; } return cc; }
+// ADC A
+static int jit_op_08F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { adc (gb, regs, A); cc += 4; } return cc; }
+// SUB B
+static int jit_op_090 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sub (gb, regs, B); cc += 4; } return cc; }
+// SUB C
+static int jit_op_091 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sub (gb, regs, C); cc += 4; } return cc; }
+// SUB D
+static int jit_op_092 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sub (gb, regs, D); cc += 4; } return cc; }
+// SUB E
+static int jit_op_093 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sub (gb, regs, E); cc += 4; } return cc; }
+// SUB H
+static int jit_op_094 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sub (gb, regs, H); cc += 4; } return cc; }
+// SUB L
+static int jit_op_095 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sub (gb, regs, L); cc += 4; } return cc; }
+// SUB (HL)
+static int jit_op_096 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sub (gb, regs, RAM (HL)); cc += 8; } return cc; }
+// SUB A
+static int jit_op_097 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sub (gb, regs, A); cc += 4; } return cc; }
+// SBC B
+static int jit_op_098 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sbc (gb, regs, B); cc += 4; } return cc; }
+// SBC C
+static int jit_op_099 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sbc (gb, regs, C); cc += 4; } return cc; }
+// SBC D
+static int jit_op_09A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sbc (gb, regs, D); cc += 4; } return cc; }
+// SBC E
+static int jit_op_09B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sbc (gb, regs, E); cc += 4; } return cc; }
+// SBC H
+static int jit_op_09C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sbc (gb, regs, H); cc += 4; } return cc; }
+// SBC L
+static int jit_op_09D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sbc (gb, regs, L); cc += 4; } return cc; }
+// SBC (HL)
+static int jit_op_09E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sbc (gb, regs, RAM (HL)); cc += 8; } return cc; }
+// SBC A
+static int jit_op_09F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sbc (gb, regs, A); cc += 4; } return cc; }
+// AND B
+static int jit_op_0A0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { and (gb, regs, B); cc += 4; } return cc; }
+// AND C
+static int jit_op_0A1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { and (gb, regs, C); cc += 4; } return cc; }
+// AND D
+static int jit_op_0A2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { and (gb, regs, D); cc += 4; } return cc; }
+// AND E
+static int jit_op_0A3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { and (gb, regs, E); cc += 4; } return cc; }
+// AND H
+static int jit_op_0A4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { and (gb, regs, H); cc += 4; } return cc; }
+// AND L
+static int jit_op_0A5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { and (gb, regs, L); cc += 4; } return cc; }
+// AND (HL)
+static int jit_op_0A6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { and (gb, regs, RAM (HL)); cc += 8; } return cc; }
+// AND A
+static int jit_op_0A7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { and (gb, regs, A); cc += 4; } return cc; }
+// XOR B
+static int jit_op_0A8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { xor (gb, regs, B); cc += 4; } return cc; }
+// XOR C
+static int jit_op_0A9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { xor (gb, regs, C); cc += 4; } return cc; }
+// XOR D
+static int jit_op_0AA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { xor (gb, regs, D); cc += 4; } return cc; }
+// XOR E
+static int jit_op_0AB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { xor (gb, regs, E); cc += 4; } return cc; }
+// XOR H
+static int jit_op_0AC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { xor (gb, regs, H); cc += 4; } return cc; }
+// XOR L
+static int jit_op_0AD (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { xor (gb, regs, L); cc += 4; } return cc; }
+// XOR (HL)
+static int jit_op_0AE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { xor (gb, regs, RAM (HL)); cc += 8; } return cc; }
+// XOR A
+static int jit_op_0AF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { xor (gb, regs, A); cc += 4; } return cc; }
+// OR B
+static int jit_op_0B0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { or (gb, regs, B); cc += 4; } return cc; }
+// OR C
+static int jit_op_0B1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { or (gb, regs, C); cc += 4; } return cc; }
+// OR D
+static int jit_op_0B2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { or (gb, regs, D); cc += 4; } return cc; }
+// OR E
+static int jit_op_0B3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { or (gb, regs, E); cc += 4; } return cc; }
+// OR H
+static int jit_op_0B4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { or (gb, regs, H); cc += 4; } return cc; }
+// OR L
+static int jit_op_0B5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { or (gb, regs, L); cc += 4; } return cc; }
+// OR (HL)
+static int jit_op_0B6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { or (gb, regs, RAM (HL)); cc += 8; } return cc; }
+// OR A
+static int jit_op_0B7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { or (gb, regs, A); cc += 4; } return cc; }
+// CP B
+static int jit_op_0B8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cp (gb, regs, B); cc += 4; } return cc; }
+// CP C
+static int jit_op_0B9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cp (gb, regs, C); cc += 4; } return cc; }
+// CP D
+static int jit_op_0BA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cp (gb, regs, D); cc += 4; } return cc; }
+// CP E
+static int jit_op_0BB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cp (gb, regs, E); cc += 4; } return cc; }
+// CP H
+static int jit_op_0BC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cp (gb, regs, H); cc += 4; } return cc; }
+// CP L
+static int jit_op_0BD (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cp (gb, regs, L); cc += 4; } return cc; }
+// CP (HL)
+static int jit_op_0BE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cp (gb, regs, RAM (HL)); cc += 8; } return cc; }
+// CP A
+static int jit_op_0BF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cp (gb, regs, A); cc += 4; } return cc; }
+// RETCC JP_CC_NZ
+static int jit_op_0C0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cc += retcc (gb, regs, JP_CC_NZ); cc += 8; } return cc; }
+// POP BC
+static int jit_op_0C1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { pop (gb, regs, &BC); cc += 12; } return cc; }
+// JPCC JP_CC_NZ,nn
+static int jit_op_0C2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; cc += jpcc (gb, regs, JP_CC_NZ,nn); cc += 12; } return cc; }
+// JP nn
+static int jit_op_0C3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; jp (gb, regs, nn); cc += 16; } return cc; }
+// CALLCC JP_CC_NZ,nn
+static int jit_op_0C4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; cc += callcc (gb, regs, JP_CC_NZ,nn); cc += 12; } return cc; }
+// PUSH BC
+static int jit_op_0C5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { push (gb, regs, BC); cc += 16; } return cc; }
+// ADD n
+static int jit_op_0C6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; add (gb, regs, n); cc += 8; } return cc; }
+// RST 0x00
+static int jit_op_0C7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rst (gb, regs, 0x00); cc += 16; } return cc; }
+// RETCC JP_CC_Z
+static int jit_op_0C8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cc += retcc (gb, regs, JP_CC_Z); cc += 8; } return cc; }
+// RET -/-
+static int jit_op_0C9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { ret (gb, regs); cc += 16; } return cc; }
+// JPCC JP_CC_Z,nn
+static int jit_op_0CA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; cc += jpcc (gb, regs, JP_CC_Z,nn); cc += 12; } return cc; }
+// CALLCC JP_CC_Z,nn
+static int jit_op_0CC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; cc += callcc (gb, regs, JP_CC_Z,nn); cc += 12; } return cc; }
+// CALL nn
+static int jit_op_0CD (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; call (gb, regs, nn); cc += 24; } return cc; }
+// ADC n
+static int jit_op_0CE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; adc (gb, regs, n); cc += 8; } return cc; }
+// RST 0x08
+static int jit_op_0CF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rst (gb, regs, 0x08); cc += 16; } return cc; }
+// RETCC JP_CC_NC
+static int jit_op_0D0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cc += retcc (gb, regs, JP_CC_NC); cc += 8; } return cc; }
+// POP DE
+static int jit_op_0D1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { pop (gb, regs, &DE); cc += 12; } return cc; }
+// JPCC JP_CC_NC,nn
+static int jit_op_0D2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; cc += jpcc (gb, regs, JP_CC_NC,nn); cc += 12; } return cc; }
+// CALLCC JP_CC_NC,nn
+static int jit_op_0D4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; cc += callcc (gb, regs, JP_CC_NC,nn); cc += 12; } return cc; }
+// PUSH DE
+static int jit_op_0D5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { push (gb, regs, DE); cc += 16; } return cc; }
+// SUB n
+static int jit_op_0D6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; sub (gb, regs, n); cc += 8; } return cc; }
+// RST 0x10
+static int jit_op_0D7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rst (gb, regs, 0x10); cc += 16; } return cc; }
+// RETCC JP_CC_C
+static int jit_op_0D8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { cc += retcc (gb, regs, JP_CC_C); cc += 8; } return cc; }
+// RETI -/-
+static int jit_op_0D9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { reti (gb, regs); cc += 16; } return cc; }
+// JPCC JP_CC_C,nn
+static int jit_op_0DA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; cc += jpcc (gb, regs, JP_CC_C,nn); cc += 12; } return cc; }
+// CALLCC JP_CC_C,nn
+static int jit_op_0DC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; cc += callcc (gb, regs, JP_CC_C,nn); cc += 12; } return cc; }
+// SBC n
+static int jit_op_0DE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; sbc (gb, regs, n); cc += 8; } return cc; }
+// RST 0x18
+static int jit_op_0DF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rst (gb, regs, 0x18); cc += 16; } return cc; }
+// LD (n),A
+static int jit_op_0E0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t n = 0xFF00 | IMM8; STORE ((n),A); cc += 12; } return cc; }
+// POP HL
+static int jit_op_0E1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { pop (gb, regs, &HL); cc += 12; } return cc; }
+// LD (C),A
+static int jit_op_0E2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = 0xFF00 | C; STORE ((nn),A); cc += 8; } return cc; }
+// PUSH HL
+static int jit_op_0E5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { push (gb, regs, HL); cc += 16; } return cc; }
+// AND n
+static int jit_op_0E6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; and (gb, regs, n); cc += 8; } return cc; }
+// RST 0x20
+static int jit_op_0E7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rst (gb, regs, 0x20); cc += 16; } return cc; }
+// ADDSP n
+static int jit_op_0E8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; addsp (gb, regs, n); cc += 16; } return cc; }
+// JP HL
+static int jit_op_0E9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { jp (gb, regs, HL); cc += 4; } return cc; }
+// LD (nn),A
+static int jit_op_0EA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; STORE ((nn),A); cc += 16; } return cc; }
+// XOR n
+static int jit_op_0EE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; xor (gb, regs, n); cc += 8; } return cc; }
+// RST 0x28
+static int jit_op_0EF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rst (gb, regs, 0x28); cc += 16; } return cc; }
+// LD A,(n)
+static int jit_op_0F0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t n = 0xFF00 | IMM8; A = RAM (n); cc += 12; } return cc; }
+// POP AF
+static int jit_op_0F1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { pop (gb, regs, &AF); F &= 0xF0; DROP_FLAGS (); cc += 12; } return cc; }
+// LD A,(C)
+static int jit_op_0F2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = 0xFF00 | C; A = RAM (nn); cc += 8; } return cc; }
+// DI -/-
+static int jit_op_0F3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { di (gb, regs); cc += 4; } return cc; }
+// PUSH AF
+static int jit_op_0F5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { SYNC_FLAGS (); push (gb, regs, AF); cc += 16; } return cc; }
+// OR n
+static int jit_op_0F6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; or (gb, regs, n); cc += 8; } return cc; }
+// RST 0x30
+static int jit_op_0F7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rst (gb, regs, 0x30); cc += 16; } return cc; }
+// LDHL n
+static int jit_op_0F8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; ldhl (gb, regs, n); cc += 12; } return cc; }
+// LD SP,HL
+static int jit_op_0F9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { SP = HL; cc += 8; } return cc; }
+// LD A,(nn)
+static int jit_op_0FA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint16_t nn = IMM16; A = RAM (nn); cc += 16; } return cc; }
+// EI -/-
+static int jit_op_0FB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { ei (gb, regs); cc += 4; } return cc; }
+// CP n
+static int jit_op_0FE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = IMM8; cp (gb, regs, n); cc += 8; } return cc; }
+// RST 0x38
+static int jit_op_0FF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rst (gb, regs, 0x38); cc += 16; } return cc; }
+// RLC B
+static int jit_op_100 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rlc (gb, regs, &B); cc += 8; } return cc; }
+// RLC C
+static int jit_op_101 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rlc (gb, regs, &C); cc += 8; } return cc; }
+// RLC D
+static int jit_op_102 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rlc (gb, regs, &D); cc += 8; } return cc; }
+// RLC E
+static int jit_op_103 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rlc (gb, regs, &E); cc += 8; } return cc; }
+// RLC H
+static int jit_op_104 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rlc (gb, regs, &H); cc += 8; } return cc; }
+// RLC L
+static int jit_op_105 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rlc (gb, regs, &L); cc += 8; } return cc; }
+// RLC (HL)
+static int jit_op_106 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); rlc (gb, regs, &n); STORE (HL, n); cc += 16; } return cc; }
+// RLC A
+static int jit_op_107 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rlc (gb, regs, &A); cc += 8; } return cc; }
+// RRC B
+static int jit_op_108 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rrc (gb, regs, &B); cc += 8; } return cc; }
+// RRC C
+static int jit_op_109 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rrc (gb, regs, &C); cc += 8; } return cc; }
+// RRC D
+static int jit_op_10A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rrc (gb, regs, &D); cc += 8; } return cc; }
+// RRC E
+static int jit_op_10B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rrc (gb, regs, &E); cc += 8; } return cc; }
+// RRC H
+static int jit_op_10C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rrc (gb, regs, &H); cc += 8; } return cc; }
+// RRC L
+static int jit_op_10D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rrc (gb, regs, &L); cc += 8; } return cc; }
+// RRC (HL)
+static int jit_op_10E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); rrc (gb, regs, &n); STORE (HL, n); cc += 16; } return cc; }
+// RRC A
+static int jit_op_10F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rrc (gb, regs, &A); cc += 8; } return cc; }
+// RL B
+static int jit_op_110 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rl (gb, regs, &B); cc += 8; } return cc; }
+// RL C
+static int jit_op_111 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rl (gb, regs, &C); cc += 8; } return cc; }
+// RL D
+static int jit_op_112 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rl (gb, regs, &D); cc += 8; } return cc; }
+// RL E
+static int jit_op_113 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rl (gb, regs, &E); cc += 8; } return cc; }
+// RL H
+static int jit_op_114 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rl (gb, regs, &H); cc += 8; } return cc; }
+// RL L
+static int jit_op_115 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rl (gb, regs, &L); cc += 8; } return cc; }
+// RL (HL)
+static int jit_op_116 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); rl (gb, regs, &n); STORE (HL, n); cc += 16; } return cc; }
+// RL A
+static int jit_op_117 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rl (gb, regs, &A); cc += 8; } return cc; }
+// RR B
+static int jit_op_118 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rr (gb, regs, &B); cc += 8; } return cc; }
+// RR C
+static int jit_op_119 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rr (gb, regs, &C); cc += 8; } return cc; }
+// RR D
+static int jit_op_11A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rr (gb, regs, &D); cc += 8; } return cc; }
+// RR E
+static int jit_op_11B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rr (gb, regs, &E); cc += 8; } return cc; }
+// RR H
+static int jit_op_11C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rr (gb, regs, &H); cc += 8; } return cc; }
+// RR L
+static int jit_op_11D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rr (gb, regs, &L); cc += 8; } return cc; }
+// RR (HL)
+static int jit_op_11E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); rr (gb, regs, &n); STORE (HL, n); cc += 16; } return cc; }
+// RR A
+static int jit_op_11F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { rr (gb, regs, &A); cc += 8; } return cc; }
+// SLA B
+static int jit_op_120 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sla (gb, regs, &B); cc += 8; } return cc; }
+// SLA C
+static int jit_op_121 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sla (gb, regs, &C); cc += 8; } return cc; }
+// SLA D
+static int jit_op_122 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sla (gb, regs, &D); cc += 8; } return cc; }
+// SLA E
+static int jit_op_123 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sla (gb, regs, &E); cc += 8; } return cc; }
+// SLA H
+static int jit_op_124 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sla (gb, regs, &H); cc += 8; } return cc; }
+// SLA L
+static int jit_op_125 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sla (gb, regs, &L); cc += 8; } return cc; }
+// SLA (HL)
+static int jit_op_126 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); sla (gb, regs, &n); STORE (HL, n); cc += 16; } return cc; }
+// SLA A
+static int jit_op_127 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sla (gb, regs, &A); cc += 8; } return cc; }
+// SRA B
+static int jit_op_128 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sra (gb, regs, &B); cc += 8; } return cc; }
+// SRA C
+static int jit_op_129 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sra (gb, regs, &C); cc += 8; } return cc; }
+// SRA D
+static int jit_op_12A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sra (gb, regs, &D); cc += 8; } return cc; }
+// SRA E
+static int jit_op_12B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sra (gb, regs, &E); cc += 8; } return cc; }
+// SRA H
+static int jit_op_12C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sra (gb, regs, &H); cc += 8; } return cc; }
+// SRA L
+static int jit_op_12D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sra (gb, regs, &L); cc += 8; } return cc; }
+// SRA (HL)
+static int jit_op_12E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); sra (gb, regs, &n); STORE (HL, n); cc += 16; } return cc; }
+// SRA A
+static int jit_op_12F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { sra (gb, regs, &A); cc += 8; } return cc; }
+// SWAP B
+static int jit_op_130 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { swap (gb, regs, &B); cc += 8; } return cc; }
+// SWAP C
+static int jit_op_131 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { swap (gb, regs, &C); cc += 8; } return cc; }
+// SWAP D
+static int jit_op_132 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { swap (gb, regs, &D); cc += 8; } return cc; }
+// SWAP E
+static int jit_op_133 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { swap (gb, regs, &E); cc += 8; } return cc; }
+// SWAP H
+static int jit_op_134 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { swap (gb, regs, &H); cc += 8; } return cc; }
+// SWAP L
+static int jit_op_135 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { swap (gb, regs, &L); cc += 8; } return cc; }
+// SWAP (HL)
+static int jit_op_136 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); swap (gb, regs, &n); STORE (HL, n); cc += 16; } return cc; }
+// SWAP A
+static int jit_op_137 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { swap (gb, regs, &A); cc += 8; } return cc; }
+// SRL B
+static int jit_op_138 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { srl (gb, regs, &B); cc += 8; } return cc; }
+// SRL C
+static int jit_op_139 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { srl (gb, regs, &C); cc += 8; } return cc; }
+// SRL D
+static int jit_op_13A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { srl (gb, regs, &D); cc += 8; } return cc; }
+// SRL E
+static int jit_op_13B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { srl (gb, regs, &E); cc += 8; } return cc; }
+// SRL H
+static int jit_op_13C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { srl (gb, regs, &H); cc += 8; } return cc; }
+// SRL L
+static int jit_op_13D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { srl (gb, regs, &L); cc += 8; } return cc; }
+// SRL (HL)
+static int jit_op_13E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); srl (gb, regs, &n); STORE (HL, n); cc += 16; } return cc; }
+// SRL A
+static int jit_op_13F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { srl (gb, regs, &A); cc += 8; } return cc; }
+// BIT B,0
+static int jit_op_140 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, B,0); cc += 8; } return cc; }
+// BIT C,0
+static int jit_op_141 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, C,0); cc += 8; } return cc; }
+// BIT D,0
+static int jit_op_142 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, D,0); cc += 8; } return cc; }
+// BIT E,0
+static int jit_op_143 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, E,0); cc += 8; } return cc; }
+// BIT H,0
+static int jit_op_144 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, H,0); cc += 8; } return cc; }
+// BIT L,0
+static int jit_op_145 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, L,0); cc += 8; } return cc; }
+// BIT (HL),0
+static int jit_op_146 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, RAM (HL),0); cc += 12; } return cc; }
+// BIT A,0
+static int jit_op_147 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, A,0); cc += 8; } return cc; }
+// BIT B,1
+static int jit_op_148 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, B,1); cc += 8; } return cc; }
+// BIT C,1
+static int jit_op_149 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, C,1); cc += 8; } return cc; }
+// BIT D,1
+static int jit_op_14A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, D,1); cc += 8; } return cc; }
+// BIT E,1
+static int jit_op_14B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, E,1); cc += 8; } return cc; }
+// BIT H,1
+static int jit_op_14C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, H,1); cc += 8; } return cc; }
+// BIT L,1
+static int jit_op_14D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, L,1); cc += 8; } return cc; }
+// BIT (HL),1
+static int jit_op_14E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, RAM (HL),1); cc += 12; } return cc; }
+// BIT A,1
+static int jit_op_14F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, A,1); cc += 8; } return cc; }
+// BIT B,2
+static int jit_op_150 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, B,2); cc += 8; } return cc; }
+// BIT C,2
+static int jit_op_151 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, C,2); cc += 8; } return cc; }
+// BIT D,2
+static int jit_op_152 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, D,2); cc += 8; } return cc; }
+// BIT E,2
+static int jit_op_153 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, E,2); cc += 8; } return cc; }
+// BIT H,2
+static int jit_op_154 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, H,2); cc += 8; } return cc; }
+// BIT L,2
+static int jit_op_155 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, L,2); cc += 8; } return cc; }
+// BIT (HL),2
+static int jit_op_156 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, RAM (HL),2); cc += 12; } return cc; }
+// BIT A,2
+static int jit_op_157 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, A,2); cc += 8; } return cc; }
+// BIT B,3
+static int jit_op_158 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, B,3); cc += 8; } return cc; }
+// BIT C,3
+static int jit_op_159 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, C,3); cc += 8; } return cc; }
+// BIT D,3
+static int jit_op_15A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, D,3); cc += 8; } return cc; }
+// BIT E,3
+static int jit_op_15B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, E,3); cc += 8; } return cc; }
+// BIT H,3
+static int jit_op_15C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, H,3); cc += 8; } return cc; }
+// BIT L,3
+static int jit_op_15D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, L,3); cc += 8; } return cc; }
+// BIT (HL),3
+static int jit_op_15E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, RAM (HL),3); cc += 12; } return cc; }
+// BIT A,3
+static int jit_op_15F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, A,3); cc += 8; } return cc; }
+// BIT B,4
+static int jit_op_160 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, B,4); cc += 8; } return cc; }
+// BIT C,4
+static int jit_op_161 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, C,4); cc += 8; } return cc; }
+// BIT D,4
+static int jit_op_162 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, D,4); cc += 8; } return cc; }
+// BIT E,4
+static int jit_op_163 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, E,4); cc += 8; } return cc; }
+// BIT H,4
+static int jit_op_164 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, H,4); cc += 8; } return cc; }
+// BIT L,4
+static int jit_op_165 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, L,4); cc += 8; } return cc; }
+// BIT (HL),4
+static int jit_op_166 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, RAM (HL),4); cc += 12; } return cc; }
+// BIT A,4
+static int jit_op_167 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, A,4); cc += 8; } return cc; }
+// BIT B,5
+static int jit_op_168 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, B,5); cc += 8; } return cc; }
+// BIT C,5
+static int jit_op_169 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, C,5); cc += 8; } return cc; }
+// BIT D,5
+static int jit_op_16A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, D,5); cc += 8; } return cc; }
+// BIT E,5
+static int jit_op_16B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, E,5); cc += 8; } return cc; }
+// BIT H,5
+static int jit_op_16C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, H,5); cc += 8; } return cc; }
+// BIT L,5
+static int jit_op_16D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, L,5); cc += 8; } return cc; }
+// BIT (HL),5
+static int jit_op_16E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, RAM (HL),5); cc += 12; } return cc; }
+// BIT A,5
+static int jit_op_16F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, A,5); cc += 8; } return cc; }
+// BIT B,6
+static int jit_op_170 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, B,6); cc += 8; } return cc; }
+// BIT C,6
+static int jit_op_171 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, C,6); cc += 8; } return cc; }
+// BIT D,6
+static int jit_op_172 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, D,6); cc += 8; } return cc; }
+// BIT E,6
+static int jit_op_173 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, E,6); cc += 8; } return cc; }
+// BIT H,6
+static int jit_op_174 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, H,6); cc += 8; } return cc; }
+// BIT L,6
+static int jit_op_175 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, L,6); cc += 8; } return cc; }
+// BIT (HL),6
+static int jit_op_176 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, RAM (HL),6); cc += 12; } return cc; }
+// BIT A,6
+static int jit_op_177 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, A,6); cc += 8; } return cc; }
+// BIT B,7
+static int jit_op_178 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, B,7); cc += 8; } return cc; }
+// BIT C,7
+static int jit_op_179 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, C,7); cc += 8; } return cc; }
+// BIT D,7
+static int jit_op_17A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, D,7); cc += 8; } return cc; }
+// BIT E,7
+static int jit_op_17B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, E,7); cc += 8; } return cc; }
+// BIT H,7
+static int jit_op_17C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, H,7); cc += 8; } return cc; }
+// BIT L,7
+static int jit_op_17D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, L,7); cc += 8; } return cc; }
+// BIT (HL),7
+static int jit_op_17E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, RAM (HL),7); cc += 12; } return cc; }
+// BIT A,7
+static int jit_op_17F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { bit (gb, regs, A,7); cc += 8; } return cc; }
+// RES B,0
+static int jit_op_180 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &B,0); cc += 8; } return cc; }
+// RES C,0
+static int jit_op_181 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &C,0); cc += 8; } return cc; }
+// RES D,0
+static int jit_op_182 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &D,0); cc += 8; } return cc; }
+// RES E,0
+static int jit_op_183 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &E,0); cc += 8; } return cc; }
+// RES H,0
+static int jit_op_184 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &H,0); cc += 8; } return cc; }
+// RES L,0
+static int jit_op_185 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &L,0); cc += 8; } return cc; }
+// RES (HL),0
+static int jit_op_186 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); res (gb, regs, &n,0); STORE (HL, n); cc += 16; } return cc; }
+// RES A,0
+static int jit_op_187 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &A,0); cc += 8; } return cc; }
+// RES B,1
+static int jit_op_188 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &B,1); cc += 8; } return cc; }
+// RES C,1
+static int jit_op_189 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &C,1); cc += 8; } return cc; }
+// RES D,1
+static int jit_op_18A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &D,1); cc += 8; } return cc; }
+// RES E,1
+static int jit_op_18B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &E,1); cc += 8; } return cc; }
+// RES H,1
+static int jit_op_18C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &H,1); cc += 8; } return cc; }
+// RES L,1
+static int jit_op_18D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &L,1); cc += 8; } return cc; }
+// RES (HL),1
+static int jit_op_18E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); res (gb, regs, &n,1); STORE (HL, n); cc += 16; } return cc; }
+// RES A,1
+static int jit_op_18F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &A,1); cc += 8; } return cc; }
+// RES B,2
+static int jit_op_190 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &B,2); cc += 8; } return cc; }
+// RES C,2
+static int jit_op_191 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &C,2); cc += 8; } return cc; }
+// RES D,2
+static int jit_op_192 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &D,2); cc += 8; } return cc; }
+// RES E,2
+static int jit_op_193 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &E,2); cc += 8; } return cc; }
+// RES H,2
+static int jit_op_194 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &H,2); cc += 8; } return cc; }
+// RES L,2
+static int jit_op_195 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &L,2); cc += 8; } return cc; }
+// RES (HL),2
+static int jit_op_196 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); res (gb, regs, &n,2); STORE (HL, n); cc += 16; } return cc; }
+// RES A,2
+static int jit_op_197 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &A,2); cc += 8; } return cc; }
+// RES B,3
+static int jit_op_198 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &B,3); cc += 8; } return cc; }
+// RES C,3
+static int jit_op_199 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &C,3); cc += 8; } return cc; }
+// RES D,3
+static int jit_op_19A (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &D,3); cc += 8; } return cc; }
+// RES E,3
+static int jit_op_19B (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &E,3); cc += 8; } return cc; }
+// RES H,3
+static int jit_op_19C (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &H,3); cc += 8; } return cc; }
+// RES L,3
+static int jit_op_19D (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &L,3); cc += 8; } return cc; }
+// RES (HL),3
+static int jit_op_19E (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); res (gb, regs, &n,3); STORE (HL, n); cc += 16; } return cc; }
+// RES A,3
+static int jit_op_19F (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &A,3); cc += 8; } return cc; }
+// RES B,4
+static int jit_op_1A0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &B,4); cc += 8; } return cc; }
+// RES C,4
+static int jit_op_1A1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &C,4); cc += 8; } return cc; }
+// RES D,4
+static int jit_op_1A2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &D,4); cc += 8; } return cc; }
+// RES E,4
+static int jit_op_1A3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &E,4); cc += 8; } return cc; }
+// RES H,4
+static int jit_op_1A4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &H,4); cc += 8; } return cc; }
+// RES L,4
+static int jit_op_1A5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &L,4); cc += 8; } return cc; }
+// RES (HL),4
+static int jit_op_1A6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); res (gb, regs, &n,4); STORE (HL, n); cc += 16; } return cc; }
+// RES A,4
+static int jit_op_1A7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &A,4); cc += 8; } return cc; }
+// RES B,5
+static int jit_op_1A8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &B,5); cc += 8; } return cc; }
+// RES C,5
+static int jit_op_1A9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &C,5); cc += 8; } return cc; }
+// RES D,5
+static int jit_op_1AA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &D,5); cc += 8; } return cc; }
+// RES E,5
+static int jit_op_1AB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &E,5); cc += 8; } return cc; }
+// RES H,5
+static int jit_op_1AC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &H,5); cc += 8; } return cc; }
+// RES L,5
+static int jit_op_1AD (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &L,5); cc += 8; } return cc; }
+// RES (HL),5
+static int jit_op_1AE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); res (gb, regs, &n,5); STORE (HL, n); cc += 16; } return cc; }
+// RES A,5
+static int jit_op_1AF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &A,5); cc += 8; } return cc; }
+// RES B,6
+static int jit_op_1B0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &B,6); cc += 8; } return cc; }
+// RES C,6
+static int jit_op_1B1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &C,6); cc += 8; } return cc; }
+// RES D,6
+static int jit_op_1B2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &D,6); cc += 8; } return cc; }
+// RES E,6
+static int jit_op_1B3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &E,6); cc += 8; } return cc; }
+// RES H,6
+static int jit_op_1B4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &H,6); cc += 8; } return cc; }
+// RES L,6
+static int jit_op_1B5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &L,6); cc += 8; } return cc; }
+// RES (HL),6
+static int jit_op_1B6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); res (gb, regs, &n,6); STORE (HL, n); cc += 16; } return cc; }
+// RES A,6
+static int jit_op_1B7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &A,6); cc += 8; } return cc; }
+// RES B,7
+static int jit_op_1B8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &B,7); cc += 8; } return cc; }
+// RES C,7
+static int jit_op_1B9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &C,7); cc += 8; } return cc; }
+// RES D,7
+static int jit_op_1BA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &D,7); cc += 8; } return cc; }
+// RES E,7
+static int jit_op_1BB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &E,7); cc += 8; } return cc; }
+// RES H,7
+static int jit_op_1BC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &H,7); cc += 8; } return cc; }
+// RES L,7
+static int jit_op_1BD (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &L,7); cc += 8; } return cc; }
+// RES (HL),7
+static int jit_op_1BE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); res (gb, regs, &n,7); STORE (HL, n); cc += 16; } return cc; }
+// RES A,7
+static int jit_op_1BF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { res (gb, regs, &A,7); cc += 8; } return cc; }
+// SET B,0
+static int jit_op_1C0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &B,0); cc += 8; } return cc; }
+// SET C,0
+static int jit_op_1C1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &C,0); cc += 8; } return cc; }
+// SET D,0
+static int jit_op_1C2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &D,0); cc += 8; } return cc; }
+// SET E,0
+static int jit_op_1C3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &E,0); cc += 8; } return cc; }
+// SET H,0
+static int jit_op_1C4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &H,0); cc += 8; } return cc; }
+// SET L,0
+static int jit_op_1C5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &L,0); cc += 8; } return cc; }
+// SET (HL),0
+static int jit_op_1C6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); set (gb, regs, &n,0); STORE (HL, n); cc += 16; } return cc; }
+// SET A,0
+static int jit_op_1C7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &A,0); cc += 8; } return cc; }
+// SET B,1
+static int jit_op_1C8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &B,1); cc += 8; } return cc; }
+// SET C,1
+static int jit_op_1C9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &C,1); cc += 8; } return cc; }
+// SET D,1
+static int jit_op_1CA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &D,1); cc += 8; } return cc; }
+// SET E,1
+static int jit_op_1CB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &E,1); cc += 8; } return cc; }
+// SET H,1
+static int jit_op_1CC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &H,1); cc += 8; } return cc; }
+// SET L,1
+static int jit_op_1CD (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &L,1); cc += 8; } return cc; }
+// SET (HL),1
+static int jit_op_1CE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); set (gb, regs, &n,1); STORE (HL, n); cc += 16; } return cc; }
+// SET A,1
+static int jit_op_1CF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &A,1); cc += 8; } return cc; }
+// SET B,2
+static int jit_op_1D0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &B,2); cc += 8; } return cc; }
+// SET C,2
+static int jit_op_1D1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &C,2); cc += 8; } return cc; }
+// SET D,2
+static int jit_op_1D2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &D,2); cc += 8; } return cc; }
+// SET E,2
+static int jit_op_1D3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &E,2); cc += 8; } return cc; }
+// SET H,2
+static int jit_op_1D4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &H,2); cc += 8; } return cc; }
+// SET L,2
+static int jit_op_1D5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &L,2); cc += 8; } return cc; }
+// SET (HL),2
+static int jit_op_1D6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); set (gb, regs, &n,2); STORE (HL, n); cc += 16; } return cc; }
+// SET A,2
+static int jit_op_1D7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &A,2); cc += 8; } return cc; }
+// SET B,3
+static int jit_op_1D8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &B,3); cc += 8; } return cc; }
+// SET C,3
+static int jit_op_1D9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &C,3); cc += 8; } return cc; }
+// SET D,3
+static int jit_op_1DA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &D,3); cc += 8; } return cc; }
+// SET E,3
+static int jit_op_1DB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &E,3); cc += 8; } return cc; }
+// SET H,3
+static int jit_op_1DC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &H,3); cc += 8; } return cc; }
+// SET L,3
+static int jit_op_1DD (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &L,3); cc += 8; } return cc; }
+// SET (HL),3
+static int jit_op_1DE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); set (gb, regs, &n,3); STORE (HL, n); cc += 16; } return cc; }
+// SET A,3
+static int jit_op_1DF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &A,3); cc += 8; } return cc; }
+// SET B,4
+static int jit_op_1E0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &B,4); cc += 8; } return cc; }
+// SET C,4
+static int jit_op_1E1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &C,4); cc += 8; } return cc; }
+// SET D,4
+static int jit_op_1E2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &D,4); cc += 8; } return cc; }
+// SET E,4
+static int jit_op_1E3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &E,4); cc += 8; } return cc; }
+// SET H,4
+static int jit_op_1E4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &H,4); cc += 8; } return cc; }
+// SET L,4
+static int jit_op_1E5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &L,4); cc += 8; } return cc; }
+// SET (HL),4
+static int jit_op_1E6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); set (gb, regs, &n,4); STORE (HL, n); cc += 16; } return cc; }
+// SET A,4
+static int jit_op_1E7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &A,4); cc += 8; } return cc; }
+// SET B,5
+static int jit_op_1E8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &B,5); cc += 8; } return cc; }
+// SET C,5
+static int jit_op_1E9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &C,5); cc += 8; } return cc; }
+// SET D,5
+static int jit_op_1EA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &D,5); cc += 8; } return cc; }
+// SET E,5
+static int jit_op_1EB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &E,5); cc += 8; } return cc; }
+// SET H,5
+static int jit_op_1EC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &H,5); cc += 8; } return cc; }
+// SET L,5
+static int jit_op_1ED (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &L,5); cc += 8; } return cc; }
+// SET (HL),5
+static int jit_op_1EE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); set (gb, regs, &n,5); STORE (HL, n); cc += 16; } return cc; }
+// SET A,5
+static int jit_op_1EF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &A,5); cc += 8; } return cc; }
+// SET B,6
+static int jit_op_1F0 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &B,6); cc += 8; } return cc; }
+// SET C,6
+static int jit_op_1F1 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &C,6); cc += 8; } return cc; }
+// SET D,6
+static int jit_op_1F2 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &D,6); cc += 8; } return cc; }
+// SET E,6
+static int jit_op_1F3 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &E,6); cc += 8; } return cc; }
+// SET H,6
+static int jit_op_1F4 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &H,6); cc += 8; } return cc; }
+// SET L,6
+static int jit_op_1F5 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &L,6); cc += 8; } return cc; }
+// SET (HL),6
+static int jit_op_1F6 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); set (gb, regs, &n,6); STORE (HL, n); cc += 16; } return cc; }
+// SET A,6
+static int jit_op_1F7 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &A,6); cc += 8; } return cc; }
+// SET B,7
+static int jit_op_1F8 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &B,7); cc += 8; } return cc; }
+// SET C,7
+static int jit_op_1F9 (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &C,7); cc += 8; } return cc; }
+// SET D,7
+static int jit_op_1FA (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &D,7); cc += 8; } return cc; }
+// SET E,7
+static int jit_op_1FB (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &E,7); cc += 8; } return cc; }
+// SET H,7
+static int jit_op_1FC (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &H,7); cc += 8; } return cc; }
+// SET L,7
+static int jit_op_1FD (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &L,7); cc += 8; } return cc; }
+// SET (HL),7
+static int jit_op_1FE (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { uint8_t n = RAM (HL); set (gb, regs, &n,7); STORE (HL, n); cc += 16; } return cc; }
+// SET A,7
+static int jit_op_1FF (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; { set (gb, regs, &A,7); cc += 8; } return cc; }
+// INVALID
+static int jit_op_invalid (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { fprintf (stderr, "$%.4X: INVALID OPERATION\n", PC); return 0; }
+
+const gb_jit_op jit_operations[0x200] = {
+	jit_op_000, jit_op_001, jit_op_002, jit_op_003, jit_op_004, jit_op_005, jit_op_006, jit_op_007,
+	jit_op_008, jit_op_009, jit_op_00A, jit_op_00B, jit_op_00C, jit_op_00D, jit_op_00E, jit_op_00F,
+	jit_op_010, jit_op_011, jit_op_012, jit_op_013, jit_op_014, jit_op_015, jit_op_016, jit_op_017,
+	jit_op_018, jit_op_019, jit_op_01A, jit_op_01B, jit_op_01C, jit_op_01D, jit_op_01E, jit_op_01F,
+	jit_op_020, jit_op_021, jit_op_022, jit_op_023, jit_op_024, jit_op_025, jit_op_026, jit_op_027,
+	jit_op_028, jit_op_029, jit_op_02A, jit_op_02B, jit_op_02C, jit_op_02D, jit_op_02E, jit_op_02F,
+	jit_op_030, jit_op_031, jit_op_032, jit_op_033, jit_op_034, jit_op_035, jit_op_036, jit_op_037,
+	jit_op_038, jit_op_039, jit_op_03A, jit_op_03B, jit_op_03C, jit_op_03D, jit_op_03E, jit_op_03F,
+	jit_op_040, jit_op_041, jit_op_042, jit_op_043, jit_op_044, jit_op_045, jit_op_046, jit_op_047,
+	jit_op_048, jit_op_049, jit_op_04A, jit_op_04B, jit_op_04C, jit_op_04D, jit_op_04E, jit_op_04F,
+	jit_op_050, jit_op_051, jit_op_052, jit_op_053, jit_op_054, jit_op_055, jit_op_056, jit_op_057,
+	jit_op_058, jit_op_059, jit_op_05A, jit_op_05B, jit_op_05C, jit_op_05D, jit_op_05E, jit_op_05F,
+	jit_op_060, jit_op_061, jit_op_062, jit_op_063, jit_op_064, jit_op_065, jit_op_066, jit_op_067,
+	jit_op_068, jit_op_069, jit_op_06A, jit_op_06B, jit_op_06C, jit_op_06D, jit_op_06E, jit_op_06F,
+	jit_op_070, jit_op_071, jit_op_072, jit_op_073, jit_op_074, jit_op_075, jit_op_076, jit_op_077,
+	jit_op_078, jit_op_079, jit_op_07A, jit_op_07B, jit_op_07C, jit_op_07D, jit_op_07E, jit_op_07F,
+	jit_op_080, jit_op_081, jit_op_082, jit_op_083, jit_op_084, jit_op_085, jit_op_086, jit_op_087,
+	jit_op_088, jit_op_089, jit_op_08A, jit_op_08B, jit_op_08C, jit_op_08D, jit_op_08E, jit_op_08F,
+	jit_op_090, jit_op_091, jit_op_092, jit_op_093, jit_op_094, jit_op_095, jit_op_096, jit_op_097,
+	jit_op_098, jit_op_099, jit_op_09A, jit_op_09B, jit_op_09C, jit_op_09D, jit_op_09E, jit_op_09F,
+	jit_op_0A0, jit_op_0A1, jit_op_0A2, jit_op_0A3, jit_op_0A4, jit_op_0A5, jit_op_0A6, jit_op_0A7,
+	jit_op_0A8, jit_op_0A9, jit_op_0AA, jit_op_0AB, jit_op_0AC, jit_op_0AD, jit_op_0AE, jit_op_0AF,
+	jit_op_0B0, jit_op_0B1, jit_op_0B2, jit_op_0B3, jit_op_0B4, jit_op_0B5, jit_op_0B6, jit_op_0B7,
+	jit_op_0B8, jit_op_0B9, jit_op_0BA, jit_op_0BB, jit_op_0BC, jit_op_0BD, jit_op_0BE, jit_op_0BF,
+	jit_op_0C0, jit_op_0C1, jit_op_0C2, jit_op_0C3, jit_op_0C4, jit_op_0C5, jit_op_0C6, jit_op_0C7,
+	jit_op_0C8, jit_op_0C9, jit_op_0CA, jit_op_invalid, jit_op_0CC, jit_op_0CD, jit_op_0CE, jit_op_0CF,
+	jit_op_0D0, jit_op_0D1, jit_op_0D2, jit_op_invalid, jit_op_0D4, jit_op_0D5, jit_op_0D6, jit_op_0D7,
+	jit_op_0D8, jit_op_0D9, jit_op_0DA, jit_op_invalid, jit_op_0DC, jit_op_invalid, jit_op_0DE, jit_op_0DF,
+	jit_op_0E0, jit_op_0E1, jit_op_0E2, jit_op_invalid, jit_op_invalid, jit_op_0E5, jit_op_0E6, jit_op_0E7,
+	jit_op_0E8, jit_op_0E9, jit_op_0EA, jit_op_invalid, jit_op_invalid, jit_op_invalid, jit_op_0EE, jit_op_0EF,
+	jit_op_0F0, jit_op_0F1, jit_op_0F2, jit_op_0F3, jit_op_invalid, jit_op_0F5, jit_op_0F6, jit_op_0F7,
+	jit_op_0F8, jit_op_0F9, jit_op_0FA, jit_op_0FB, jit_op_invalid, jit_op_invalid, jit_op_0FE, jit_op_0FF,
+	jit_op_100, jit_op_101, jit_op_102, jit_op_103, jit_op_104, jit_op_105, jit_op_106, jit_op_107,
+	jit_op_108, jit_op_109, jit_op_10A, jit_op_10B, jit_op_10C, jit_op_10D, jit_op_10E, jit_op_10F,
+	jit_op_110, jit_op_111, jit_op_112, jit_op_113, jit_op_114, jit_op_115, jit_op_116, jit_op_117,
+	jit_op_118, jit_op_119, jit_op_11A, jit_op_11B, jit_op_11C, jit_op_11D, jit_op_11E, jit_op_11F,
+	jit_op_120, jit_op_121, jit_op_122, jit_op_123, jit_op_124, jit_op_125, jit_op_126, jit_op_127,
+	jit_op_128, jit_op_129, jit_op_12A, jit_op_12B, jit_op_12C, jit_op_12D, jit_op_12E, jit_op_12F,
+	jit_op_130, jit_op_131, jit_op_132, jit_op_133, jit_op_134, jit_op_135, jit_op_136, jit_op_137,
+	jit_op_138, jit_op_139, jit_op_13A, jit_op_13B, jit_op_13C, jit_op_13D, jit_op_13E, jit_op_13F,
+	jit_op_140, jit_op_141, jit_op_142, jit_op_143, jit_op_144, jit_op_145, jit_op_146, jit_op_147,
+	jit_op_148, jit_op_149, jit_op_14A, jit_op_14B, jit_op_14C, jit_op_14D, jit_op_14E, jit_op_14F,
+	jit_op_150, jit_op_151, jit_op_152, jit_op_153, jit_op_154, jit_op_155, jit_op_156, jit_op_157,
+	jit_op_158, jit_op_159, jit_op_15A, jit_op_15B, jit_op_15C, jit_op_15D, jit_op_15E, jit_op_15F,
+	jit_op_160, jit_op_161, jit_op_162, jit_op_163, jit_op_164, jit_op_165, jit_op_166, jit_op_167,
+	jit_op_168, jit_op_169, jit_op_16A, jit_op_16B, jit_op_16C, jit_op_16D, jit_op_16E, jit_op_16F,
+	jit_op_170, jit_op_171, jit_op_172, jit_op_173, jit_op_174, jit_op_175, jit_op_176, jit_op_177,
+	jit_op_178, jit_op_179, jit_op_17A, jit_op_17B, jit_op_17C, jit_op_17D, jit_op_17E, jit_op_17F,
+	jit_op_180, jit_op_181, jit_op_182, jit_op_183, jit_op_184, jit_op_185, jit_op_186, jit_op_187,
+	jit_op_188, jit_op_189, jit_op_18A, jit_op_18B, jit_op_18C, jit_op_18D, jit_op_18E, jit_op_18F,
+	jit_op_190, jit_op_191, jit_op_192, jit_op_193, jit_op_194, jit_op_195, jit_op_196, jit_op_197,
+	jit_op_198, jit_op_199, jit_op_19A, jit_op_19B, jit_op_19C, jit_op_19D, jit_op_19E, jit_op_19F,
+	jit_op_1A0, jit_op_1A1, jit_op_1A2, jit_op_1A3, jit_op_1A4, jit_op_1A5, jit_op_1A6, jit_op_1A7,
+	jit_op_1A8, jit_op_1A9, jit_op_1AA, jit_op_1AB, jit_op_1AC, jit_op_1AD, jit_op_1AE, jit_op_1AF,
+	jit_op_1B0, jit_op_1B1, jit_op_1B2, jit_op_1B3, jit_op_1B4, jit_op_1B5, jit_op_1B6, jit_op_1B7,
+	jit_op_1B8, jit_op_1B9, jit_op_1BA, jit_op_1BB, jit_op_1BC, jit_op_1BD, jit_op_1BE, jit_op_1BF,
+	jit_op_1C0, jit_op_1C1, jit_op_1C2, jit_op_1C3, jit_op_1C4, jit_op_1C5, jit_op_1C6, jit_op_1C7,
+	jit_op_1C8, jit_op_1C9, jit_op_1CA, jit_op_1CB, jit_op_1CC, jit_op_1CD, jit_op_1CE, jit_op_1CF,
+	jit_op_1D0, jit_op_1D1, jit_op_1D2, jit_op_1D3, jit_op_1D4, jit_op_1D5, jit_op_1D6, jit_op_1D7,
+	jit_op_1D8, jit_op_1D9, jit_op_1DA, jit_op_1DB, jit_op_1DC, jit_op_1DD, jit_op_1DE, jit_op_1DF,
+	jit_op_1E0, jit_op_1E1, jit_op_1E2, jit_op_1E3, jit_op_1E4, jit_op_1E5, jit_op_1E6, jit_op_1E7,
+	jit_op_1E8, jit_op_1E9, jit_op_1EA, jit_op_1EB, jit_op_1EC, jit_op_1ED, jit_op_1EE, jit_op_1EF,
+	jit_op_1F0, jit_op_1F1, jit_op_1F2, jit_op_1F3, jit_op_1F4, jit_op_1F5, jit_op_1F6, jit_op_1F7,
+	jit_op_1F8, jit_op_1F9, jit_op_1FA, jit_op_1FB, jit_op_1FC, jit_op_1FD, jit_op_1FE, jit_op_1FF,
+};
+
+#undef IMM8
+#undef IMM16
 #endif
@@ -1,6 +1,7 @@
 #ifndef GB_PPU
 #define GB_PPU
 
+#include "gb.h"
 #include <stdint.h>
 
 /**
@@ -8,10 +9,79 @@
  */
 #define VRAM_LOC 0x8000
 
+#define GB_PPU_NPIXELS 23040  // width * height
+#define GB_PPU_SPRITES_PER_LINE 10
+
+/**
+ * PPU state.
+ *
+ * The LCD registers live in CPU RAM, these are pointers to them.
+ */
+typedef
+struct ppu
+{
+	/* Dot counter within scanline. */
+	uint32_t dot;
+
+	/* CPU cycle up to which the PPU has been stepped. */
+	uint64_t cc;
+
+	/* Registers */
+	uint8_t *scy;
+	uint8_t *scx;
+	uint8_t *ly;
+	uint8_t *lyc;
+	uint8_t *wy;
+	uint8_t *wx;
+	uint8_t *bgp;
+	uint8_t *obp0;
+	uint8_t *obp1;
+	uint8_t *lcdc;
+	uint8_t *status;
+
+	/* OAM data pointer */
+	uint8_t *oam;
+
+	/* VRAM, points to the current bank. */
+	uint8_t *vram;
+
+	/* VRAM banks */
+	uint8_t *vram_bank0;  // this one points to mem $8000-$9FFF
+	uint8_t vram_bank1[0x2000];
+
+	/* CGB registers */
+	uint8_t *vbk;
+	uint8_t *bcps;
+	uint8_t *ocps;
+
+	/* CGB color palettes. */
+	uint8_t cram_bg[64];
+	uint8_t cram_obj[64];
+
+	/* Indices of the sprites that are visible on this line. */
+	uint8_t line_sprites[GB_PPU_SPRITES_PER_LINE + 1];
+
+	/* switchable screen buffer for rendering. */
+	uint16_t *lcd, *lcd_buf;
+	uint16_t lcd_1[GB_PPU_NPIXELS];
+	uint16_t lcd_2[GB_PPU_NPIXELS];
+
+	/* functions that differ between DMG and CGB mode. */
+	void (*draw) (gb_t *, int, int);
+	void (*bg_tile_row) (gb_t *, uint8_t *, uint8_t, uint8_t *, uint8_t *);
+	void (*obj_tile_row) (gb_t *, uint8_t *, uint8_t, uint8_t, uint8_t *, uint8_t *);
+}
+gb_ppu;
+
 /**
  * Step the PPU for a certain number of cycles.
  */
-void gb_ppu_step (uint32_t /* cycles */) ;
+void gb_ppu_step (gb_t *, uint32_t /* cycles */) ;
+
+/**
+ * Step the PPU up to the current CPU cycle.
+ */
+void gb_ppu_sync (gb_t *) ;
 
 /**
  * Reset the PPU.
@@ -19,18 +89,18 @@ void gb_ppu_step (uint32_t /* cycles */) ;
  *
  * Takes as input a flag wether to run in DMG compability mode.
  */
-void gb_ppu_reset (uint8_t /* dmg compatibility mode */) ;
+void gb_ppu_reset (gb_t *, uint8_t /* dmg compatibility mode */) ;
 
 /**
  * Return a pointer to the current buffer being drawn to.
  */
-const uint16_t *gb_ppu_lcd () ;
+const uint16_t *gb_ppu_lcd (gb_t *) ;
 
 /**
  * Stall the PPU for a number of CPU cycles.
  *
  * This is only used during OAM DMA.
  */
-void gb_ppu_stall (uint32_t /* cycles */) ;
+void gb_ppu_stall (gb_t *, uint32_t /* cycles */) ;
 
 #endif
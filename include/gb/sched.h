@@ -0,0 +1,78 @@
+#ifndef GB_SCHED_H
+#define GB_SCHED_H
+
+#include "gb.h"
+#include <stdint.h>
+
+/**
+ * Events that can be scheduled.
+ *
+ * Each kind of event is pending at most once, scheduling it again moves its deadline.
+ */
+typedef
+enum gb_event
+{
+	GB_EVENT_STEP,   // end of the cycles requested by `gb_step`
+	GB_EVENT_PPU,    // next PPU mode change or scanline
+	GB_EVENT_APU,    // next frame sequencer tick
+	GB_EVENT_TIMER,  // next overflow of TIMA
+	GB_EVENT_RTC,    // next second of the MBC3 real time clock
+	GB_EVENT_IRQ,    // an interrupt is pending, the CPU halted or the memory map changed, ends the CPU run
+
+	GB_EVENT_COUNT,
+}
+gb_event;
+
+/* Called when the deadline of an event has been reached. */
+typedef void (* gb_event_handler) (gb_t *) ;
+
+/**
+ * Scheduler state.
+ *
+ * Deadlines are absolute CPU cycles and pending events are kept sorted by them, so
+ * the CPU can run until `next` without checking on the other units.
+ */
+typedef
+struct sched
+{
+	/* Deadline of the earliest pending event. */
+	uint64_t next;
+
+	/* Deadline for each kind of event. */
+	uint64_t at[GB_EVENT_COUNT];
+
+	/* Pending events ordered by deadline. */
+	gb_event queue[GB_EVENT_COUNT];
+	int n;
+
+	gb_event_handler handlers[GB_EVENT_COUNT];
+}
+gb_sched;
+
+/**
+ * Reset the scheduler, removing all pending events and handlers.
+ * Should be done on startup _before_ resetting the other units.
+ */
+void gb_sched_reset (gb_t *) ;
+
+/**
+ * Register the handler to call when an event is due.
+ */
+void gb_sched_register (gb_t *, gb_event, gb_event_handler) ;
+
+/**
+ * Schedule an event at an absolute CPU cycle.
+ */
+void gb_sched_schedule (gb_t *, gb_event, uint64_t /* cycle */) ;
+
+/**
+ * Remove a pending event.
+ */
+void gb_sched_cancel (gb_t *, gb_event) ;
+
+/**
+ * Run the handlers of all the events that are due.
+ */
+void gb_sched_dispatch (gb_t *) ;
+
+#endif /* GB_SCHED_H */
@@ -0,0 +1,343 @@
+#include "gb/aot.h"
+#include "gb/jit.h"
+#include "gb/core.h"
+#include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+
+/* Compiling ------------------------------------------------------------------------ */
+
+/**
+ * Offsets in the ROM that start a block and that have been walked, the banks that the
+ * walked code maps at $4000 and the addresses there jumped to from code that does not
+ * tell which bank is mapped.
+ */
+typedef
+struct walk
+{
+	const uint8_t *rom;
+	uint32_t size;
+	uint8_t *seen;
+	uint32_t *stack;
+	uint32_t n;
+	uint8_t *mapped;
+	uint8_t *unknown;
+}
+walk;
+
+static void push (walk *w, uint32_t off)
+{
+	if (off >= w->size || w->seen[off]) return;
+	w->seen[off] = 1;
+	w->stack[w->n ++] = off;
+}
+
+/**
+ * Push the block at the address jumped to from the ROM offset with `bank` mapped at
+ * $4000, -1 in case the code does not tell. Code in a switchable bank then jumps within
+ * its own bank, code in bank 0 into any of the banks the walk has seen mapped, which is
+ * done once the walk is through, see `push_unknown`.
+ */
+static void push_address (walk *w, uint32_t from, uint16_t adr, int bank)
+{
+	if (bank < 0 && from >= ROM_BANK_SIZE)
+		bank = from / ROM_BANK_SIZE;
+
+	if (adr < ROM_BANK_SIZE)
+		push (w, adr);
+	else if (adr < 2 * ROM_BANK_SIZE && bank >= 0)
+		push (w, bank * ROM_BANK_SIZE + adr - ROM_BANK_SIZE);
+	else if (adr < 2 * ROM_BANK_SIZE)
+		w->unknown[adr - ROM_BANK_SIZE] = 1;
+}
+
+/**
+ * Push the addresses jumped to without a known bank in all banks seen mapped.
+ * Returns non-zero in case there is new code to walk.
+ */
+static int push_unknown (walk *w)
+{
+	for (uint32_t bank = 1; bank < w->size / ROM_BANK_SIZE; bank ++)
+	{
+		if (!w->mapped[bank]) continue;
+		for (uint32_t adr = 0; adr < ROM_BANK_SIZE; adr ++)
+			if (w->unknown[adr]) push (w, bank * ROM_BANK_SIZE + adr);
+	}
+	return w->n > 0;
+}
+
+/**
+ * Registers and bank tracked through a block to tell which bank it maps at $4000, from
+ * constants stored to the MBC at $2000-$3FFF. -1 when not known.
+ */
+typedef
+struct bank_state
+{
+	int a, hl, bank;
+}
+bank_state;
+
+/* MBC5 keeps bit 8 of the bank at $3000-$3FFF and can map bank 0 at $4000. */
+static int is_mbc5 (const walk *w)
+{
+	uint8_t type = w->rom[0x0147];
+	return type >= 0x19 && type <= 0x1E;
+}
+
+/* Track the operation, bank switches are marked mapped in the walk. */
+static void track (walk *w, bank_state *s, const gb_cpu_insn *insn)
+{
+	int adr, v;
+	switch (insn->op)
+	{
+		case 0x3E: s->a = insn->imm & 0xFF; return;           // LD A,n
+		case 0x21: s->hl = insn->imm; return;                 // LD HL,nn
+		case 0xEA: adr = insn->imm; v = s->a; break;          // LD (nn),A
+		case 0x77: adr = s->hl; v = s->a; break;              // LD (HL),A
+		case 0x36: adr = s->hl; v = insn->imm & 0xFF; break;  // LD (HL),n
+		default:
+			s->a = s->hl = s->bank = -1;
+			return;
+	}
+
+	if (adr < 0) s->bank = -1;
+	if (adr < 0x2000 || adr >= 0x4000) return;
+
+	int n_banks = w->size / ROM_BANK_SIZE;
+	if (v < 0)
+		s->bank = -1;
+	else if (is_mbc5 (w) && adr >= 0x3000)
+		s->bank = s->bank < 0 ? -1 : ((s->bank & 0xFF) | (v & 1) << 8) % n_banks;
+	else
+		s->bank = (v || is_mbc5 (w) ? v : 1) % n_banks;
+
+	// bank 0 mapped at $4000 is left to the interpreter
+	if (s->bank == 0) s->bank = -1;
+	if (s->bank > 0) w->mapped[s->bank] = 1;
+}
+
+/* Address of the ROM offset with its bank switched in. */
+static uint16_t address (uint32_t off)
+{
+	return off < ROM_BANK_SIZE ? off : ROM_BANK_SIZE + (off & (ROM_BANK_SIZE - 1));
+}
+
+/**
+ * Decode the block at the ROM offset the same way the CPU does, returns the number of
+ * operations and the offset after them.
+ */
+static int decode (walk *w, uint32_t off, gb_cpu_insn *ops, uint32_t *next)
+{
+	int n = 0, jump = 0;
+	while (n < GB_CPU_BLOCK_OPS && !jump && off + 3 <= w->size)
+	{
+		gb_cpu_insn insn;
+		jump = gb_cpu_decode (w->rom + off, &insn);
+		if ((off & (GB_CPU_PAGE_SIZE - 1)) + insn.len > GB_CPU_PAGE_SIZE) break;
+
+		ops[n ++] = insn;
+		off += insn.len;
+	}
+	*next = off;
+	return n;
+}
+
+/* Follow the operation at the ROM offset to the code it can jump to, see `push_address`. */
+static void follow (walk *w, uint32_t off, const gb_cpu_insn *insn, int bank)
+{
+	uint16_t op = insn->op;
+	if (op >= 0x100) return;
+
+	if ((op & 0xE7) == 0xC2 || op == 0xC3 || (op & 0xE7) == 0xC4 || op == 0xCD) // JP, CALL
+		push_address (w, off, insn->imm, bank);
+	else if ((op & 0xE7) == 0x20 || op == 0x18) // JR
+		push_address (w, off, address (off) + insn->len + (int8_t) insn->imm, bank);
+	else if ((op & 0xC7) == 0xC7) // RST
+		push_address (w, off, op & 0x38, bank);
+}
+
+/* Operations that never go on with the next one. */
+static int ends (uint16_t op)
+{
+	return op == 0xC3 || op == 0x18 || op == 0xC9 || op == 0xD9 || op == 0xE9;
+}
+
+static const char *reg8[8] = { "B", "C", "D", "E", "H", "L", NULL, "A" };
+static const char *reg16[4] = { "BC", "DE", "HL", "SP" };
+
+/* Write the operation as C, operations on registers are written out. */
+static void emit (FILE *f, const gb_cpu_insn *insn)
+{
+	uint16_t op = insn->op;
+
+	fprintf (f, "\tPC += %d; ", insn->len);
+
+	if (op == 0x00) // NOP
+		fprintf (f, "gb->cc += 4;");
+	else if (op >= 0x40 && op < 0x80 && reg8[(op >> 3) & 7] && reg8[op & 7]) // LD r,r'
+		fprintf (f, "%s = %s; gb->cc += 4;", reg8[(op >> 3) & 7], reg8[op & 7]);
+	else if ((op & 0xC7) == 0x06 && op < 0x40 && reg8[(op >> 3) & 7]) // LD r,n
+		fprintf (f, "%s = 0x%.2X; gb->cc += 8;", reg8[(op >> 3) & 7], insn->imm);
+	else if ((op & 0xCF) == 0x01 && op < 0x40) // LD rr,nn
+		fprintf (f, "%s = 0x%.4X; gb->cc += 12;", reg16[op >> 4], insn->imm);
+	else if ((op & 0xCF) == 0x03 && op < 0x40) // INC16 rr
+		fprintf (f, "%s ++; gb->cc += 8;", reg16[op >> 4]);
+	else if ((op & 0xCF) == 0x0B && op < 0x40) // DEC16 rr
+		fprintf (f, "%s --; gb->cc += 8;", reg16[op >> 4]);
+	else
+		fprintf (f, "OP (0x%.3X, 0x%.4X);", op, insn->imm);
+}
+
+int gb_aot_compile (const uint8_t *rom, size_t size, FILE *f)
+{
+	walk w = { rom, size, calloc (size, 1), malloc (size * sizeof (uint32_t)), 0,
+		calloc (size / ROM_BANK_SIZE + 1, 1), calloc (ROM_BANK_SIZE, 1) };
+	if (!w.seen || !w.stack || !w.mapped || !w.unknown)
+	{
+		free (w.seen);
+		free (w.stack);
+		free (w.mapped);
+		free (w.unknown);
+		return 0;
+	}
+
+	// entry point, restarts and interrupt vectors, with bank 1 mapped at $4000
+	w.mapped[1] = 1;
+	push (&w, 0x100);
+	for (uint16_t adr = 0x00; adr <= 0x60; adr += 0x08)
+		push (&w, adr);
+
+	fprintf (f, "/* Blocks of the ROM compiled ahead of time, see gb/aot.h. */\n");
+	fprintf (f, "#include \"gb/aot.h\"\n#include \"gb/jit.h\"\n#include \"gb/core.h\"\n\n");
+	fprintf (f, "#define A (((uint8_t *) &regs->af)[1])\n");
+	fprintf (f, "#define B (((uint8_t *) &regs->bc)[1])\n#define C (((uint8_t *) &regs->bc)[0])\n");
+	fprintf (f, "#define D (((uint8_t *) &regs->de)[1])\n#define E (((uint8_t *) &regs->de)[0])\n");
+	fprintf (f, "#define H (((uint8_t *) &regs->hl)[1])\n#define L (((uint8_t *) &regs->hl)[0])\n");
+	fprintf (f, "#define BC (regs->bc)\n#define DE (regs->de)\n#define HL (regs->hl)\n");
+	fprintf (f, "#define SP (regs->sp)\n#define PC (regs->pc)\n\n");
+	fprintf (f, "/* run an operation through its function and count its cycles. */\n");
+	fprintf (f, "#define OP(op, imm) gb->cc += gb->cpu.aot_ops[op] (gb, regs, imm)\n\n");
+	fprintf (f, "/**\n * return to the interpreter after `n` operations when an event is due, which is\n");
+	fprintf (f, " * also how a bank switch ends the block, see `gb_cpu_map`.\n */\n");
+	fprintf (f, "#define CHECK(n) if (gb->cc >= end || gb->cc >= gb->sched.next) return n\n\n");
+	fprintf (f, "const uint32_t gb_aot_version = GB_AOT_VERSION;\n");
+	fprintf (f, "const uint8_t gb_aot_header[GB_AOT_HEADER_SIZE] = {");
+	for (int i = 0; i < GB_AOT_HEADER_SIZE; i ++)
+		fprintf (f, "%s0x%.2X", i == 0 ? "\n\t" : i % 12 ? ", " : ",\n\t", rom[GB_AOT_HEADER_LOC + i]);
+	fprintf (f, "\n};\n");
+
+	// the blocks are written as they are walked and listed by offset at the end, jumps
+	// into an unknown bank are followed once all banks the code maps have been seen
+	int n_blocks = 0;
+	while (w.n > 0 || push_unknown (&w))
+	{
+		uint32_t off = w.stack[-- w.n], next;
+		gb_cpu_insn ops[GB_CPU_BLOCK_OPS];
+		int n = decode (&w, off, ops, &next);
+
+		if (n == 0)
+		{
+			// an operation that crosses into the next page runs on its own
+			gb_cpu_insn insn;
+			if (off + 3 <= size) push (&w, off + (gb_cpu_decode (rom + off, &insn), insn.len));
+			w.seen[off] = 2;
+			continue;
+		}
+
+		fprintf (f, "\n// $%.4X in bank %d\n", address (off), off / ROM_BANK_SIZE);
+		fprintf (f, "static int b_%.6X (gb_t *gb, gb_cpu_regs *regs, uint64_t end)\n{\n", off);
+		bank_state bank = { -1, -1, -1 };
+		for (int i = 0, o = off; i < n; o += ops[i ++].len)
+		{
+			// the last operation returns anyway, the others check for events and a remap
+			emit (f, &ops[i]);
+			fprintf (f, i < n - 1 ? " CHECK (%d);\n" : "\n", i + 1);
+			follow (&w, o, &ops[i], bank.bank);
+			track (&w, &bank, &ops[i]);
+		}
+		fprintf (f, "\treturn %d;\n}\n", n);
+
+		if (!ends (ops[n - 1].op)) push (&w, next);
+		n_blocks ++;
+	}
+
+	fprintf (f, "\nconst gb_aot_block gb_aot_blocks[] = {\n");
+	for (uint32_t off = 0; off < size; off ++)
+		if (w.seen[off] == 1) fprintf (f, "\t{ 0x%.6X, b_%.6X },\n", off, off);
+	fprintf (f, "};\n\nconst int gb_aot_n_blocks = %d;\n", n_blocks);
+
+	free (w.seen);
+	free (w.stack);
+	free (w.mapped);
+	free (w.unknown);
+	return n_blocks;
+}
+
+/* Loading -------------------------------------------------------------------------- */
+
+int gb_aot_load (gb_t *gb, const char *path)
+{
+	// dlopen looks for names without a directory in the library paths
+	char file[1024];
+	snprintf (file, sizeof (file), "%s%s", strchr (path, '/') ? "" : "./", path);
+
+	void *so = dlopen (file, RTLD_NOW | RTLD_LOCAL);
+	if (!so)
+	{
+		fprintf (stderr, "AOT > %s\n", dlerror ());
+		return 1;
+	}
+
+	const uint32_t *version = dlsym (so, "gb_aot_version");
+	const uint8_t *header = dlsym (so, "gb_aot_header");
+	const gb_aot_block *blocks = dlsym (so, "gb_aot_blocks");
+	const int *n = dlsym (so, "gb_aot_n_blocks");
+
+	if (!version || !header || !blocks || !n || *version != GB_AOT_VERSION ||
+		memcmp (header, gb->cpu.rom + GB_AOT_HEADER_LOC, GB_AOT_HEADER_SIZE) != 0)
+	{
+		fprintf (stderr, "AOT > %s was not compiled from this ROM\n", path);
+		dlclose (so);
+		return 1;
+	}
+
+	gb_aot_quit (gb);
+	gb->cpu.aot = so;
+	gb->cpu.aot_blocks = blocks;
+	gb->cpu.n_aot_blocks = *n;
+	gb->cpu.aot_ops = jit_operations;
+
+	// blocks decoded so far look up their code again
+	gb_cpu_flush (gb);
+	return 0;
+}
+
+gb_cpu_code gb_aot_code (gb_t *gb, const uint8_t *mem)
+{
+	const uint8_t *rom = gb->cpu.rom;
+	if (!gb->cpu.aot || mem < rom || mem >= rom + gb->cpu.n_rom_banks * ROM_BANK_SIZE)
+		return NULL;
+
+	// the blocks are sorted by offset
+	uint32_t off = mem - rom;
+	int lo = 0, hi = gb->cpu.n_aot_blocks;
+	while (lo < hi)
+	{
+		int mid = (lo + hi) / 2;
+		if (gb->cpu.aot_blocks[mid].rom < off) lo = mid + 1;
+		else hi = mid;
+	}
+
+	if (lo < gb->cpu.n_aot_blocks && gb->cpu.aot_blocks[lo].rom == off)
+		return gb->cpu.aot_blocks[lo].code;
+	return NULL;
+}
+
+void gb_aot_quit (gb_t *gb)
+{
+	if (gb->cpu.aot) dlclose (gb->cpu.aot);
+	gb->cpu.aot = NULL;
+	gb->cpu.aot_blocks = NULL;
+	gb->cpu.n_aot_blocks = 0;
+	gb->cpu.aot_ops = NULL;
+}
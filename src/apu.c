@@ -1,32 +1,12 @@
 #include "gb/cpu.h"
 #include "gb/apu.h"
+#include "gb/core.h"
 #include "gb.h"
 #include <stdint.h>
 #include <string.h>
 
 #include <stdio.h>
 
-/**
- * Channel envelope handling volume.
- * Keeps a pointer to the register with the information for the specific envelope.
- */
-typedef
-struct envelope
-{
-	// counter
-	uint8_t cc;
-
-	// register
-	uint8_t *R;
-
-	// enabled flag
-	uint8_t enabled;
-
-	// volume
-	uint8_t vol;
-}
-envelope;
-
 #define ENV_PERIOD(e) ((*e->R) & 0x07)
 #define ENV_INC(e) ((*e->R) & 0x08)
 #define ENV_VOL(e) ((*e->R) >> 4)
@@ -95,7 +75,7 @@ void envelope_init (envelope* e, uint8_t *r)
  * initial freq & X(t-1) is last freq:
  *   X(t) = X(t-1) +/- X(t-1)/2^n`
  */
-static uint8_t *nr10;
+#define nr10 (gb->apu.nr10)
 
 /**
  * FF11 - NR11 - Channel 1 Sound length/Wave pattern duty (R/W)
@@ -112,7 +92,7 @@ static uint8_t *nr10;
  *
  * Sound Length = (64-t1)*(1/256) seconds The Length value is used only if Bit 6 in NR14 is set.
  */
-static uint8_t *nr11;
+#define nr11 (gb->apu.nr11)
 
 /**
  * FF12 - NR12 - Channel 1 Volume Envelope (R/W)
@@ -124,14 +104,14 @@ static uint8_t *nr11;
  *
  * Length of 1 step = n*(1/64) seconds
  */
-static uint8_t *nr12;
+#define nr12 (gb->apu.nr12)
 
 /**
  * FF13 - NR13 - Channel 1 Frequency lo (Write Only)
  *
  * Lower 8 bits of 11 bit frequency (x). Next 3 bit are in NR14 ($FF14)
  */
-static uint8_t *nr13;
+#define nr13 (gb->apu.nr13)
 
 /**
  * FF14 - NR14 - Channel 1 Frequency hi (R/W)
@@ -143,23 +123,23 @@ static uint8_t *nr13;
  *
  * Frequency = 131072/(2048-x) Hz
  */
-static uint8_t *nr14;
+#define nr14 (gb->apu.nr14)
 
 /* FF16 - NR21 - Channel 2 Sound Length/Wave Pattern Duty (R/W) */
-static uint8_t *nr21;
+#define nr21 (gb->apu.nr21)
 /* FF17 - NR22 - Channel 2 Volume Envelope (R/W) */
-static uint8_t *nr22;
+#define nr22 (gb->apu.nr22)
 /* FF18 - NR23 - Channel 2 Frequency lo data (W) */
-static uint8_t *nr23;
+#define nr23 (gb->apu.nr23)
 /* FF19 - NR24 - Channel 2 Frequency hi data (R/W) */
-static uint8_t *nr24;
+#define nr24 (gb->apu.nr24)
 
 /**
  * FF1A - NR30 - Channel 3 Sound on/off (R/W)
  *
  *   Bit 7 - Sound Channel 3 Off  (0=Stop, 1=Playback)  (Read/Write)
  */
-static uint8_t *nr30;
+#define nr30 (gb->apu.nr30)
 
 /**
  * FF1B - NR31 - Channel 3 Sound Length
@@ -168,7 +148,7 @@ static uint8_t *nr30;
  *
  * Sound Length = (256-t1)*(1/256) seconds This value is used only if Bit 6 in NR34 is set.
  */
-static uint8_t *nr31;
+#define nr31 (gb->apu.nr31)
 
 /**
  * FF1C - NR32 - Channel 3 Select output level (R/W)
@@ -181,14 +161,14 @@ static uint8_t *nr31;
  * 2:  50% Volume (Produce Wave Pattern RAM data shifted once to the right)`
  * 3:  25% Volume (Produce Wave Pattern RAM data shifted twice to the right)`
  */
-static uint8_t *nr32;
+#define nr32 (gb->apu.nr32)
 
 /**
  * FF1D - NR33 - Channel 3 Frequency's lower data (W)
  *
  * Lower 8 bits of an 11 bit frequency (x).
  */
-static uint8_t *nr33;
+#define nr33 (gb->apu.nr33)
 
 /**
  * FF1E - NR34 - Channel 3 Frequency's higher data (R/W)
@@ -200,7 +180,7 @@ static uint8_t *nr33;
  *
  * Frequency = 4194304/(64*(2048-x)) Hz = 65536/(2048-x) Hz
  */
-static uint8_t *nr34;
+#define nr34 (gb->apu.nr34)
 
 /**
  * FF30-FF3F - Wave Pattern RAM
@@ -213,7 +193,7 @@ static uint8_t *nr34;
  * On almost all models, the byte will be written at the offset CH3 is currently reading.
  * On GBA, the write will simply be ignored.
  */
-static uint8_t *wav_pat;
+#define wav_pat (gb->apu.wav_pat)
 
 /**
  * FF20 - NR41 - Channel 4 Sound Length (R/W)
@@ -222,7 +202,7 @@ static uint8_t *wav_pat;
  *
  * Sound Length = (64-t1)*(1/256) seconds The Length value is used only if Bit 6 in NR44 is set.
  */
-static uint8_t *nr41;
+#define nr41 (gb->apu.nr41)
 
 /**
  * FF21 - NR42 - Channel 4 Volume Envelope (R/W)
@@ -234,7 +214,7 @@ static uint8_t *nr41;
 
  * Length of 1 step = n*(1/64) seconds
  */
-static uint8_t *nr42;
+#define nr42 (gb->apu.nr42)
 
 /**
  * FF22 - NR43 - Channel 4 Polynomial Counter (R/W)
@@ -249,7 +229,7 @@ static uint8_t *nr42;
  *
  * Frequency = 524288 Hz / r / 2^(s+1) ;For r=0 assume r=0.5 instead
  */
-static uint8_t *nr43;
+#define nr43 (gb->apu.nr43)
 
 /**
  * FF23 - NR44 - Channel 4 Counter/consecutive; Inital (R/W)
@@ -258,7 +238,7 @@ static uint8_t *nr43;
  *   Bit 6   - Counter/consecutive selection (Read/Write)
  *             (1=Stop output when length in NR41 expires)
  */
-static uint8_t *nr44;
+#define nr44 (gb->apu.nr44)
 
 /**
  * FF24 - NR50 - Channel control / ON-OFF / Volume (R/W)
@@ -278,7 +258,7 @@ static uint8_t *nr44;
  *  (Despite rumors, Pocket Music does not use Vin. It blocks use on the GBA for a different reason:
  *  the developer couldn't figure out how to silence buzzing associated with the wave channel's DAC.)
  */
-static uint8_t *nr50;
+#define nr50 (gb->apu.nr50)
 
 /**
  * FF25 - NR51 - Selection of Sound output terminal (R/W)
@@ -294,7 +274,7 @@ static uint8_t *nr50;
  *  Bit 1 - Output sound 2 to SO1 terminal
  *  Bit 0 - Output sound 1 to SO1 terminal
  */
-static uint8_t *nr51;
+#define nr51 (gb->apu.nr51)
 
 /**
  * FF26 - NR52 - Sound on/off
@@ -314,7 +294,7 @@ static uint8_t *nr51;
  * the flag remains set until the sound length has expired (if enabled). A volume envelopes which has
  * decreased to zero volume will NOT cause the sound flag to go off.
  */
-static uint8_t *nr52;
+#define nr52 (gb->apu.nr52)
 
 #define NR10 (* nr10)
 #define NR11 (* nr11)
@@ -345,7 +325,7 @@ static uint8_t *nr52;
 #define APU_OFF (~NR52 & 0x80)
 
 /* Duty patterns. */
-static uint8_t sqr_wav[4] =
+static const uint8_t sqr_wav[4] =
 {
 	0x7F, // _-------
 	0x3F, // __------
@@ -354,13 +334,33 @@ static uint8_t sqr_wav[4] =
 };
 
 #define FREQ(x) ((2048 - x) << 2) // (GB_CPU_CLOCK / (131072 / (2048 - x)))
+
+/**
+ * Step a channel timer n cycles in one go, it counts down and is reloaded with the period
+ * when it reaches zero. The period only changes by register writes or the frame
+ * sequencer which the caller does not step over.
+ *
+ * Returns the number of times the timer reached zero.
+ */
+static inline uint32_t step_timer (int *cc, int period, uint32_t n)
+{
+	if (n < (uint32_t) *cc)
+	{
+		*cc -= n;
+		return 0;
+	}
+
+	n -= *cc;
+	*cc = period - n % period;
+	return 1 + n / period;
+}
 #define SOUNDLEN(t1) (64 - t1) // (64 - t1) * 256 Hz
 #define ENVLEN(n) n // n * 64 Hz
 
 /* Channels ------------------------------------------------- */
 
 /* Flag enabled channels. */
-static uint8_t enabled_ch;
+#define enabled_ch (gb->apu.enabled_ch)
 
 #define ENABLE_CH(c) (enabled_ch |= (1 << (c - 1)))
 #define DISABLE_CH(c) (enabled_ch &= ~(1 << (c - 1)))
@@ -373,26 +373,22 @@ static uint8_t enabled_ch;
 #define CH1LEN SOUNDLEN ((NR11 & 0x3F))
 
 /* Channel 1 timer. */
-static uint16_t ch1_cc;
+#define ch1_cc (gb->apu.ch1_cc)
 
 /* Channel 1 duty counter. */
-static uint8_t ch1_duty_cc;
+#define ch1_duty_cc (gb->apu.ch1_duty_cc)
 
 /* Step Channel 1 timer. */
-static inline void step_timer_ch1 ()
+static inline void step_timer_ch1 (gb_t *gb, uint32_t n)
 {
-	if (-- ch1_cc <= 0)
-	{
-		ch1_cc = CH1FREQ;
-		ch1_duty_cc ++; ch1_duty_cc &= 0x07;
-	}
+	ch1_duty_cc = (ch1_duty_cc + step_timer (&ch1_cc, CH1FREQ, n)) & 0x07;
 }
 
 /* Channel 1 length counter. */
-static uint8_t ch1_len;
+#define ch1_len (gb->apu.ch1_len)
 
 /* Step channel 1 length counter. */
-static inline void step_len_ch1 ()
+static inline void step_len_ch1 (gb_t *gb)
 {
 	if ((~NR14 & 0x40) || !ch1_len)
 		return; // length disabled
@@ -407,9 +403,9 @@ static inline void step_len_ch1 ()
 
 #define SWEEP_OVERFLOW 2047
 
-static uint16_t ch1_shadow;
+#define ch1_shadow (gb->apu.ch1_shadow)
 
-static inline int16_t sweep ()
+static inline int16_t sweep (gb_t *gb)
 {
 	int16_t freq = ch1_shadow >> CH1SWEEP_SHIFT;
 	if (NR10 & 0x08)
@@ -422,10 +418,10 @@ static inline int16_t sweep ()
 	return freq;
 }
 
-static uint8_t ch1_sweep_cc;
+#define ch1_sweep_cc (gb->apu.ch1_sweep_cc)
 
 /* Step channel 1 sweep. */
-static inline void step_sweep_ch1 ()
+static inline void step_sweep_ch1 (gb_t *gb)
 {
 	if (-- ch1_sweep_cc > 0)
 		return;
@@ -436,7 +432,7 @@ static inline void step_sweep_ch1 ()
 
 	if (!CH1SWEEP_ENABLED) return;
 
-	int16_t freq = sweep ();
+	int16_t freq = sweep (gb);
 
 	if (freq <= SWEEP_OVERFLOW)
 	{
@@ -445,12 +441,12 @@ static inline void step_sweep_ch1 ()
 		NR14 = (NR14 & ~0x07) | ((freq >> 8) & 0x07);
 	}
 
-	sweep ();
+	sweep (gb);
 }
 
-static envelope ch1_env;
+#define ch1_env (gb->apu.ch1_env)
 
-static inline uint8_t ch1sample ()
+static inline uint8_t ch1sample (gb_t *gb)
 {
 	if (! ENABLED (1)) return 0;
 	uint8_t s = (CH1DUTY >> ch1_duty_cc) & 1;
@@ -464,26 +460,22 @@ static inline uint8_t ch1sample ()
 #define CH2FREQ FREQ ((((NR24 & 0x07) << 8) | NR23))
 
 /* Channel 2 timer. */
-static int ch2_cc;
+#define ch2_cc (gb->apu.ch2_cc)
 
 /* Channel 2 duty counter. */
-static uint8_t ch2_duty_cc;
+#define ch2_duty_cc (gb->apu.ch2_duty_cc)
 
 /* Step Channel 2. */
-static inline void step_timer_ch2 ()
+static inline void step_timer_ch2 (gb_t *gb, uint32_t n)
 {
-	if (-- ch2_cc == 0)
-	{
-		ch2_cc = CH2FREQ;
-		ch2_duty_cc ++; ch2_duty_cc &= 0x07;
-	}
+	ch2_duty_cc = (ch2_duty_cc + step_timer (&ch2_cc, CH2FREQ, n)) & 0x07;
 }
 
 /* Channel 2 length counter. */
-static uint8_t ch2_len;
+#define ch2_len (gb->apu.ch2_len)
 
 /* Step channel 2's length counter. */
-static inline void step_len_ch2 ()
+static inline void step_len_ch2 (gb_t *gb)
 {
 	if ((~NR24 & 0x40) || !ch2_len)
 		return; // length disabled
@@ -491,9 +483,9 @@ static inline void step_len_ch2 ()
 		DISABLE_CH (2); // Disable
 }
 
-static envelope ch2_env;
+#define ch2_env (gb->apu.ch2_env)
 
-static inline uint8_t ch2sample ()
+static inline uint8_t ch2sample (gb_t *gb)
 {
 	if (! ENABLED (2)) return 0;
 
@@ -505,22 +497,18 @@ static inline uint8_t ch2sample ()
 #define WAVFREQ WAVFREQ_ ((((NR34 & 0x07) << 8) | NR33))
 #define WAVLEN (256 - NR31)
 
-static int wav_cc;
-static uint8_t wav_duty;
+#define wav_cc (gb->apu.wav_cc)
+#define wav_duty (gb->apu.wav_duty)
 
 /* Step Wave channel. */
-static inline void step_timer_wav ()
+static inline void step_timer_wav (gb_t *gb, uint32_t n)
 {
-	if (-- wav_cc <= 0)
-	{
-		wav_duty ++; wav_duty &= 0x1F;
-		wav_cc = WAVFREQ;
-	}
+	wav_duty = (wav_duty + step_timer (&wav_cc, WAVFREQ, n)) & 0x1F;
 }
 
-static uint16_t wav_len;
+#define wav_len (gb->apu.wav_len)
 
-static inline void step_len_wav ()
+static inline void step_len_wav (gb_t *gb)
 {
 	if ((~NR34 & 0x40) || !wav_len)
 		return;
@@ -528,7 +516,7 @@ static inline void step_len_wav ()
 		DISABLE_CH (3);
 }
 
-static inline uint8_t wavsample ()
+static inline uint8_t wavsample (gb_t *gb)
 {
 	// not enabled or volume is 0%
 	if (!ENABLED (3) || (NR32 & 0x60) == 0 || (NR30 & 0x80) == 0)
@@ -546,33 +534,54 @@ static inline uint8_t wavsample ()
 	return s;
 }
 
-static int noi_cc;
-static uint16_t lfsr;
+#define noi_cc (gb->apu.noi_cc)
+#define lfsr (gb->apu.lfsr)
 
 static const uint8_t divisors[8] = { 8, 16, 32, 48, 64, 80, 96, 112 };
 
 #define NOIFREQ (divisors[(NR43 & 0x07)] << (NR43 >> 4))
 
-/* Step Noise channel. */
-static inline void step_timer_noi ()
+/**
+ * Clock the LFSR s times, s at most 14 or 6 in 7 bit mode.
+ *
+ * Each clock shifts in bit 0 XOR bit 1 at bit 14, and at bit 6 as well in 7 bit mode.
+ * The bits shifted in by the next s clocks only depend on bits that are there already
+ * as long as s stays below the width, so they are shifted in at once.
+ */
+static inline uint16_t shift_lfsr (uint16_t l, uint32_t s, int narrow)
 {
-	if (-- noi_cc <= 0)
-	{
-		uint8_t v = (lfsr ^ (lfsr >> 1)) & 1;
+	uint16_t v = (l ^ (l >> 1)) & ((1 << s) - 1);
+
+	if (narrow)
+		return ((l >> s) & ~0x7F) | (v << (15 - s)) | ((l & 0x7F) >> s) | (v << (7 - s));
+	return (l >> s) | (v << (15 - s));
+}
 
-		lfsr = (lfsr >> 1) | (v << 14);
+/* Step Noise channel, the LFSR is clocked each time the timer reaches zero. */
+static inline void step_timer_noi (gb_t *gb, uint32_t n)
+{
+	uint32_t k = step_timer (&noi_cc, NOIFREQ, n);
+	int narrow = NR43 & 0x08;
 
-		if (NR43 & 0x08)
-			lfsr = (lfsr & ~0x40) | (v << 6);
+	// a single clock is the usual case for all but the shortest periods
+	if (k == 1)
+	{
+		lfsr = shift_lfsr (lfsr, 1, narrow);
+		return;
+	}
 
-		noi_cc = NOIFREQ;
+	uint32_t width = narrow ? 6 : 14;
+	for (uint32_t s; k > 0; k -= s)
+	{
+		s = k < width ? k : width;
+		lfsr = shift_lfsr (lfsr, s, narrow);
 	}
 }
 
-static uint16_t noi_len;
+#define noi_len (gb->apu.noi_len)
 
 /* Step Noise channel's length counter. */
-static inline void step_len_noi ()
+static inline void step_len_noi (gb_t *gb)
 {
 	if ((~NR44 & 0x40) || !noi_len)
 		return;
@@ -580,33 +589,33 @@ static inline void step_len_noi ()
 		DISABLE_CH (4);
 }
 
-static envelope noi_env;
+#define noi_env (gb->apu.noi_env)
 
 /* Sample from the noise channel. */
-static inline uint8_t noisample ()
+static inline uint8_t noisample (gb_t *gb)
 {
-	if ((! ENABLE_CH (4)) || !(NR42 & 0xF8))
+	if ((! ENABLED (4)) || !(NR42 & 0xF8))
 		return 0;
 	return (~lfsr & 1) * noi_env.vol;
 }
 
 /* Frame sequencer. */
-static uint8_t fs;
+#define fs (gb->apu.fs)
 
 /* Step Frame Sequencer. */
-static inline void step_fs ()
+static inline void step_fs (gb_t *gb)
 {
 	fs ++; fs &= 0x07;
 
 	if ((fs & 1) == 0) // even step - clock length counters
 	{
-		step_len_ch1 ();
-		step_len_ch2 ();
-		step_len_wav ();
-		step_len_noi ();
+		step_len_ch1 (gb);
+		step_len_ch2 (gb);
+		step_len_wav (gb);
+		step_len_noi (gb);
 
 		if (fs & 0x02) // fs == 2 or 6
-			step_sweep_ch1 ();
+			step_sweep_ch1 (gb);
 	}
 	else if (fs == 7)
 	{
@@ -617,31 +626,38 @@ static inline void step_fs ()
 }
 
 /* Frame sequencer timer */
-static int fs_cc;
+#define fs_cc (gb->apu.fs_cc)
 
 #define FSFREQ 8192 // CPU FREQ / 512 Hz
 
-static inline void step_timer_fs ()
+/* Step the frame sequencer timer, n is never past the next tick. */
+static inline void step_timer_fs (gb_t *gb, uint32_t n)
 {
-	if (-- fs_cc <= 0)
+	fs_cc -= n;
+	if (fs_cc <= 0)
 	{
-		step_fs ();
+		step_fs (gb);
 		fs_cc = FSFREQ;
 	}
 }
 
-static inline void step ()
+/**
+ * Step n cycles, at most up to the next tick of the frame sequencer.
+ * The timers of channels that are off are left alone, a trigger reloads them. Powering
+ * off the APU disables all channels and they can not be triggered until it is back on.
+ */
+static inline void step (gb_t *gb, uint32_t n)
 {
 	// step channel timers
-	step_timer_ch1 ();
-	step_timer_ch2 ();
-	step_timer_wav ();
-	step_timer_noi ();
+	if (ENABLED (1)) step_timer_ch1 (gb, n);
+	if (ENABLED (2)) step_timer_ch2 (gb, n);
+	if (ENABLED (3)) step_timer_wav (gb, n);
+	if (ENABLED (4)) step_timer_noi (gb, n);
 	// step frame sequencer timer
-	step_timer_fs ();
+	step_timer_fs (gb, n);
 }
 
-static inline void sample (uint8_t *l, uint8_t *r)
+static inline void sample (gb_t *gb, uint8_t *l, uint8_t *r)
 {
 	*l = 0;
 	*r = 0;
@@ -652,10 +668,10 @@ static inline void sample (uint8_t *l, uint8_t *r)
 
 	const uint8_t samples[4] =
 	{
-		ch1sample (),
-		ch2sample (),
-		wavsample (),
-		noisample (),
+		ch1sample (gb),
+		ch2sample (gb),
+		wavsample (gb),
+		noisample (gb),
 	};
 
 	uint8_t f = NR51;
@@ -673,30 +689,38 @@ static inline void sample (uint8_t *l, uint8_t *r)
 	}
 }
 
-#define SAMPLE_BUFFER_SIZE 8192
+#define SAMPLE_BUFFER_SIZE GB_APU_SAMPLE_BUFFER_SIZE
 
-static int sample_rate;
-static float samples[SAMPLE_BUFFER_SIZE + 2];
-static int samples_len;
-static int apucc;
+#define sample_rate (gb->apu.sample_rate)
+#define samples (gb->apu.samples)
+#define samples_len (gb->apu.samples_len)
+#define apucc (gb->apu.apucc)
 
-void gb_apu_samples (float* buf, size_t* n)
+void gb_apu_samples (gb_t *gb, float* buf, size_t* n)
 {
 	*n = samples_len * sizeof (float);
 	memcpy (buf, samples, *n);
 	samples_len = 0;
 }
 
-void gb_apu_step (uint32_t cc)
+void gb_apu_step (gb_t *gb, uint32_t cc)
 {
-	for (; cc > 0; cc --)
+	gb->apu.cc += cc;
+	while (cc > 0)
 	{
-		step ();
+		// step over the cycles up to the next tick of the frame sequencer or sample,
+		// nothing but the channel timers change in between.
+		uint32_t n = cc < (uint32_t) fs_cc ? cc : (uint32_t) fs_cc;
+		if (sample_rate && n > (uint32_t) (sample_rate - apucc))
+			n = sample_rate - apucc;
+
+		step (gb, n);
+		cc -= n;
 
-		if (sample_rate && ++ apucc == sample_rate)
+		if (sample_rate && (apucc += n) == sample_rate)
 		{
-			static uint8_t l, r;
-			sample (&l, &r);
+			uint8_t l, r;
+			sample (gb, &l, &r);
 			samples[samples_len ++] = l / 60.0 - 1.0;
 			samples[samples_len ++] = r / 60.0 - 1.0;
 			apucc = 0;
@@ -708,7 +732,19 @@ void gb_apu_step (uint32_t cc)
 	}
 }
 
-static int write_ch1 (uint16_t adr, uint8_t v)
+void gb_apu_sync (gb_t *gb)
+{
+	gb_apu_step (gb, gb->cc - gb->apu.cc);
+}
+
+/* Catch up at every tick of the frame sequencer. */
+static void apu_event (gb_t *gb)
+{
+	gb_apu_sync (gb);
+	gb_sched_schedule (gb, GB_EVENT_APU, gb->apu.cc + fs_cc);
+}
+
+static int write_ch1 (gb_t *gb, uint16_t adr, uint8_t v)
 {
 	switch (adr - 0x0010)
 	{
@@ -737,7 +773,7 @@ static int write_ch1 (uint16_t adr, uint8_t v)
 				if (!ch1_sweep_cc)
 					ch1_sweep_cc = 8;
 				if (CH1SWEEP_SHIFT) // sweep calculation for overflow
-					sweep ();
+					sweep (gb);
 
 				if (!ch1_len)
 					ch1_len = 64;
@@ -749,7 +785,7 @@ static int write_ch1 (uint16_t adr, uint8_t v)
 	return 0;
 }
 
-static int write_ch2 (uint16_t adr, uint8_t v)
+static int write_ch2 (gb_t *gb, uint16_t adr, uint8_t v)
 {
 	switch (adr - 0x0015)
 	{
@@ -783,7 +819,7 @@ static int write_ch2 (uint16_t adr, uint8_t v)
 	return 0;
 }
 
-static int write_wav (uint16_t adr, uint8_t v)
+static int write_wav (gb_t *gb, uint16_t adr, uint8_t v)
 {
 	adr -= 0x1A;
 	if (adr == 4)
@@ -814,7 +850,7 @@ static int write_wav (uint16_t adr, uint8_t v)
 	return 0;
 }
 
-static inline int write_noi (uint16_t adr, uint8_t v)
+static inline int write_noi (gb_t *gb, uint16_t adr, uint8_t v)
 {
 	adr -= 0x1F;
 	if (adr == 4)
@@ -847,7 +883,7 @@ static inline int write_noi (uint16_t adr, uint8_t v)
 	return 0;
 }
 
-static int write_apu_h (uint16_t adr, uint8_t v)
+static int write_apu_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
 	// TODO
 	// not sure if one needs to handle the unused registers.
@@ -855,7 +891,10 @@ static int write_apu_h (uint16_t adr, uint8_t v)
 	// make this cleaner when you are less in a hurry
 	// maybe a function array
 
-	if (adr < 0xFF10 || adr > 0xFF26) return 0;
+	// the samples up to this point should be generated with the old values
+	gb_apu_sync (gb);
+
+	if (adr > 0xFF26) return 0;
 
 	adr &= 0x00FF;
 
@@ -866,22 +905,22 @@ static int write_apu_h (uint16_t adr, uint8_t v)
 	if (adr < 0x15)
 	{
 		// write channel 1
-		return write_ch1 (adr, v);
+		return write_ch1 (gb, adr, v);
 	}
 	else if (adr < 0x1A)
 	{
 		// write channel 2
-		return write_ch2 (adr, v);
+		return write_ch2 (gb, adr, v);
 	}
 	else if (adr < 0x20)
 	{
 		// write wave
-		return write_wav (adr, v);
+		return write_wav (gb, adr, v);
 	}
 	else if (adr < 0x24)
 	{
 		// write noise
-		return write_noi (adr, v);
+		return write_noi (gb, adr, v);
 	}
 
 	if (adr == 0x26) // NR52
@@ -906,10 +945,12 @@ static int write_apu_h (uint16_t adr, uint8_t v)
 	return 0;
 }
 
-static int read_apu_h (uint16_t adr, uint8_t *v)
+static int read_apu_h (gb_t *gb, uint16_t adr, uint8_t *v)
 {
 	// TODO clean this later
 
+	gb_apu_sync (gb);
+
 	if (adr >= 0xFF10 && adr <= 0xFF25)
 	{
 		if (APU_OFF)
@@ -1004,40 +1045,40 @@ static int read_apu_h (uint16_t adr, uint8_t *v)
 	return 0;
 }
 
-void gb_apu_reset (int sample_rate_)
+void gb_apu_reset (gb_t *gb, int sample_rate_)
 {
 	sample_rate = GB_CPU_CLOCK / sample_rate_; // TODO try to be more precise
 	samples_len = 0;
 
-	nr10 = gb_cpu_mem (0xFF10);
-	nr11 = gb_cpu_mem (0xFF11);
-	nr12 = gb_cpu_mem (0xFF12);
-	nr13 = gb_cpu_mem (0xFF13);
-	nr14 = gb_cpu_mem (0xFF14);
+	nr10 = gb_cpu_mem (gb, 0xFF10);
+	nr11 = gb_cpu_mem (gb, 0xFF11);
+	nr12 = gb_cpu_mem (gb, 0xFF12);
+	nr13 = gb_cpu_mem (gb, 0xFF13);
+	nr14 = gb_cpu_mem (gb, 0xFF14);
 
-	nr21 = gb_cpu_mem (0xFF16);
-	nr22 = gb_cpu_mem (0xFF17);
-	nr23 = gb_cpu_mem (0xFF18);
-	nr24 = gb_cpu_mem (0xFF19);
+	nr21 = gb_cpu_mem (gb, 0xFF16);
+	nr22 = gb_cpu_mem (gb, 0xFF17);
+	nr23 = gb_cpu_mem (gb, 0xFF18);
+	nr24 = gb_cpu_mem (gb, 0xFF19);
 
-	nr30 = gb_cpu_mem (0xFF1A);
-	nr31 = gb_cpu_mem (0xFF1B);
-	nr32 = gb_cpu_mem (0xFF1C);
-	nr33 = gb_cpu_mem (0xFF1D);
-	nr34 = gb_cpu_mem (0xFF1E);
-	wav_pat = gb_cpu_mem (0xFF30);
+	nr30 = gb_cpu_mem (gb, 0xFF1A);
+	nr31 = gb_cpu_mem (gb, 0xFF1B);
+	nr32 = gb_cpu_mem (gb, 0xFF1C);
+	nr33 = gb_cpu_mem (gb, 0xFF1D);
+	nr34 = gb_cpu_mem (gb, 0xFF1E);
+	wav_pat = gb_cpu_mem (gb, 0xFF30);
 
-	nr41 = gb_cpu_mem (0xFF20);
-	nr42 = gb_cpu_mem (0xFF21);
-	nr43 = gb_cpu_mem (0xFF22);
-	nr44 = gb_cpu_mem (0xFF23);
+	nr41 = gb_cpu_mem (gb, 0xFF20);
+	nr42 = gb_cpu_mem (gb, 0xFF21);
+	nr43 = gb_cpu_mem (gb, 0xFF22);
+	nr44 = gb_cpu_mem (gb, 0xFF23);
 
-	nr50 = gb_cpu_mem (0xFF24);
-	nr51 = gb_cpu_mem (0xFF25);
-	nr52 = gb_cpu_mem (0xFF26);
+	nr50 = gb_cpu_mem (gb, 0xFF24);
+	nr51 = gb_cpu_mem (gb, 0xFF25);
+	nr52 = gb_cpu_mem (gb, 0xFF26);
 
-	gb_cpu_register_store_handler (write_apu_h);
-	gb_cpu_register_read_handler (read_apu_h);
+	gb_cpu_register_store_handler (gb, 0xFF10, 0xFF3F, 0, write_apu_h);
+	gb_cpu_register_read_handler (gb, 0xFF10, 0xFF3F, 0, read_apu_h);
 
 	// TODO
 	// reset all timers
@@ -1050,4 +1091,8 @@ void gb_apu_reset (int sample_rate_)
 	envelope_init (&ch1_env, nr12);
 	envelope_init (&ch2_env, nr22);
 	envelope_init (&noi_env, nr42);
+
+	gb->apu.cc = gb->cc;
+	gb_sched_register (gb, GB_EVENT_APU, apu_event);
+	gb_sched_schedule (gb, GB_EVENT_APU, gb->apu.cc + fs_cc);
 }
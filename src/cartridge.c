@@ -182,9 +182,9 @@ void gb_print_header_info (gb_cartridge_header h)
 	printf ("\n");
 }
 
-int gb_load_mbc (gb_cartridge_header h, uint8_t *ram)
+int gb_load_mbc (gb_t *gb, gb_cartridge_header h, uint8_t *ram)
 {
-	const void (*MBC[0x100]) (uint8_t*) =
+	const void (*MBC[0x100]) (gb_t *, uint8_t*) =
 	{
 		gb_mbc0_load, // "ROM ONLY",
 		gb_mbc1_load, // "MBC1",
@@ -234,7 +234,7 @@ int gb_load_mbc (gb_cartridge_header h, uint8_t *ram)
 		return 1;
 	}
 
-	ld (ram);
+	ld (gb, ram);
 	return 0;
 }
 
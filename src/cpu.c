@@ -1,5 +1,12 @@
 #include "gb/cpu.h"
 #include "gb/ppu.h"
+#include "gb/core.h"
+#if defined(CPU_JIT) || defined(CPU_AOT)
+#include "gb/jit.h"
+#endif
+#ifdef CPU_AOT
+#include "gb/aot.h"
+#endif
 #include <string.h>
 #include <assert.h>
 
@@ -7,42 +14,26 @@
 #include <stdio.h>
 //#endif
 
-/* CPU Registers */
-
-static uint16_t reg_af;
-static uint16_t reg_bc;
-static uint16_t reg_de;
-static uint16_t reg_hl;
-static uint16_t sp;
-static uint16_t pc;
+/* CPU Registers, these refer to `regs` which is a local copy while the CPU is running. */
 
-static uint8_t* reg_a = ((uint8_t *) &reg_af) + 1;
-static uint8_t* reg_f = ((uint8_t *) &reg_af);
-static uint8_t* reg_b = ((uint8_t *) &reg_bc) + 1;
-static uint8_t* reg_c = ((uint8_t *) &reg_bc);
-static uint8_t* reg_d = ((uint8_t *) &reg_de) + 1;
-static uint8_t* reg_e = ((uint8_t *) &reg_de);
-static uint8_t* reg_h = ((uint8_t *) &reg_hl) + 1;
-static uint8_t* reg_l = ((uint8_t *) &reg_hl);
+#define AF (regs->af)
+#define A (((uint8_t *) &AF)[1])
+#define F (((uint8_t *) &AF)[0])
 
-#define AF reg_af
-#define A (*reg_a)
-#define F (*reg_f)
+#define BC (regs->bc)
+#define B (((uint8_t *) &BC)[1])
+#define C (((uint8_t *) &BC)[0])
 
-#define BC reg_bc
-#define B (*reg_b)
-#define C (*reg_c)
+#define DE (regs->de)
+#define D (((uint8_t *) &DE)[1])
+#define E (((uint8_t *) &DE)[0])
 
-#define DE reg_de
-#define D (*reg_d)
-#define E (*reg_e)
+#define HL (regs->hl)
+#define H (((uint8_t *) &HL)[1])
+#define L (((uint8_t *) &HL)[0])
 
-#define HL reg_hl
-#define H (*reg_h)
-#define L (*reg_l)
-
-#define SP sp
-#define PC pc
+#define SP (regs->sp)
+#define PC (regs->pc)
 
 /* define flags */
 enum flags
@@ -53,81 +44,417 @@ enum flags
 	F_C = 0x10,
 };
 
+/* Operations whose flags have not been written to F yet. */
+enum flags_op
+{
+	FLAGS_NONE,
+	FLAGS_ADD,  // a + b + carry
+	FLAGS_SUB,  // a - b - carry
+	FLAGS_AND,  // result in a
+	FLAGS_OR,   // result in a, also XOR
+	FLAGS_INC,  // result in a, C as it was
+	FLAGS_DEC,  // result in a, C as it was
+};
+
+/* Record the operation that sets the flags. */
+#define LAZY_FLAGS(op, a, b, c) \
+	do { \
+		regs->flags_op = (op); \
+		regs->flags_a = (a); \
+		regs->flags_b = (b); \
+		regs->flags_c = (c); \
+	} while (0)
+
+/* Write the flags of the last operation to F and return it. */
+static uint8_t sync_flags (gb_cpu_regs *regs)
+{
+	uint8_t a = regs->flags_a, b = regs->flags_b, c = regs->flags_c;
+	uint16_t r;
+
+	switch (regs->flags_op)
+	{
+		case FLAGS_ADD:
+			r = a + b + c;
+			F = 0;
+			if (r > 0xFF) F |= F_C;
+			if ((a ^ b ^ r) & 0x10) F |= F_H;
+			if ((uint8_t) r == 0) F |= F_Z;
+			break;
+
+		case FLAGS_SUB:
+			r = a - b - c;
+			F = F_N;
+			if (r & 0xFF00) F |= F_C;
+			if ((a ^ b ^ r) & 0x10) F |= F_H;
+			if ((uint8_t) r == 0) F |= F_Z;
+			break;
+
+		case FLAGS_AND:
+			F = a == 0 ? F_Z | F_H : F_H;
+			break;
+
+		case FLAGS_OR:
+			F = a == 0 ? F_Z : 0;
+			break;
+
+		case FLAGS_INC:
+			F &= ~(F_N | F_Z | F_H);
+			if (a == 0) F |= F_Z;
+			if ((a & 0x0F) == 0x00) F |= F_H;
+			break;
+
+		case FLAGS_DEC:
+			F |= F_N;
+			F &= ~(F_Z | F_H);
+			if (a == 0) F |= F_Z;
+			if ((a & 0x0F) == 0x0F) F |= F_H;
+			break;
+	}
+
+	regs->flags_op = FLAGS_NONE;
+	return F;
+}
+
+/* F up to date, for operations that read it. */
+#define FLAGS (regs->flags_op == FLAGS_NONE ? F : sync_flags (regs))
+
+/* Bring F up to date before an operation changes some of the flags. */
+#define SYNC_FLAGS() do { if (regs->flags_op != FLAGS_NONE) sync_flags (regs); } while (0)
+
+/* Forget the flags of the last operation as F is overwritten. */
+#define DROP_FLAGS() (regs->flags_op = FLAGS_NONE)
+
 /* Memory -------------------------------------------------------------------------- */
 
-/* RAM memory. */
-static uint8_t ram[1 << 16];
+/* the CPU loop is too big for the compiler to inline the memory accesses on its own. */
+#ifdef __GNUC__
+#define ALWAYS_INLINE inline __attribute__ ((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+#define RAM_ (gb->cpu.ram)
+
+uint8_t* gb_cpu_mem (gb_t *gb, uint16_t p) { return RAM_ + p; }
 
-uint8_t* gb_cpu_mem (uint16_t p) { return ram + p; }
+/* ROM is only mapped for reads so it is fine to let the map point to it. */
+#define ROM_ ((uint8_t *) gb->cpu.rom)
+
+void gb_cpu_load_rom (gb_t *gb, int banks, const uint8_t* data)
+{
+	gb->cpu.n_rom_banks = banks;
+	gb->cpu.rom = data;
+	gb_cpu_map (gb, 0x0000, ROM_BANK_SIZE, ROM_, GB_CPU_MAP_READ);
+	gb_cpu_switch_rom_bank (gb, 1);
+}
+
+void gb_cpu_switch_rom_bank (gb_t *gb, int b)
+{
+	uint8_t *bank = ROM_ + (b % gb->cpu.n_rom_banks) * ROM_BANK_SIZE;
+	gb_cpu_map (gb, ROM_BANK_SIZE, ROM_BANK_SIZE, bank, GB_CPU_MAP_READ);
+}
+
+void gb_cpu_load_ram (gb_t *gb, uint8_t* data) { memcpy (RAM_ + 0xA000, data, RAM_BANK_SIZE); }
+
+/* is p the host memory of a page with decoded blocks. */
+static int is_code_page (gb_t *gb, const uint8_t *p)
+{
+	for (int i = 0; i < gb->cpu.n_code_pages; i ++)
+		if (gb->cpu.code_pages[i] == p) return 1;
+	return 0;
+}
 
 /**
- * n_rom_banks keeps track of the total number of banks in the cartridge.
- * This is needed because some games seem to write a higher value than allowed.
+ * Take the pages that store to the host memory out of the store map, so stores go
+ * through the slow path and invalidate the blocks decoded from it.
+ *
+ * Returns zero in case there is no room to keep track of more pages.
  */
-static int n_rom_banks;
-static const uint8_t* ROM;
+static int protect (gb_t *gb, uint8_t *mem)
+{
+	if (is_code_page (gb, mem)) return 1;
+
+	int writable = 0;
+	for (int i = 0; i < GB_CPU_PAGES; i ++)
+		writable |= gb->cpu.store_map[i] == mem;
+	if (!writable) return 1;
+	if (gb->cpu.n_code_pages == GB_CPU_CODE_PAGES) return 0;
+
+	gb->cpu.code_pages[gb->cpu.n_code_pages ++] = mem;
+	for (int i = 0; i < GB_CPU_PAGES; i ++)
+	{
+		if (gb->cpu.store_map[i] != mem) continue;
+		gb->cpu.code_store[i] = mem;
+		gb->cpu.store_map[i] = NULL;
+	}
+	return 1;
+}
+
+/* Invalidate the blocks decoded from the host memory and map it for stores again. */
+static void invalidate (gb_t *gb, uint8_t *mem)
+{
+	for (int i = 0; i < GB_CPU_BLOCKS; i ++)
+	{
+		gb_cpu_block *b = &gb->cpu.blocks[i];
+		if (b->mem >= mem && b->mem < mem + GB_CPU_PAGE_SIZE)
+		{
+			b->mem = NULL;
+			b->n = 0;
+			b->code = NULL;
+			b->hits = 0;
+		}
+	}
+
+	for (int i = 0; i < GB_CPU_PAGES; i ++)
+	{
+		if (gb->cpu.code_store[i] != mem) continue;
+		gb->cpu.store_map[i] = mem;
+		gb->cpu.code_store[i] = NULL;
+	}
 
-void gb_cpu_load_rom (int banks, const uint8_t* data)
+	for (int i = 0; i < gb->cpu.n_code_pages; i ++)
+	{
+		if (gb->cpu.code_pages[i] != mem) continue;
+		gb->cpu.code_pages[i] = gb->cpu.code_pages[-- gb->cpu.n_code_pages];
+		break;
+	}
+}
+
+void gb_cpu_map (gb_t *gb, uint16_t adr, uint32_t size, uint8_t *mem, int flags)
 {
-	n_rom_banks = banks;
-	ROM = data;
-	memcpy (ram, ROM, ROM_BANK_SIZE << 1);
+	int remapped = 0;
+	for (uint32_t off = 0; off < size; off += GB_CPU_PAGE_SIZE)
+	{
+		uint8_t page = (adr + off) >> 8;
+		uint8_t *p = mem ? mem + off : NULL;
+
+		if ((flags & GB_CPU_MAP_READ) && gb->cpu.read_map[page] != p)
+		{
+			gb->cpu.read_map[page] = p;
+			remapped |= page == gb->cpu.run_page;
+		}
+		if (flags & GB_CPU_MAP_STORE)
+		{
+			// memory with decoded blocks stays out of the store map
+			gb->cpu.code_store[page] = NULL;
+			if (p && gb->cpu.n_code_pages && is_code_page (gb, p))
+			{
+				gb->cpu.code_store[page] = p;
+				p = NULL;
+			}
+			gb->cpu.store_map[page] = p;
+		}
+	}
+
+	// the running block was decoded from what was mapped before, end the run after the
+	// operation so the next one is looked up from the new memory
+	if (remapped)
+		gb_sched_schedule (gb, GB_EVENT_IRQ, gb->cc);
 }
 
-void gb_cpu_switch_rom_bank (int b)
+/* Slot of the handlers that can claim the address, below HRAM. */
+#define HANDLER_SLOT(adr) \
+	((adr) < GB_CPU_IO_LOC ? (adr) >> 8 : GB_CPU_IO_LOC / GB_CPU_PAGE_SIZE + (adr) - GB_CPU_IO_LOC)
+
+/* First and last address of a slot. */
+#define SLOT_LO(s) \
+	((s) < GB_CPU_IO_LOC / GB_CPU_PAGE_SIZE ? (s) << 8 : GB_CPU_IO_LOC + (s) - GB_CPU_IO_LOC / GB_CPU_PAGE_SIZE)
+#define SLOT_HI(s) \
+	((s) < GB_CPU_IO_LOC / GB_CPU_PAGE_SIZE ? ((s) << 8) | 0xFF : SLOT_LO (s))
+
+/* Remove all handlers. */
+static void clear_handlers (gb_cpu_handlers *l)
 {
-	memcpy (ram + ROM_BANK_SIZE, ROM + (b % n_rom_banks) * ROM_BANK_SIZE, ROM_BANK_SIZE);
+	l->n = 0;
+	memset (l->slots, GB_CPU_NO_HANDLER, sizeof (l->slots));
+	memset (l->direct, GB_CPU_NO_HANDLER, sizeof (l->direct));
 }
 
-void gb_cpu_load_ram (uint8_t* data) { memcpy (ram + 0xA000, data, RAM_BANK_SIZE); }
+/**
+ * Add the range to the slots it covers, after the handlers of the same or a higher
+ * priority. Returns the index of the handler or -1 if it could not be added.
+ */
+static int add_handler (gb_cpu_handlers *l, uint16_t lo, uint16_t hi, int priority)
+{
+	if (lo > hi || lo >= 0xFF80 || l->n == MAX_HANDLERS)
+	{
+		fprintf (stderr, "CPU > can not add a handler for $%.4X - $%.4X\n", lo, hi);
+		return -1;
+	}
+
+	int i = l->n ++;
+	l->lo[i] = lo;
+	l->hi[i] = hi;
+	l->priority[i] = priority;
+
+	if (hi >= 0xFF80) hi = 0xFF7F;
+	for (int s = HANDLER_SLOT (lo); s <= HANDLER_SLOT (hi); s ++)
+	{
+		uint8_t *slot = l->slots[s];
+		int at = 0, end = 0;
+		while (slot[end] != GB_CPU_NO_HANDLER)
+		{
+			if (l->priority[slot[end]] >= priority) at = end + 1;
+			end ++;
+		}
+		memmove (slot + at + 1, slot + at, end - at + 1);
+		slot[at] = i;
+
+		// alone and for all of the slot it needs no range test
+		l->direct[s] = end == 0 && lo <= SLOT_LO (s) && l->hi[i] >= SLOT_HI (s) ? i : GB_CPU_NO_HANDLER;
+	}
+	return i;
+}
 
-#define MAX_HANDLERS 32
+int gb_cpu_register_read_handler (gb_t *gb, uint16_t lo, uint16_t hi, int priority, read_handler h)
+{
+	int i = add_handler (&gb->cpu.reads, lo, hi, priority);
+	if (i < 0) return 1;
+	gb->cpu.read_handlers[i] = h;
+	return 0;
+}
 
-/* Currently registered read handlers. */
-static read_handler read_handlers[MAX_HANDLERS];
-static int n_read_handlers = 0;
+/**
+ * Move the clock to the cycle of the access within the running operation for the
+ * handlers, which is only set by the accurate loop. Returns the cycle to go back to.
+ *
+ * Only accesses that are timed go through these, which the accurate loop makes and
+ * the fast one does not, see TIMED.
+ */
+static ALWAYS_INLINE uint64_t access_begin (gb_t *gb)
+{
+	uint64_t cc = gb->cc;
+	if (gb->cpu.access_cc > cc) gb->cc = gb->cpu.access_cc;
+	// accesses the handlers make themselves, e.g. for DMA, happen at the same cycle
+	gb->cpu.access_cc = 0;
+	return cc;
+}
 
-void gb_cpu_register_read_handler (read_handler h)
+static ALWAYS_INLINE void access_end (gb_t *gb, uint64_t cc)
 {
-	read_handlers[n_read_handlers ++] = h;
-	read_handlers[n_read_handlers] = 0;
+	// the next access of the operation is in the M-cycle after
+	if (gb->cc > cc) gb->cpu.access_cc = gb->cc + 4;
+	gb->cc = cc;
 }
 
-static uint8_t mem_read (uint16_t adr)
+/**
+ * Memory accesses of operations are timed in the accurate tier, where the loop is
+ * included with TIMED set to 1. Everything else, the fast tier and the handlers, does
+ * not time its accesses and carries no checks for it.
+ */
+#define TIMED 0
+
+/* Read from a page that is not mapped. */
+static ALWAYS_INLINE uint8_t read_slow (gb_t *gb, uint16_t adr, int timed)
 {
-	uint8_t v = ram[adr];
-	int stop = 0;
-	for (read_handler* h = read_handlers; (*h) != 0 && !stop; h ++)
-		stop = (*h)(adr, &v);
+	// no handler claims HRAM or IE
+	if (adr >= 0xFF80) return RAM_[adr];
+
+	uint8_t v = RAM_[adr];
+	const gb_cpu_handlers *l = &gb->cpu.reads;
+	int s = HANDLER_SLOT (adr);
+	const uint8_t *i = l->slots[s];
+	if (*i == GB_CPU_NO_HANDLER) return v;
+
+	uint64_t cc = timed ? access_begin (gb) : 0;
+	if (l->direct[s] != GB_CPU_NO_HANDLER)
+		gb->cpu.read_handlers[l->direct[s]] (gb, adr, &v);
+	else
+		for (; *i != GB_CPU_NO_HANDLER; i ++)
+			if (adr >= l->lo[*i] && adr <= l->hi[*i] && gb->cpu.read_handlers[*i] (gb, adr, &v))
+				break;
+	if (timed) access_end (gb, cc);
 	return v;
 }
 
-#define RAM(a) mem_read (a)
+static uint8_t mem_read_slow (gb_t *gb, uint16_t adr) { return read_slow (gb, adr, 0); }
+static uint8_t mem_read_slow_timed (gb_t *gb, uint16_t adr) { return read_slow (gb, adr, 1); }
 
-/* Current store handlers. */
-static store_handler store_handlers[MAX_HANDLERS];
-static int n_store_handlers = 0;
+static ALWAYS_INLINE uint8_t mem_read (gb_t *gb, uint16_t adr, int timed)
+{
+	const uint8_t *p = gb->cpu.read_map[adr >> 8];
+	if (p) return p[adr & 0xFF];
+	return timed ? mem_read_slow_timed (gb, adr) : mem_read_slow (gb, adr);
+}
 
-void gb_cpu_register_store_handler (store_handler h)
+#define RAM(a) mem_read (gb, a, TIMED)
+
+int gb_cpu_register_store_handler (gb_t *gb, uint16_t lo, uint16_t hi, int priority, store_handler h)
 {
-	store_handlers[n_store_handlers ++] = h;
-	store_handlers[n_store_handlers] = 0;
+	int i = add_handler (&gb->cpu.stores, lo, hi, priority);
+	if (i < 0) return 1;
+	gb->cpu.store_handlers[i] = h;
+	return 0;
 }
 
+static void check_interrupt (gb_t *) ;
+
 /**
- * Store to memory.
+ * Store to a page that is not mapped.
  * Makes sure the callbacks are run for specific memory addresses.
  */
-static void mem_store (uint16_t adr, uint8_t v)
+static ALWAYS_INLINE void store_slow (gb_t *gb, uint16_t adr, uint8_t v, int timed)
+{
+	uint8_t page = adr >> 8;
+
+	// memory that blocks were decoded from
+	uint8_t *p = gb->cpu.code_store[page];
+	if (p)
+	{
+		if (gb->cpu.code_writes[page] < GB_CPU_CODE_WRITES)
+			gb->cpu.code_writes[page] ++;
+		invalidate (gb, p);
+		p[adr & 0xFF] = v;
+		return;
+	}
+
+	// no handler claims HRAM or IE
+	if (adr >= 0xFF80)
+	{
+		RAM_[adr] = v;
+		if (adr == 0xFFFF) check_interrupt (gb);
+		return;
+	}
+
+	const gb_cpu_handlers *l = &gb->cpu.stores;
+	int s = HANDLER_SLOT (adr);
+	const uint8_t *i = l->slots[s];
+	if (*i == GB_CPU_NO_HANDLER)
+	{
+		RAM_[adr] = v;
+		return;
+	}
+
+	uint64_t cc = timed ? access_begin (gb) : 0;
+	if (l->direct[s] != GB_CPU_NO_HANDLER)
+	{
+		if (!gb->cpu.store_handlers[l->direct[s]] (gb, adr, v))
+			RAM_[adr] = v;
+	}
+	else
+	{
+		for (; *i != GB_CPU_NO_HANDLER; i ++)
+			if (adr >= l->lo[*i] && adr <= l->hi[*i] && gb->cpu.store_handlers[*i] (gb, adr, v))
+				break;
+		if (*i == GB_CPU_NO_HANDLER) // if we didn't break the loop we can store to RAM @ address.
+			RAM_[adr] = v;
+	}
+	if (timed) access_end (gb, cc);
+}
+
+static void mem_store_slow (gb_t *gb, uint16_t adr, uint8_t v) { store_slow (gb, adr, v, 0); }
+static void mem_store_slow_timed (gb_t *gb, uint16_t adr, uint8_t v) { store_slow (gb, adr, v, 1); }
+
+/* Store to memory. */
+static ALWAYS_INLINE void mem_store (gb_t *gb, uint16_t adr, uint8_t v, int timed)
 {
-	int stop = 0;
-	for (store_handler* h = store_handlers; (*h) != 0 && !stop; h ++)
-		stop = (*h)(adr, v);
-	if (!stop) // if we didn't break the loop we can store to RAM @ address.
-		ram[adr] = v;
+	uint8_t *p = gb->cpu.store_map[adr >> 8];
+	if (p) p[adr & 0xFF] = v;
+	else if (timed) mem_store_slow_timed (gb, adr, v);
+	else mem_store_slow (gb, adr, v);
 }
 
-#define STORE(a, v) mem_store (a, v)
+#define STORE(a, v) mem_store (gb, a, v, TIMED)
 
 /* Define some memory handlers here. */
 
@@ -137,7 +464,7 @@ static void mem_store (uint16_t adr, uint8_t v)
 #define HDMA4 0xFF54
 #define HDMA5 0xFF55
 
-static void vram_dma (uint8_t v)
+static void vram_dma (gb_t *gb, uint8_t v)
 {
 	uint16_t src = ((RAM (HDMA1) << 8) | RAM (HDMA2)) & 0xFFF0;
 	uint16_t dst = (((RAM (HDMA3) << 8) | RAM (HDMA4)) & 0x1FF0) + 0x8000;
@@ -152,40 +479,40 @@ static void vram_dma (uint8_t v)
 		// fprintf (stderr, "CPU > HBLANK DMA !! not supported yet\n");
 		for (uint16_t i = 0; i < n; i ++)
 			STORE (dst + i, RAM (src + i));
-		ram[HDMA5] = 0x00;
+		RAM_[HDMA5] = 0x00;
 	}
 	else  // General purpose DMA
 	{
 		for (uint16_t i = 0; i < n; i ++)
 			STORE (dst + i, RAM (src + i));
-		ram[HDMA5] = 0xFF;
+		RAM_[HDMA5] = 0xFF;
 	}
 }
 
-static int write_vram_dma_handler (uint16_t adr, uint8_t v)
+static int write_vram_dma_handler (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr == HDMA5) vram_dma (v);
+	vram_dma (gb, v);
 	return 0;
 }
 
 /* Transfer memory to OAM location. */
-static void oam_dma_transfer (uint8_t v)
+static void oam_dma_transfer (gb_t *gb, uint8_t v)
 {
 	uint16_t src = v << 8, dst = OAM_LOC;
 	for (int i = 0; i < 0xA0; i ++, dst ++, src ++)
 		STORE (dst, RAM (src));
-	gb_ppu_stall (160);
+	gb_ppu_stall (gb, 160);
 
 #ifdef DEBUG_CPU
 	printf ("\t\t>>> OAM transfer [$%.2X => $%.4X]\n", v, src);
 #endif
 }
 
-/* check writes to initiate OAM DMA transfer. */
-static int oam_dma_transf_handler (uint16_t address, uint8_t v)
+/* check writes to initiate OAM DMA transfer, the sprites up to this point are drawn from the old OAM. */
+static int oam_dma_transf_handler (gb_t *gb, uint16_t address, uint8_t v)
 {
-	if (address == 0xFF46)
-		oam_dma_transfer (v);
+	gb_ppu_sync (gb);
+	oam_dma_transfer (gb, v);
 	return 0;
 }
 
@@ -193,178 +520,206 @@ static int oam_dma_transf_handler (uint16_t address, uint8_t v)
 //#define SVBK (*_svbk)
 #define SVBK_LOC 0xFF70
 
-static uint8_t wram[0x7000];
-static uint8_t *wram_bank;
-
-static int write_wram_bank_handler (uint16_t adr, uint8_t v)
+static int write_wram_bank_handler (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr != SVBK_LOC) goto ret;
-
 	if (v == 0) v = 1;
 	// v << 12 == v mul 0x1000
-	wram_bank = wram + ((v - 1) << 12);
-ret:
+	gb->cpu.wram_bank = gb->cpu.wram + ((v - 1) << 12);
+	gb_cpu_map (gb, 0xD000, 0x1000, gb->cpu.wram_bank, GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
 	return 0;
 }
 
-static int read_wram_handler (uint16_t adr, uint8_t *v)
-{
-	if (adr < 0xD000 || adr > 0xDFFF) return 0;
-
-	//uint16_t x = (SVBK == 0 ? 1 : SVBK) << 12;
-	//*v = wram[x + adr - 0xD000];
-	*v = wram_bank[adr - 0xD000];
-	return 1;
-}
-
-static int write_wram_handler (uint16_t adr, uint8_t v)
-{
-	if (adr < 0xD000 || adr > 0xDFFF) return 0;
-
-	wram_bank[adr - 0xD000] = v;
-	return 1;
-}
-
 /**
  * stack_push pushes the value v to the stack.
+ * The operations using the stack pass on whether their accesses are timed, see TIMED.
  */
-void stack_push (uint16_t v)
+static ALWAYS_INLINE void stack_push (gb_t *gb, gb_cpu_regs *regs, uint16_t v, int timed)
 {
 #ifdef DEBUG_CPU
 	printf ("\tPUSH %.4X @ $%.4X\n", v, SP);
 #endif
-	STORE (--SP, v >> 8); // msb
-	STORE (--SP, v);      // lsb
+	mem_store (gb, --SP, v >> 8, timed); // msb
+	mem_store (gb, --SP, v, timed);      // lsb
 }
 
-#define PUSH(v) stack_push (v)
+#define PUSH(v) stack_push (gb, regs, v, timed)
 
 /**
  * stack_pop pops the stack and returns the value;
  */
-uint16_t stack_pop ()
+static ALWAYS_INLINE uint16_t stack_pop (gb_t *gb, gb_cpu_regs *regs, int timed)
 {
-	uint16_t lo = RAM (SP++);
-	uint16_t hi = RAM (SP++);
+	uint16_t lo = mem_read (gb, SP++, timed);
+	uint16_t hi = mem_read (gb, SP++, timed);
 #ifdef DEBUG_CPU
 	printf ("\tPOP %.4X\n", (hi << 8) | lo);
 #endif
 	return (hi << 8) | lo;
 }
 
-#define POP() stack_pop ()
+#define POP() stack_pop (gb, regs, timed)
 
-static int write_unused_ram_h (uint16_t adr, uint8_t v)
+static int write_unused_ram_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	return adr >= 0xFEA0 && adr <= 0xFEFF;
-}
-
-static int read_unused_ram_h (uint16_t adr, uint8_t* v)
-{
-	if (adr >= 0xFEA0 && adr <= 0xFEFF)
-	{
-		*v = 0xFF;
-		return 1;
-	}
-	return 0;
+	return 1;
 }
 
-static int write_echo_ram_h (uint16_t adr, uint8_t v)
+static int read_unused_ram_h (gb_t *gb, uint16_t adr, uint8_t* v)
 {
-	if (adr >= 0xE000 && adr <= 0xFDFF)
-	{
-		ram[adr - 0x2000] = v;
-		return 1;
-	}
-	return 0;
+	*v = 0xFF;
+	return 1;
 }
 
-static int read_echo_ram_h (uint16_t adr, uint8_t* v)
-{
-	if (adr >= 0xE000 && adr <= 0xFDFF)
-	{
-		*v = ram[adr - 0x2000];
-		return 1;
-	}
-	return 0;
-}
 
 /* Special Registers ---------------------------------------------------------------- */
 
 /* HALT flag. */
-static uint8_t f_halt;
+#define f_halt (gb->cpu.f_halt)
 
 /* Interrupt Master Enable flag (IME). */
-static uint8_t ime;
+#define ime (gb->cpu.ime)
 
 /* Interrupt Enable (IE) register. Is located at RAM memory $FFFF. */
-static uint8_t* reg_ie = ram + 0xFFFF;
-#define IE (* reg_ie)
+#define IE (RAM_[0xFFFF])
 
 /* Interrupt Flag (IF) register. Is located at RAM memory $FF0F. */
-static uint8_t* reg_if = ram + 0xFF0F;
-#define IF (* reg_if)
+#define IF (RAM_[0xFF0F])
 
-/* Divider register */
-#define DIV_LOC 0xFF04
-static uint8_t* reg_div = ram + DIV_LOC;
-#define DIV (* reg_div)
+/* macro to check if an interrupt is requested and enabled. */
+#define IRQ (IE & IF)
 
-/* writing to the DIV register resets it. */
-static int write_div_h (uint16_t addr, uint8_t n)
+/**
+ * IF, IE or IME changed. The CPU only takes interrupts when it starts to run, so an
+ * event ends the run for it to take a pending one.
+ */
+static void check_interrupt (gb_t *gb)
 {
-	if (addr == DIV_LOC)
-	{
-		DIV = 0;
-		return 1;
-	}
-	return 0;
+	if (ime && IRQ)
+		gb_sched_schedule (gb, GB_EVENT_IRQ, gb->cc);
 }
 
-// keep track of DIV cycles.
-static int divcc;
+static int write_if_h (gb_t *gb, uint16_t adr, uint8_t v)
+{
+	IF = v;
+	check_interrupt (gb);
+	return 1;
+}
 
-static void inc_div (int cc)
+/**
+ * Timers.
+ *
+ * DIV and TIMA are only brought up to date when they are read or written, from the
+ * cycles that passed since they last were. The only event is the overflow of TIMA,
+ * which requests the timer interrupt.
+ */
+
+/* Divider register */
+#define DIV_LOC 0xFF04
+#define DIV (RAM_[DIV_LOC])
+
+static void inc_div (gb_t *gb, uint64_t cc)
 {
-	divcc += cc;
-	if (divcc >= GB_DIV_CC)
-	{
-		DIV += divcc / GB_DIV_CC;
-		divcc %= GB_DIV_CC;
-	}
+	cc += gb->cpu.divcc;
+	DIV += cc / GB_DIV_CC;
+	gb->cpu.divcc = cc % GB_DIV_CC;
 }
 
 /* Time counter register. */
-static uint8_t* reg_tima = ram + 0xFF05;
-#define TIMA (* reg_tima)
+#define TIMA (RAM_[0xFF05])
 
 /* Timer Modulo register. */
-static uint8_t* reg_tma = ram + 0xFF06;
-#define TMA (* reg_tma)
+#define TMA (RAM_[0xFF06])
 
 /* Timer Control register. */
-static uint8_t* reg_tac = ram + 0xFF07;
-#define TAC (* reg_tac)
+#define TAC (RAM_[0xFF07])
 
 #define TIMER_ENABLED (TAC & 0x04)
 
-// Keep track of TIMA cycles.
-static int timacc;
+/* Number of cycles per TIMA increment for each clock select in TAC. */
+static const uint16_t timer_cc[4] = { 1024, 16, 64, 256 };
 
-static void inc_tima (int cc)
+static void inc_tima (gb_t *gb, uint64_t cc)
 {
 	if (!TIMER_ENABLED) return;
 
-	timacc += cc;
-	static const uint16_t timer_cc[4] = { 1024, 16, 64, 256 };
-	for (int c = timer_cc[TAC & 0x03]; timacc >= c; timacc -= c)
+	int c = timer_cc[TAC & 0x03];
+	cc += gb->cpu.timacc;
+	uint64_t n = cc / c;
+	gb->cpu.timacc = cc % c;
+
+	// one step per overflow, TIMA starts over from TMA
+	while (n >= 0x100 - TIMA)
 	{
-		if (++TIMA == 0) // overflow
-		{
-			gb_cpu_flag_interrupt (INT_FLAG_TIMER);
-			TIMA = TMA;
-		}
+		n -= 0x100 - TIMA;
+		gb_cpu_flag_interrupt (gb, INT_FLAG_TIMER);
+		TIMA = TMA;
+	}
+	TIMA += n;
+}
+
+/* increment the timers up to the current cycle. */
+static void sync_timers (gb_t *gb)
+{
+	uint64_t cc = gb->cc - gb->cpu.timer_cc;
+	gb->cpu.timer_cc = gb->cc;
+
+	inc_div (gb, cc);
+	inc_tima (gb, cc);
+}
+
+/* schedule the next overflow of TIMA. */
+static void schedule_timers (gb_t *gb)
+{
+	if (!TIMER_ENABLED)
+	{
+		gb_sched_cancel (gb, GB_EVENT_TIMER);
+		return;
+	}
+
+	int cc = (0x100 - TIMA) * timer_cc[TAC & 0x03] - gb->cpu.timacc;
+	gb_sched_schedule (gb, GB_EVENT_TIMER, gb->cpu.timer_cc + (cc < 0 ? 0 : cc));
+}
+
+static void timer_event (gb_t *gb)
+{
+	sync_timers (gb);
+	schedule_timers (gb);
+}
+
+/* cycle at which DIV or TIMA next change. */
+static uint64_t next_timer_change (gb_t *gb)
+{
+	uint64_t cc = gb->cc - gb->cpu.timer_cc;
+	uint64_t next = gb->cc + GB_DIV_CC - (gb->cpu.divcc + cc) % GB_DIV_CC;
+
+	if (TIMER_ENABLED)
+	{
+		int c = timer_cc[TAC & 0x03];
+		uint64_t tima = gb->cc + c - (gb->cpu.timacc + cc) % c;
+		if (tima < next) next = tima;
 	}
+	return next;
+}
+
+/* DIV and TIMA are read as of the current cycle. */
+static int read_timer_h (gb_t *gb, uint16_t addr, uint8_t *v)
+{
+	sync_timers (gb);
+	gb->cpu.timer_read = 1;
+	*v = RAM_[addr];
+	return 1;
+}
+
+/**
+ * writing to the DIV register resets it. writes to TIMA, TMA or TAC change when the
+ * next overflow happens.
+ */
+static int write_timer_h (gb_t *gb, uint16_t addr, uint8_t n)
+{
+	sync_timers (gb);
+	RAM_[addr] = addr == DIV_LOC ? 0 : n;
+	schedule_timers (gb);
+	return 1;
 }
 
 /* CPU Instructions ----------------------------------------------------------------- */
@@ -372,10 +727,11 @@ static void inc_tima (int cc)
 // NOTE : LD instructions are not implemented here; they are all implemented in the
 // autogeneretade code instead.
 
-void ldhl (uint8_t n)
+static inline void ldhl (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
 	uint16_t hl = SP + (int8_t) n;
 
+	DROP_FLAGS ();
 	F = 0;
 
 	if ((n ^ SP ^ hl) & 0x10)
@@ -387,38 +743,29 @@ void ldhl (uint8_t n)
 	HL = hl;
 }
 
-void push (uint16_t v)
+static ALWAYS_INLINE void push (gb_t *gb, gb_cpu_regs *regs, uint16_t v, int timed)
 {
 	PUSH (v);
 }
 
-void pop (uint16_t *v)
+static ALWAYS_INLINE void pop (gb_t *gb, gb_cpu_regs *regs, uint16_t *v, int timed)
 {
 	*v = POP ();
 }
 
-void add (uint8_t n)
+static inline void add (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
 #ifdef DEBUG_CPU
 	printf ("    x%.2X + x%.2X\n", A, n);
 #endif
-	uint16_t a = A + n;
-
-	F = 0; // reset flags
-
-	if (a & 0xFF00)
-		F |= F_C;
-	if (((A ^ n ^ a) & 0x10) == 0x10) // half carry
-		F |= F_H;
-
-	A = a;
-	if (A == 0)
-		F |= F_Z;
+	LAZY_FLAGS (FLAGS_ADD, A, n, 0);
+	A += n;
 }
 
-void addhl (uint16_t n)
+static inline void addhl (gb_t *gb, gb_cpu_regs *regs, uint16_t n)
 {
 	uint32_t hl = HL + n;
+	SYNC_FLAGS ();
 	F &= F_Z;
 	if (hl > 0xFFFF)
 		F |= F_C;
@@ -427,8 +774,9 @@ void addhl (uint16_t n)
 	HL = hl;
 }
 
-void addsp (uint8_t n)
+static inline void addsp (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
+	DROP_FLAGS ();
 	F = 0; // reset flags
 
 	uint16_t sp_ = SP + (int8_t) n;
@@ -442,153 +790,111 @@ void addsp (uint8_t n)
 	SP = sp_;
 }
 
-void adc (uint8_t n)
+static inline void adc (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
+	uint8_t c = (FLAGS & F_C) >> 4;
 #ifdef DEBUG_CPU
-	printf ("    $%.2X + $%.2X + %d\n", A, n, ((F & F_C) >> 4));
+	printf ("    $%.2X + $%.2X + %d\n", A, n, c);
 #endif
-	uint16_t a = A + n + ((F & F_C) >> 4);
-
-	F = 0; // reset flags
-
-	if (a > 0xFF)
-		F |= F_C;
-	if (((A ^ n ^ a) & 0x10) == 0x10) // half carry
-		F |= F_H;
-
-	A = a;
-	if (A == 0)
-		F |= F_Z;
+	LAZY_FLAGS (FLAGS_ADD, A, n, c);
+	A += n + c;
 }
 
-void sub (uint8_t n)
+static inline void sub (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
 #ifdef DEBUG_CPU
 	printf ("    $%.2X - $%.2X\n", A, n);
 #endif
-	uint16_t a = A - n;
-
-	F = F_N;
-	if (a & 0xFF00)
-		F |= F_C;
-	if (((A ^ n ^ a) & 0x10) == 0x10) // half carry
-		F |= F_H;
-
-	A = a;
-	if (A == 0)
-		F |= F_Z;
+	LAZY_FLAGS (FLAGS_SUB, A, n, 0);
+	A -= n;
 }
 
-void sbc (uint8_t n)
+static inline void sbc (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
+	uint8_t c = (FLAGS & F_C) >> 4;
 #ifdef DEBUG_CPU
-	printf ("    $%.2X - $%.2X - %d\n", A, n, ((F & F_C) >> 4));
+	printf ("    $%.2X - $%.2X - %d\n", A, n, c);
 #endif
-	uint16_t a = A - n - ((F & F_C) >> 4);
-
-	F = F_N;
-	if (a & 0xFF00)
-		F |= F_C;
-	if (((A ^ n ^ a) & 0x10) == 0x10) // half carry
-		F |= F_H;
-
-	A = a;
-	if (A == 0)
-		F |= F_Z;
+	LAZY_FLAGS (FLAGS_SUB, A, n, c);
+	A -= n + c;
 }
 
-void and (uint8_t n)
+static inline void and (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
 #ifdef DEBUG_CPU
 	printf ("    x%.2X & x%.2X\n", A, n);
 #endif
 	A &= n;
-	F = F_H;
-	if (A == 0)
-		F |= F_Z;
+	LAZY_FLAGS (FLAGS_AND, A, 0, 0);
 }
 
-void or (uint8_t n)
+static inline void or (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
 #ifdef DEBUG_CPU
 	printf ("    x%.2X | x%.2X\n", A, n);
 #endif
 	A |= n;
-	F = 0;
-	if (A == 0)
-		F |= F_Z;
+	LAZY_FLAGS (FLAGS_OR, A, 0, 0);
 }
 
-void xor (uint8_t n)
+static inline void xor (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
 	A ^= n;
-	F = 0;
-	if (A == 0)
-		F |= F_Z;
+	LAZY_FLAGS (FLAGS_OR, A, 0, 0);
 }
 
-void cp (uint8_t n)
+static inline void cp (gb_t *gb, gb_cpu_regs *regs, uint8_t n)
 {
 #ifdef DEBUG_CPU
 	printf ("    x%.2X == x%.2X\n", A, n);
 #endif
-	F = F_N;
-	if (A == n)
-		F |= F_Z;
-	if (A < n)
-		F |= F_C;
-	if ((A & 0x0F) < (n & 0x0F))
-		F |= F_H;
+	// same flags as SUB
+	LAZY_FLAGS (FLAGS_SUB, A, n, 0);
 }
 
-void inc (uint8_t *n)
+static inline void inc (gb_t *gb, gb_cpu_regs *regs, uint8_t *n)
 {
-	uint8_t tmp = *n;
+	// C is kept so F needs to be up to date
+	SYNC_FLAGS ();
 	(*n) ++;
-	F &= ~(F_N | F_Z | F_H);
-	if (*n == 0)
-		F |= F_Z;
-	if (((tmp ^ (*n) ^ 1) & 0x10) == 0x10) // half carry
-		F |= F_H;
+	LAZY_FLAGS (FLAGS_INC, *n, 0, 0);
 }
 
-void inc16 (uint16_t* nn)
+static inline void inc16 (gb_t *gb, gb_cpu_regs *regs, uint16_t* nn)
 {
 	(* nn) ++;
 }
 
-void dec16 (uint16_t* nn)
+static inline void dec16 (gb_t *gb, gb_cpu_regs *regs, uint16_t* nn)
 {
 	(* nn) --;
 }
 
-void dec (uint8_t *n)
+static inline void dec (gb_t *gb, gb_cpu_regs *regs, uint8_t *n)
 {
+	SYNC_FLAGS ();
 	(* n) --;
-	F |= F_N;
-	F &= ~(F_Z | F_H);
-	if ((* n) == 0)
-		F |= F_Z;
-	if (((*n) & 0x0F) == 0x0F)
-		F |= F_H;
+	LAZY_FLAGS (FLAGS_DEC, *n, 0, 0);
 }
 
-void swap (uint8_t* n)
+static inline void swap (gb_t *gb, gb_cpu_regs *regs, uint8_t* n)
 {
 	uint16_t tmp = ((*n) & 0xF) << 4; // lower nibble
 	*n = tmp | ((*n) >> 4);
+	DROP_FLAGS ();
 	F = 0;
 	if (*n == 0)
 		F |= F_Z;
 }
 
-void daa ()
+static inline void daa (gb_t *gb, gb_cpu_regs *regs)
 {
 	// this implementation is "inspired" by
 	// https://github.com/deltabeard/Peanut-GB/blob/master/peanut_gb.h#L1786
 
 	uint16_t a = A;
 
+	SYNC_FLAGS ();
 	if (F & F_N)
 	{
 		if (F & F_H)
@@ -613,57 +919,61 @@ void daa ()
 	if (A == 0) F |= F_Z;
 }
 
-void cpl ()
+static inline void cpl (gb_t *gb, gb_cpu_regs *regs)
 {
 	A ^= 0xFF;
+	SYNC_FLAGS ();
 	F |= (F_N | F_H);
 }
 
-void ccf ()
+static inline void ccf (gb_t *gb, gb_cpu_regs *regs)
 {
-	uint8_t tmp = F & F_C;
+	uint8_t tmp = FLAGS & F_C;
 	F &= ~(F_C | F_N | F_H); // reset N H C flags
 	F |= (~tmp & F_C);
 }
 
-void scf ()
+static inline void scf (gb_t *gb, gb_cpu_regs *regs)
 {
+	SYNC_FLAGS ();
 	F &= ~(F_N | F_H); // reset N H flags
 	F |= F_C;
 }
 
-void nop ()
+static inline void nop (gb_t *gb, gb_cpu_regs *regs)
 {
 	// nada
 }
 
-void halt ()
+static inline void halt (gb_t *gb, gb_cpu_regs *regs)
 {
 	// power down cpu until an interrupt occurs.
 	f_halt = 1;
+	gb_sched_schedule (gb, GB_EVENT_IRQ, gb->cc);
 }
 
-void stop ()
+static inline void stop (gb_t *gb, gb_cpu_regs *regs)
 {
 	// halt cpu & display until button pressed
 	// nada ?
 }
 
-void di ()
+static inline void di (gb_t *gb, gb_cpu_regs *regs)
 {
 	ime = 0;
 }
 
-void ei ()
+static inline void ei (gb_t *gb, gb_cpu_regs *regs)
 {
 	ime = 1;
+	check_interrupt (gb);
 }
 
-void rl (uint8_t *n)
+static inline void rl (gb_t *gb, gb_cpu_regs *regs, uint8_t *n)
 {
 	uint8_t tmp = ((*n) & 0x80) >> 7;
 	(*n) <<= 1;
-	(*n) |= (F >> 4) & 1; // bit 0 = C
+	(*n) |= (FLAGS >> 4) & 1; // bit 0 = C
 
 	// reset flags
 	F = tmp << 4; // C = old bit 7
@@ -671,60 +981,64 @@ void rl (uint8_t *n)
 		F |= F_Z;
 }
 
-#define rla() { rl (&A); F &= ~F_Z; }
+#define rla(gb, regs) { rl (gb, regs, &A); F &= ~F_Z; }
 
-void rlc (uint8_t *n)
+static inline void rlc (gb_t *gb, gb_cpu_regs *regs, uint8_t *n)
 {
 	uint8_t tmp = ((*n) & 0x80) >> 7;
 	(*n) <<= 1;
 	(*n) |= tmp;
 
 	// reset flags
+	DROP_FLAGS ();
 	F = tmp << 4; // C = old bit 7
 	if ((*n) == 0)
 		F |= F_Z;
 }
 
-#define rlca() { rlc (&A); F &= ~F_Z; }
+#define rlca(gb, regs) { rlc (gb, regs, &A); F &= ~F_Z; }
 
-void rrc (uint8_t *n)
+static inline void rrc (gb_t *gb, gb_cpu_regs *regs, uint8_t *n)
 {
 	uint8_t tmp = (*n) & 1;
 	(*n) >>= 1;
 	(*n) |= tmp << 7; // bit 0 = old bit 7
 	// reset flags
+	DROP_FLAGS ();
 	F = tmp << 4; // C = old bit 0
 	if ((*n) == 0)
 		F |= F_Z;
 }
 
-#define rrca() { rrc (&A); F &= ~F_Z; }
+#define rrca(gb, regs) { rrc (gb, regs, &A); F &= ~F_Z; }
 
-void rr (uint8_t *n)
+static inline void rr (gb_t *gb, gb_cpu_regs *regs, uint8_t *n)
 {
 	uint8_t tmp = (*n) & 1;
 	(*n) >>= 1;
-	(*n) |= (F << 3) & 0x80; // bit 0 = carry
+	(*n) |= (FLAGS << 3) & 0x80; // bit 0 = carry
 	// reset flags
 	F = tmp << 4; // C = old bit 0
 	if ((*n) == 0)
 		F |= F_Z;
 }
 
-#define rra() { rr (&A); F &= ~F_Z; }
+#define rra(gb, regs) { rr (gb, regs, &A); F &= ~F_Z; }
 
-void sla (uint8_t *n)
+static inline void sla (gb_t *gb, gb_cpu_regs *regs, uint8_t *n)
 {
 	// reset flags
+	DROP_FLAGS ();
 	F = ((*n) & 0x80) >> 3; // C = old bit 7
 	(*n) <<= 1;
 	if ((*n) == 0)
 		F |= F_Z;
 }
 
-void sra (uint8_t* n)
+static inline void sra (gb_t *gb, gb_cpu_regs *regs, uint8_t* n)
 {
 	// reset flags
+	DROP_FLAGS ();
 	F = ((*n) & 1) << 4; // C = old bit 0
 
 	uint8_t msb = (*n) & 0x80;
@@ -735,41 +1049,43 @@ void sra (uint8_t* n)
 		F |= F_Z;
 }
 
-void srl (uint8_t* n)
+static inline void srl (gb_t *gb, gb_cpu_regs *regs, uint8_t* n)
 {
 	// reset flags
+	DROP_FLAGS ();
 	F = ((*n) & 1) << 4; // C = old bit 0
 	(*n) >>= 1;
 	if ((*n) == 0)
 		F |= F_Z;
 }
 
-void bit (uint8_t r, uint8_t b)
+static inline void bit (gb_t *gb, gb_cpu_regs *regs, uint8_t r, uint8_t b)
 {
+	SYNC_FLAGS ();
 	F &= ~(F_N | F_Z);
 	F |= F_H;
 	if (((1 << b) & r) == 0)
 		F |= F_Z;
 }
 
-void set (uint8_t* r, uint8_t b)
+static inline void set (gb_t *gb, gb_cpu_regs *regs, uint8_t* r, uint8_t b)
 {
 	(*r) |= 1 << b;
 }
 
-void res (uint8_t* r, uint8_t b)
+static inline void res (gb_t *gb, gb_cpu_regs *regs, uint8_t* r, uint8_t b)
 {
 	(*r) &= ~(1 << b);
 }
 
 #ifdef DEBUG_CPU
-void jp (uint16_t nn)
+static inline void jp (gb_t *gb, gb_cpu_regs *regs, uint16_t nn)
 {
 	printf (">>> JUMP @ $%.4X\n", nn);
 	PC = nn;
 }
 #else
-#define jp(nn) PC = nn
+#define jp(gb, regs, nn) PC = nn
 #endif
 
 enum jump_cc
@@ -780,76 +1096,75 @@ enum jump_cc
 	JP_CC_C,
 };
 
-/* Keep a flag with extra cycles when conditionals are met.
- * TODO not sure what I think of this solution.
+/**
+ * Macro for conditional jumps/calls.
+ * Returns from the function with the number of extra cycles it takes when the condition
+ * is met.
  */
-static int cond_cc;
-
-/* Macro for conditional jumps/calls. */
 #define CONDITIONAL(inst, cond, c) {\
 	switch (cond)\
 	{\
-		case JP_CC_NZ: if ((F & F_Z) == 0) { cond_cc = c; inst; } break;\
-		case JP_CC_Z:  if ((F & F_Z) != 0) { cond_cc = c; inst; } break;\
-		case JP_CC_NC: if ((F & F_C) == 0) { cond_cc = c; inst; } break;\
-		case JP_CC_C:  if ((F & F_C) != 0) { cond_cc = c; inst; } break;\
+		case JP_CC_NZ: if ((FLAGS & F_Z) == 0) { inst; return c; } break;\
+		case JP_CC_Z:  if ((FLAGS & F_Z) != 0) { inst; return c; } break;\
+		case JP_CC_NC: if ((FLAGS & F_C) == 0) { inst; return c; } break;\
+		case JP_CC_C:  if ((FLAGS & F_C) != 0) { inst; return c; } break;\
 	}\
+	return 0;\
 }
 
-void jpcc (enum jump_cc cond, uint16_t nn)
+static inline int jpcc (gb_t *gb, gb_cpu_regs *regs, enum jump_cc cond, uint16_t nn)
 {
-	CONDITIONAL (jp (nn), cond, 4);
+	CONDITIONAL (jp (gb, regs, nn), cond, 4);
 }
 
 #ifdef DEBUG_CPU
-void jr (int8_t n)
+static inline void jr (gb_t *gb, gb_cpu_regs *regs, int8_t n)
 {
 	printf ("    JUMP @ PC +/- %d (=> $%.4X)\n", n, PC + n);
 	PC += n;
 }
 #else
-#define jr(n) PC += (int8_t) n
+#define jr(gb, regs, n) PC += (int8_t) n
 #endif
 
-void jrcc (enum jump_cc cond, int8_t n)
+static inline int jrcc (gb_t *gb, gb_cpu_regs *regs, enum jump_cc cond, int8_t n)
 {
-	CONDITIONAL (jr (n), cond, 4);
+	CONDITIONAL (jr (gb, regs, n), cond, 4);
 }
 
-#define call(nn) { PUSH (PC); jp (nn); }
+#define call(gb, regs, nn) { PUSH (PC); jp (gb, regs, nn); }
 
-void callcc (enum jump_cc cond, uint16_t nn)
+static ALWAYS_INLINE int callcc (gb_t *gb, gb_cpu_regs *regs, enum jump_cc cond, uint16_t nn, int timed)
 {
-	CONDITIONAL (call (nn), cond, 12);
+	CONDITIONAL (call (gb, regs, nn), cond, 12);
 }
 
-void rst (uint8_t n)
+static ALWAYS_INLINE void rst (gb_t *gb, gb_cpu_regs *regs, uint8_t n, int timed)
 {
-	call (n);
+	call (gb, regs, n);
 }
 
-#define ret() jp (POP ())
+#define ret(gb, regs) jp (gb, regs, POP ())
 
-void retcc (enum jump_cc cond)
+static ALWAYS_INLINE int retcc (gb_t *gb, gb_cpu_regs *regs, enum jump_cc cond, int timed)
 {
-	CONDITIONAL (ret (), cond, 12);
+	CONDITIONAL (ret (gb, regs), cond, 12);
 }
 
-void reti ()
+static ALWAYS_INLINE void reti (gb_t *gb, gb_cpu_regs *regs, int timed)
 {
-	jp (POP ());
+	jp (gb, regs, POP ());
 	ime = 1;
+	check_interrupt (gb);
 }
 
-/* Include generated file with operations. */
-#include "gb/operations.h"
-
-void gb_cpu_flag_interrupt (interrupt_flag f)
+void gb_cpu_flag_interrupt (gb_t *gb, interrupt_flag f)
 {
 #ifdef DEBUG_CPU
 	printf ("%s $%.2X\n", ">>> IRQ", f);
 #endif
 	IF |= f;
+	check_interrupt (gb);
 }
 
 /**
@@ -863,7 +1178,7 @@ void gb_cpu_flag_interrupt (interrupt_flag f)
  *   4. The PC (program counter) is pushed onto the stack.
  *   5. Jump to the starting address of the interrupt.
  */
-void interrupt ()
+static ALWAYS_INLINE void interrupt (gb_t *gb, gb_cpu_regs *regs, int timed)
 {
 	uint8_t f = 1;
 	uint8_t b = 0;
@@ -883,116 +1198,326 @@ void interrupt ()
 #endif
 }
 
+/* dispatch operations with computed goto when the compiler supports it. */
+#if defined(__GNUC__) && !defined(CPU_SWITCH)
+#define CPU_THREADED
+#endif
+
+/* Decoded blocks ------------------------------------------------------------------ */
+
+#define BLOCK_HASH(mem) (((uintptr_t) (mem) ^ ((uintptr_t) (mem) >> 10)) & (GB_CPU_BLOCKS - 1))
+
+/* block without operations, to look up a new one. */
+static const gb_cpu_block no_block;
+
+static const gb_cpu_block *decode_block (gb_t *, uint16_t) ;
+
+/* Block of operations starting at pc, decoded if it is not cached. */
+static ALWAYS_INLINE const gb_cpu_block *get_block (gb_t *gb, uint16_t pc)
+{
+	const uint8_t *mem = gb->cpu.read_map[pc >> 8];
+	if (mem)
+	{
+		mem += pc & 0xFF;
+		const gb_cpu_block *b = &gb->cpu.blocks[BLOCK_HASH (mem)];
+		if (b->mem == mem) return b;
+	}
+	return decode_block (gb, pc);
+}
+
+/* Idle loops -------------------------------------------------------------------- */
+
+/**
+ * A block that changes nothing but registers and jumps back to its start with the
+ * registers as they were will do the same again until the memory it reads changes.
+ * Memory only changes with the next event, so the iterations up to there can be
+ * skipped by moving the clock ahead, e.g. for games polling LY or a flag in WRAM.
+ * The timers are not events when they count, a loop reading them only skips up to
+ * their next change.
+ */
+typedef
+struct idle_loop
+{
+	/* block, registers and cycle at the start of the last iteration. */
+	const gb_cpu_block *block;
+	gb_cpu_regs regs;
+	uint64_t cc;
+}
+idle_loop;
+
+/* Entering an idle block from `prev`, skip the iterations that make no difference. */
+static void skip_idle (gb_t *gb, gb_cpu_regs *regs, const gb_cpu_block *block, const gb_cpu_block *prev, idle_loop *loop, uint64_t end)
+{
+	if (prev == block && loop->block == block && memcmp (&loop->regs, regs, sizeof (gb_cpu_regs)) == 0)
+	{
+		// stop short of the last cycle so that the iteration reaching it is run
+		uint64_t until = end < gb->sched.next ? end : gb->sched.next;
+		if (gb->cpu.timer_read)
+		{
+			uint64_t t = next_timer_change (gb);
+			if (t < until) until = t;
+		}
+		uint64_t n = gb->cc - loop->cc;
+		gb->cc += (until - 1 - gb->cc) / n * n;
+	}
+
+	loop->block = block;
+	loop->regs = *regs;
+	loop->cc = gb->cc;
+	gb->cpu.timer_read = 0;
+}
+
+#ifdef CPU_JIT
+/* Translation of the block, made once it has been entered often enough. */
+static ALWAYS_INLINE gb_cpu_code jit_code (gb_t *gb, const gb_cpu_block *block)
+{
+	// blocks are only const to the CPU loop
+	gb_cpu_block *b = (gb_cpu_block *) block;
+
+	if (b->code || !b->mem || b->hits >= GB_JIT_THRESHOLD) return b->code;
+	if (++ b->hits < GB_JIT_THRESHOLD) return NULL;
+	return b->code = gb_jit_translate (gb, b);
+}
+#elif defined(CPU_AOT)
+/* Block compiled ahead of time, looked up when the block is decoded. */
+static ALWAYS_INLINE gb_cpu_code jit_code (gb_t *gb, const gb_cpu_block *block)
+{
+	return block->code;
+}
+#endif
+
+/* The operations run with the timing of the tier they are included in. */
+#define push(gb, regs, v) push (gb, regs, v, TIMED)
+#define pop(gb, regs, v) pop (gb, regs, v, TIMED)
+#define callcc(gb, regs, cond, nn) callcc (gb, regs, cond, nn, TIMED)
+#define rst(gb, regs, n) rst (gb, regs, n, TIMED)
+#define retcc(gb, regs, cond) retcc (gb, regs, cond, TIMED)
+#define reti(gb, regs) reti (gb, regs, TIMED)
+#define interrupt(gb, regs) interrupt (gb, regs, TIMED)
+#undef call
+#define call(gb, regs, nn) { stack_push (gb, regs, PC, TIMED); jp (gb, regs, nn); }
+#undef ret
+#define ret(gb, regs) jp (gb, regs, stack_pop (gb, regs, TIMED))
+
+/* Include generated file with operations and the CPU loop, once for each tier. */
+#define CPU_RUN run
+#include "gb/operations.h"
+#undef CPU_RUN
+
+#undef TIMED
+#define TIMED 1
+#define CPU_ACCURATE
+#define CPU_RUN run_accurate
+#include "gb/operations.h"
+#undef CPU_RUN
+#undef CPU_ACCURATE
+#undef TIMED
+#define TIMED 0
+
+/* Decode the operation in host memory, the opcode and operands are plain loads. */
+static const operation *decode_mem (const uint8_t *mem, gb_cpu_insn *insn)
+{
+	const operation *o = &operations[mem[0]];
+
+	insn->op = mem[0];
+	insn->imm = 0;
+	if (mem[0] == 0xCB)
+	{
+		o = &operations_cb[mem[1]];
+		insn->op = 0x100 | mem[1];
+	}
+	else if (o->b == 2)
+		insn->imm = mem[1];
+	else if (o->b == 3)
+		insn->imm = mem[1] | (mem[2] << 8);
+	insn->len = o->b;
+
+	// memory is accessed after the operation and its operands are fetched, PUSH, CALL,
+	// RST and RET cc spend a cycle on SP or the condition first
+	uint8_t op = mem[0];
+	insn->at = 4 * o->b;
+	if ((op & 0xCF) == 0xC5 || (op & 0xE7) == 0xC4 || op == 0xCD || (op & 0xC7) == 0xC7 ||
+		(op & 0xE7) == 0xC0)
+		insn->at += 4;
+
+	return o;
+}
+
+int gb_cpu_decode (const uint8_t *mem, gb_cpu_insn *insn) { return decode_mem (mem, insn)->jump; }
+
+/**
+ * Decode the operation at pc, reading through the memory map. Only for operations that
+ * are not in a mapped page or cross into the next one, blocks read their page directly.
+ */
+static const operation *decode (gb_t *gb, uint16_t pc, gb_cpu_insn *insn)
+{
+	uint8_t bytes[3] = { RAM (pc) };
+	unsigned int len = bytes[0] == 0xCB ? 2 : operations[bytes[0]].b;
+	for (unsigned int i = 1; i < len; i ++)
+		bytes[i] = RAM (pc + i);
+
+	return decode_mem (bytes, insn);
+}
+
+/* Replace the first operation of each sequence in the block that is run as one. */
+static void fuse (gb_cpu_block *b)
+{
+	for (int i = 0; i < b->n; i ++)
+	{
+		for (int f = 0; f < GB_CPU_FUSIONS; f ++)
+		{
+			int n = gb_cpu_fusions[f][0], k = 0;
+			while (k < n && i + k < b->n && b->ops[i + k].op == gb_cpu_fusions[f][1 + k]) k ++;
+			if (k < n) continue;
+
+			b->ops[i].op = 0x200 + f;
+			i += n - 1;
+			break;
+		}
+	}
+}
+
+/**
+ * Decode the block starting at pc and cache it.
+ *
+ * An operation that can not be cached, because its page is not mapped or it crosses
+ * into the next page, is decoded on its own each time it runs.
+ */
+static const gb_cpu_block *decode_block (gb_t *gb, uint16_t pc)
+{
+	uint8_t page = pc >> 8;
+	uint8_t *mem = gb->cpu.read_map[page];
+	gb_cpu_block *b;
+
+	if (mem && gb->cpu.code_writes[page] < GB_CPU_CODE_WRITES && protect (gb, mem))
+	{
+		b = &gb->cpu.blocks[BLOCK_HASH (mem + (pc & 0xFF))];
+		b->mem = mem + (pc & 0xFF);
+		b->n = b->cc = 0;
+		b->idle = 1;
+		b->code = NULL;
+		b->hits = 0;
+
+		const operation *o = NULL;
+		for (unsigned int off = pc & 0xFF; b->n < GB_CPU_BLOCK_OPS; )
+		{
+			unsigned int len = mem[off] == 0xCB ? 2 : operations[mem[off]].b;
+			if (off + len > GB_CPU_PAGE_SIZE) break;
+
+			o = decode_mem (mem + off, &b->ops[b->n ++]);
+			b->cc += o->cc;
+			b->idle &= o->idle;
+			off += len;
+
+			if (o->jump) break;
+		}
+		// only a block that ends with a jump can loop
+		if (!o || !o->jump) b->idle = 0;
+		fuse (b);
+#ifdef CPU_AOT
+		b->code = gb_aot_code (gb, b->mem);
+#endif
+
+		if (b->n > 0) return b;
+		b->mem = NULL;
+	}
+
+	b = &gb->cpu.uncached;
+	b->n = 1;
+	b->idle = 0;
+	b->cc = decode (gb, pc, b->ops)->cc;
+	return b;
+}
+
+void gb_cpu_flush (gb_t *gb)
+{
+	while (gb->cpu.n_code_pages > 0)
+		invalidate (gb, gb->cpu.code_pages[0]);
+
+	memset (gb->cpu.blocks, 0, sizeof (gb->cpu.blocks));
+	memset (gb->cpu.code_writes, 0, sizeof (gb->cpu.code_writes));
+}
+
 /**
  * Reset the CPU.
  */
-void gb_cpu_reset (uint8_t dmg)
+void gb_cpu_reset (gb_t *gb, uint8_t dmg)
 {
+	gb_cpu_regs *regs = &gb->cpu.regs;
+
 	PC = 0x100;
 	SP = 0xFFFE;
 
 	AF = 0x11B0;
+	DROP_FLAGS ();
 	BC = 0x0013;
 	DE = 0x00D8;
 	HL = 0x014D;
 
 	ime = 1;
 	f_halt = 0;
-	cond_cc = 0;
+	gb->cpu.run_page = -1;
 
 	// reset memory read/write handlers and add the default ones.
 
-	n_store_handlers = 0;
-	gb_cpu_register_store_handler (oam_dma_transf_handler);
-	gb_cpu_register_store_handler (write_div_h);
-	gb_cpu_register_store_handler (write_unused_ram_h);
-	gb_cpu_register_store_handler (write_echo_ram_h);
+	clear_handlers (&gb->cpu.stores);
+	gb_cpu_register_store_handler (gb, 0xFEA0, 0xFEFF, 0, write_unused_ram_h);
+	gb_cpu_register_store_handler (gb, DIV_LOC, 0xFF07, 0, write_timer_h);
+	gb_cpu_register_store_handler (gb, 0xFF0F, 0xFF0F, 0, write_if_h);
+	gb_cpu_register_store_handler (gb, 0xFF46, 0xFF46, 0, oam_dma_transf_handler);
+
+	clear_handlers (&gb->cpu.reads);
+	gb_cpu_register_read_handler (gb, 0xFEA0, 0xFEFF, 0, read_unused_ram_h);
+	gb_cpu_register_read_handler (gb, DIV_LOC, 0xFF05, 0, read_timer_h);
 
-	n_read_handlers = 0;
-	gb_cpu_register_read_handler (read_unused_ram_h);
-	gb_cpu_register_read_handler (read_echo_ram_h);
+	gb_cpu_flush (gb);
 
-	// wram
-	gb_cpu_register_store_handler (write_wram_handler);
-	gb_cpu_register_read_handler (read_wram_handler);
-	wram_bank = wram;
-	memset (wram, 0, 0x7000);
+	gb->cpu.wram_bank = gb->cpu.wram;
+	memset (gb->cpu.wram, 0, 0x7000);
 
-	memset (ram, 0, 1 << 16);
+	memset (RAM_, 0, 1 << 16);
+
+	// memory map, the MBC and the PPU take care of their own regions. ROM is
+	// mapped once it is loaded and never for stores as they are commands to the MBC.
+	memset (gb->cpu.read_map, 0, sizeof (gb->cpu.read_map));
+	memset (gb->cpu.store_map, 0, sizeof (gb->cpu.store_map));
+	gb_cpu_map (gb, 0x8000, 0x5000, RAM_ + 0x8000, GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
+	gb_cpu_map (gb, 0xD000, 0x1000, gb->cpu.wram_bank, GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
+	// echo RAM
+	gb_cpu_map (gb, 0xE000, 0x1E00, RAM_ + 0xC000, GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
 
 	// cgb mode
 	if (!dmg)
 	{
 		// vram dma
-		gb_cpu_register_store_handler (write_vram_dma_handler);
+		gb_cpu_register_store_handler (gb, HDMA5, HDMA5, 0, write_vram_dma_handler);
 		// wram bank switch
-		gb_cpu_register_store_handler (write_wram_bank_handler);
+		gb_cpu_register_store_handler (gb, SVBK_LOC, SVBK_LOC, 0, write_wram_bank_handler);
 	}
 
 	// reset timers
-	divcc = timacc = 0;
+	gb->cpu.divcc = gb->cpu.timacc = 0;
+	gb->cpu.timer_cc = gb->cc;
+	gb_sched_register (gb, GB_EVENT_TIMER, timer_event);
+	gb_sched_register (gb, GB_EVENT_IRQ, NULL);
+	schedule_timers (gb);
 }
 
-/* macro to check if an interrupt is requested and enabled. */
-#define IRQ (IE & IF)
-
 /**
  * Step the CPU, executing one operation.
  *
  * Returns the number of CPU cycles it took to perform the operation.
  */
-int gb_cpu_step ()
+int gb_cpu_step (gb_t *gb)
 {
-	int cc = 0;
-
-	if (f_halt)
-	{
-		// if the CPU is halted and an interrupt is requested we unset the halt flag
-		// else if just increment four cycles the timers and return.
-
-		if (IRQ)
-			f_halt = 0;
-		else
-		{
-			cc = 4;
-			goto inc;
-		}
-	}
-
-	// check any interrupts
-	if (ime && IRQ)
-	{
-		interrupt ();
-		cc = 5;
-	}
-
-	// load an opcode and perform the operation associated,
-	// step the PC and clock the number of cycles
-
-#ifdef DEBUG_CPU
-	printf ("$%.4X: ", PC);
-#endif
-
-	uint8_t opcode = RAM (PC ++);
-	const operation* op = &operations[opcode];
-
-#ifdef DEBUG_CPU
-	// hijack in debug mode so we can print the operation
-	if (opcode == 0xCB) op = &operations_cb[RAM (PC ++)];
-	printf
-	(
-		"%-20s AF = x%.4X BC = x%.4X DE = x%.4X HL = x%.4X SP = x%.4X IF = x%.2X IE = 0x%.2X IME = %d\n",
-		op->name, AF, BC, DE, HL, SP, IF, IE, ime
-	);
-#endif
-
-	cc += op->instruction () + cond_cc;
-	cond_cc = 0;  // reset in case it was set
-
-inc:
-	// increment timers
-	inc_div (cc);
-	inc_tima (cc);
+	return gb_cpu_run (gb, 1);
+}
 
-	return cc;
+uint32_t gb_cpu_run (gb_t *gb, uint32_t budget)
+{
+	uint64_t start = gb->cc;
+	if (gb->cpu.accurate) run_accurate (gb, start + budget);
+	else run (gb, start + budget);
+	gb->cpu.run_page = -1;
+	return gb->cc - start;
 }
@@ -4,29 +4,43 @@
 #include "gb/mbc.h"
 #include "gb/io.h"
 #include "gb/apu.h"
+#include "gb/sched.h"
+#include "gb/core.h"
+#ifdef CPU_JIT
+#include "gb/jit.h"
+#endif
+#ifdef CPU_AOT
+#include "gb/aot.h"
+#endif
 #include "gb.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 
-static int sample_rate;
-
-static int n_step_cbs;
-static void (*step_cbs[5]) (uint32_t);
-
-void gb_add_step_callback (void (*cb) (uint32_t))
+void gb_add_step_callback (gb_t *gb, void (*cb) (gb_t *, uint32_t))
 {
-	step_cbs [n_step_cbs ++] = cb;
+	gb->step_cbs [gb->n_step_cbs ++] = cb;
 }
 
-void gb_init (int sample_rate_)
+gb_t *gb_init (int sample_rate)
 {
-	sample_rate = sample_rate_;
+	gb_t *gb = calloc (1, sizeof (gb_t));
+	if (!gb) return NULL;
+
+	gb->sample_rate = sample_rate;
+	return gb;
 }
 
-int gb_load (const uint8_t *ROM, uint8_t **RAM, size_t *ram_size)
+void gb_set_accuracy (gb_t *gb, gb_accuracy a) { gb->accuracy = a; }
+
+int gb_load (gb_t *gb, const uint8_t *ROM, uint8_t **RAM, size_t *ram_size)
 {
-	n_step_cbs = 0;
+	gb->n_step_cbs = 0;
+	gb->cc = gb->step_end = 0;
+#ifdef CPU_AOT
+	// blocks compiled from another ROM
+	gb_aot_quit (gb);
+#endif
 
 	gb_cartridge_header h;
 	if (gb_load_cartridge (ROM, &h, RAM, ram_size) != 0) return 1;
@@ -40,51 +54,70 @@ int gb_load (const uint8_t *ROM, uint8_t **RAM, size_t *ram_size)
 	}
 
 	// reset all units
-	gb_cpu_reset (!cgb);
-	gb_ppu_reset (!cgb);
-	gb_io_reset ();
-	gb_apu_reset (sample_rate);
+	gb_sched_reset (gb);
+	gb_sched_register (gb, GB_EVENT_STEP, NULL);
+	gb_cpu_reset (gb, !cgb);
+	gb->cpu.accurate = gb->accuracy == GB_ACCURACY_MCYCLE;
+	gb_ppu_reset (gb, !cgb);
+	gb_io_reset (gb);
+	gb_apu_reset (gb, gb->sample_rate);
 
-	gb_load_mbc (h, *RAM);
+	gb->mbc.ram_size = *ram_size;
+	gb_load_mbc (gb, h, *RAM);
 
 	// load ROM
 	// TODO
 	// i think this should be part of the reset instead.
-	gb_cpu_load_rom (h.rom_size, ROM);
+	gb_cpu_load_rom (gb, h.rom_size, ROM);
 
 	return 0;
 }
 
-void gb_press_button (gb_button b) { gb_io_press_button (b); }
+void gb_press_button (gb_t *gb, gb_button b) { gb_io_press_button (gb, b); }
 
-void gb_release_button (gb_button b) { gb_io_release_button (b); }
+void gb_release_button (gb_t *gb, gb_button b) { gb_io_release_button (gb, b); }
 
-const uint16_t *gb_lcd () { return gb_ppu_lcd (); }
+const uint16_t *gb_lcd (gb_t *gb) { return gb_ppu_lcd (gb); }
 
-void gb_audio_samples (float *buf, size_t *n) { gb_apu_samples (buf, n); }
+void gb_audio_samples (gb_t *gb, float *buf, size_t *n) { gb_apu_samples (gb, buf, n); }
 
-uint32_t gb_step (uint32_t ccs)
+uint32_t gb_step (gb_t *gb, uint32_t ccs)
 {
-	static uint32_t cpucc = 0;
-	uint32_t prev_cpucc = cpucc, cc = 0;
+	uint64_t start = gb->cc;
 
-	while (cpucc < ccs)
-	{
-		// step all units
-		cc = gb_cpu_step ();
-		gb_ppu_step (cc);
-		gb_apu_step (cc);
+	// the cycles that ran past the end of the last step count towards this one
+	gb->step_end += ccs;
+	gb_sched_schedule (gb, GB_EVENT_STEP, gb->step_end);
 
-		for (int i = 0; i < n_step_cbs; i ++)
-			step_cbs[i] (cc);
+	while (gb->cc < gb->step_end)
+	{
+		// run the CPU until the next event is due, the other units only need to
+		// catch up when an event is reached or the CPU accesses their registers.
+		if (gb->cc < gb->sched.next)
+			gb_cpu_run (gb, gb->step_end - gb->cc);
 
-		cpucc += cc;
+		gb_sched_dispatch (gb);
 	}
 
-	uint32_t ret = cpucc - prev_cpucc;  // number of cycles that ran
-	cpucc -= ccs;
+	// bring the units up to date so the screen and audio can be read
+	gb_ppu_sync (gb);
+	gb_apu_sync (gb);
+
+	uint32_t cc = gb->cc - start;  // number of cycles that ran
+
+	for (int i = 0; i < gb->n_step_cbs; i ++)
+		gb->step_cbs[i] (gb, cc);
 
-	return ret;
+	return cc;
 }
 
-void gb_quit () { }  // nada
+void gb_quit (gb_t *gb)
+{
+#ifdef CPU_JIT
+	gb_jit_quit (gb);
+#endif
+#ifdef CPU_AOT
+	gb_aot_quit (gb);
+#endif
+	free (gb);
+}
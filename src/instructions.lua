@@ -1,5 +1,18 @@
 -- instructions.lua
 -- Generates source code from src/instructions into include/gameboy/operations.h
+--
+-- Each operation becomes a labeled block of code within a single CPU loop that runs until
+-- the next event. Labels are jumped to with computed goto, or cases of a switch statement
+-- when the compiler does not support it. CB prefixed operations are at 0x100 + opcode.
+--
+-- Operations are run from decoded blocks, the immediate operand has already been read
+-- and is found through IMM8/IMM16.
+--
+-- The tables are only written once, the loop is included by cpu.c for each tier of
+-- accuracy with CPU_RUN as its name and CPU_ACCURATE defined for the accurate one.
+--
+-- When built with the JIT (CPU_JIT) or AOT (CPU_AOT) every operation is also written as
+-- a function that translated and compiled blocks can call.
 
 -- trim the line from comments and whitespace
 function trimline(line)
@@ -8,35 +21,25 @@ function trimline(line)
 	return line
 end
 
--- create the function name
-function fname(i, p)
-	if string.match(p, "-/-") then
-		suffix = ""
-	else
-		suffix = string.gsub(p, "[,%(%)]", "_") .. "__"
-	end
-	return string.format("__%s__%s", i:lower(), suffix)
-end
-
 function clean_params(params)
 	return string.gsub(params, "[%(%)-/-]", "")
 end
 
 function call_ld(instruction, params)
 	c = ""
-	-- (n) : $FF00 | RAM (pc ++)
+	-- (n) : $FF00 | n
 	if string.match(params, "%(n%)") then
-		c = "uint16_t n = 0xFF00 | RAM (pc ++); "
+		c = "uint16_t n = 0xFF00 | IMM8; "
 	-- (r) : $FF00 | r
 	elseif string.match(params, "%(%a%)") then
 		c = "uint16_t nn = 0xFF00 | C; "
 		params = string.gsub(params, "(%(%a%))", "(nn)")
-	-- (nn)/nn : RAM (pc ++) | (RAM (pc ++) << 8)
+	-- (nn)/nn
 	elseif string.match(params, "nn") then
-		c = "uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); "
-	-- n : RAM (pc ++)
+		c = "uint16_t nn = IMM16; "
+	-- n
 	elseif string.match(params, "n") then
-		c = "uint8_t n = RAM (pc ++); "
+		c = "uint8_t n = IMM8; "
 	end
 
 	-- if source is in memory we need to make a RAM call
@@ -74,17 +77,23 @@ function call(instruction, params)
 	end
 
 	-- POP AF is another special case that needs to always unset last 3 bits of F
+	-- and drops the flags of the last operation
 	if instruction == "POP" and params == "AF" then
-		return "pop (&AF); F &= 0xF0;"
+		return "pop (gb, regs, &AF); F &= 0xF0; DROP_FLAGS ();"
+	end
+
+	-- PUSH AF needs the flags of the last operation in F
+	if instruction == "PUSH" and params == "AF" then
+		return "SYNC_FLAGS (); push (gb, regs, AF);"
 	end
 
 	prefix = ""
 	-- if the instruction reads immediate bytes we need to preprend this to the call
 	if params:match",?nn?$" then
 		if params:match"nn" then
-			prefix = "uint16_t nn = RAM (pc ++); nn |= (RAM (pc ++) << 8); "
+			prefix = "uint16_t nn = IMM16; "
 		elseif params:match"n" then
-			prefix = "uint8_t n = RAM (pc ++); "
+			prefix = "uint8_t n = IMM8; "
 		end
 	end
 
@@ -113,7 +122,7 @@ function call(instruction, params)
 	-- special case when it is pointer parameters using (HL) as destination which stores to mem
 	if pointerparams[instruction] and params:match"^%(HL%)" then
 		params = params:gsub("^(%(HL%))", "&n")
-		return string.format("uint8_t n = RAM (HL); %s (%s); STORE (HL, n);", instruction:lower(), params)
+		return string.format("uint8_t n = RAM (HL); %s (gb, regs, %s); STORE (HL, n);", instruction:lower(), params)
 	end
 
 	if params:match"%(HL%)" then
@@ -125,7 +134,89 @@ function call(instruction, params)
 	if pointerparams[instruction] then
 		params = "&" .. params
 	end
-	return prefix .. string.format("%s (%s);", instruction:lower(), params);
+
+	-- all helpers take the emulator instance and the registers as first arguments
+	if params == "" then
+		params = "gb, regs"
+	else
+		params = "gb, regs, " .. params
+	end
+
+	-- conditional instructions return the extra cycles when the condition is met
+	if instruction:match"CC$" then
+		return prefix .. string.format("cc += %s (%s);", instruction:lower(), params)
+	end
+	return prefix .. string.format("%s (%s);", instruction:lower(), params)
+end
+
+-- number of bytes of an operation with the opcode and its immediate operand
+function bytes(params)
+	if params:match"nn" then
+		return 3
+	elseif params:match"n" then
+		return 2
+	end
+	return 1
+end
+
+-- operations that can change the program counter, they end a decoded block
+local jumps = {
+	["JP"] = true,
+	["JPCC"] = true,
+	["JR"] = true,
+	["JRCC"] = true,
+	["CALL"] = true,
+	["CALLCC"] = true,
+	["RET"] = true,
+	["RETCC"] = true,
+	["RETI"] = true,
+	["RST"] = true,
+	["HALT"] = true,
+	["STOP"] = true,
+}
+
+-- operations that change more than the registers, besides storing to memory. loops
+-- without them and without stores can be skipped as idle.
+local effects = {
+	["PUSH"] = true,
+	["POP"] = true,
+	["CALL"] = true,
+	["CALLCC"] = true,
+	["RET"] = true,
+	["RETCC"] = true,
+	["RETI"] = true,
+	["RST"] = true,
+	["HALT"] = true,
+	["STOP"] = true,
+	["EI"] = true,
+	["DI"] = true,
+}
+
+-- sequences of operations that run as one when they follow each other in a decoded
+-- block, longer ones first. picked from the pairs that run most often in the test ROMs
+-- and the copy loops of games, CB prefixed operations are at 0x100 + opcode.
+local fusions = {
+	{ 0x2A, 0x12, 0x13 }, -- LDI A,(HL) LD (DE),A INC16 DE: copy from HL to DE
+	{ 0x0B, 0x78, 0xB1 }, -- DEC16 BC LD A,B OR C: count down BC
+	{ 0x78, 0xB1, 0x20 }, -- LD A,B OR C JR NZ: loop while BC is not zero
+	{ 0x22, 0x0B, 0x78 }, -- LDI (HL),A DEC16 BC LD A,B: fill from HL
+	{ 0xF0, 0xFE, 0x20 }, -- LD A,(n) CP n JR NZ: poll an IO register
+	{ 0x1A, 0x22, 0x13 }, -- LD A,(DE) LDI (HL),A INC16 DE: copy from DE to HL
+	{ 0xFE, 0x20 },       -- CP n JR NZ
+	{ 0xFE, 0x28 },       -- CP n JR Z
+	{ 0xF0, 0xFE },       -- LD A,(n) CP n
+	{ 0xB1, 0x20 },       -- OR C JR NZ
+	{ 0x05, 0x20 },       -- DEC B JR NZ
+	{ 0x0D, 0x20 },       -- DEC C JR NZ
+	{ 0x23, 0x23 },       -- INC16 HL INC16 HL
+	{ 0x7E, 0x80 },       -- LD A,(HL) ADD B
+	{ 0x79, 0x22 },       -- LD A,C LDI (HL),A
+	{ 0xF5, 0xC1 },       -- PUSH AF POP BC
+}
+
+-- the operation changes nothing but registers
+function idle(it, str)
+	return (effects[it] or str:match"STORE") and 0 or 1
 end
 
 local operations_CB = {}
@@ -141,25 +232,37 @@ function operation(line)
 	local pm = tokens[2]
 	local op = tokens[3]
 	local cc = tokens[4]
-	local fn = fname(it, pm)
 
 	op_map = operations
+	b = bytes(pm)
 
 	if op:match"^CB" then
 		op = op:gsub("CB(..)", "%1")
 		op_map = operations_CB
+		b = 2
 	end
 
 	op = tonumber("0x" .. op)
+	local str = string.format("{ %s cc += %s; }", call(it, pm), cc)
 	op_map[op] =  {
 		["inst"] = it,
 		["asm"] = string.format("%s %s", it, pm),
-		["str"] = string.format("int %s () { %s return %s; }", fn, call(it, pm), cc),
+		["str"] = str,
+		["b"] = b,
 		["cc"] = tonumber(cc),
-		["fn"] = fn,
+		["jump"] = jumps[it] and 1 or 0,
+		["idle"] = idle(it, str),
 	}
+end
 
-	return op_map[op]["str"]
+-- write the table with debugging information for a map of operations
+function write_table(name, op_map)
+	io.write(string.format("\nconst operation %s[256] = {\n", name))
+	for op = 0, 255, 1 do
+		io.write(string.format("// %.2X: %s\n", op, op_map[op]["asm"]))
+		io.write(string.format("{ \"%s\", %d, %d, %d, %d },\n", op_map[op]["asm"], op_map[op]["b"], op_map[op]["cc"], op_map[op]["jump"], op_map[op]["idle"]))
+	end
+	io.write("};\n")
 end
 
 -----------------------------------------------------------------------------------------------------
@@ -171,7 +274,7 @@ io.output(file)
 
 -- write a comment about the file
 io.write([[/**
-* operations.h: contains all the CPU operations mapped by opcode.
+* operations.h: contains all the CPU operations mapped by opcode and the loop running them.
 * This file has been autogenerated by using `lua instructions.lua`.
 */
 
@@ -186,18 +289,20 @@ struct operation
 	// name is the debugging name of the operation.
 	const char* name;
 
-	// the instruction to be executed
-	const int (*instruction)();
-
 	// number of bytes the operation consumes
 	const uint8_t b;
 
 	// number of cycles the operation needs.
 	// in some cases there might be more in the case of e.g. branching.
 	const uint8_t cc;
+
+	// the operation can change the program counter.
+	const uint8_t jump;
+
+	// the operation changes nothing but registers, so it can be part of an idle loop.
+	const uint8_t idle;
 }
 operation;
-
 ]])
 
 -- not all possible opcodes are mapped to an operation.
@@ -205,14 +310,14 @@ operation;
 -- as we parse the file.
 -- The CBxx all make exactly 256 operations so no need there.
 
-io.write("int invalid_op () { fprintf (stderr, \"$%.4X: INVALID OPERATION\\n\", pc); return 0; }", "\n")
-
 local invalid_instruction = {
 	["inst"] = "INVALID",
 	["asm"] = "INVALID",
 	["str"] = "",
+	["b"] = 1,
 	["cc"] = 0,
-	["fn"] = "invalid_op",
+	["jump"] = 1,
+	["idle"] = 0,
 }
 
 for i = 0, 255, 1 do
@@ -222,45 +327,282 @@ end
 -- iterate over all lines in the file and create an instruction for each
 for line in io.lines("src/instructions") do
 	line = trimline(line)
-	if line ~= "" then io.write(operation(line), "\n") end
+	if line ~= "" then operation(line) end
 end
 
--- create CBxx operations
-io.write("\nconst operation operations_cb[256] = {\n")
-for op = 0, 255, 1 do
-	io.write(string.format("// %.2X: %s\n", op, operations_CB[op]["asm"]))
-	io.write(string.format(
-		"{ \"%s\", &%s, 0, %d },\n",
-		operations_CB[op]["asm"],
-		operations_CB[op]["fn"],
-		operations_CB[op]["cc"]
-	))
-end
-io.write("};\n")
-
--- create the special CB instruction that runs instruction from the `operations_cb` map
-io.write("int __cbxx__() { uint8_t op = RAM (pc ++); return operations_cb[op].instruction(); }\n")
+-- the CB prefix is decoded together with the operation that follows it, which is found
+-- in the CBxx operations. it has no code of its own.
 operations[0xCB] = {
 	["inst"] = "CBXX",
 	["asm"] = "-- CBXX --",
 	["str"] = "",
-	["fn"] = "__cbxx__",
+	["b"] = 2,
 	["cc"] = 8, -- TODO this is not always true!!
+	["jump"] = 0,
+	["idle"] = 0,
 }
 
--- all 8-bit instructions
-io.write("\nconst operation operations[256] = {\n")
-for op = 0, 255, 1 do
-	io.write(string.format("// %.2X: %s\n", op, operations[op]["asm"]))
-	io.write(string.format(
-		"{ \"%s\", &%s, 0, %d },\n",
-		operations[op]["asm"],
-		operations[op]["fn"],
-		operations[op]["cc"]
-	))
+write_table("operations_cb", operations_CB)
+write_table("operations", operations)
+
+-- the fused sequences for the decoder, the number of operations followed by them
+io.write(string.format([[
+
+/* Sequences of operations that are run as one, found at 0x200 + index. */
+#define GB_CPU_FUSIONS %d
+const uint16_t gb_cpu_fusions[GB_CPU_FUSIONS][4] = {
+]], #fusions))
+for _, f in ipairs(fusions) do
+	io.write(string.format("{ %d, 0x%.3X, 0x%.3X, 0x%.3X },\n", #f, f[1], f[2], f[3] or 0))
 end
 io.write("};\n")
 
-io.write("#endif\n")
+-- label of the code for an opcode, CB prefixed operations come after the others
+function label(op)
+	if op >= 0x100 and operations_CB[op - 0x100] then return string.format("%.3X", op) end
+	if op < 0x100 and operations[op] ~= invalid_instruction and op ~= 0xCB then return string.format("%.3X", op) end
+	return nil
+end
+
+-- the CPU loop
+io.write([[
+
+#endif /* GB_CPU_OPERATIONS_H */
+
+/**
+ * Run operations until the cycle `end` or until the next event is due. At least one
+ * operation is run.
+ *
+ * Registers are kept in locals for the duration of the run and are written back when
+ * done.
+ *
+ * HALT and interrupts are only looked at when the run starts. Whatever requests or
+ * enables an interrupt, or halts the CPU, schedules GB_EVENT_IRQ to end the run after
+ * the operation, so the loop itself does not check for them. So does a change of the
+ * memory map, e.g. a bank switch, as the block might have been decoded from the memory
+ * mapped before.
+ *
+ * Operations are fetched from decoded blocks, the block is looked up again once all of
+ * its operations have run. Sequences that often follow each other are fused into one
+ * operation, which saves dispatching the ones after the first. Blocks that loop without
+ * doing anything are skipped ahead, see `skip_idle`.
+ *
+ * With CPU_ACCURATE each operation sets the cycle at which it accesses memory, so the
+ * handlers of IO registers run at the M-cycle of the access instead of at the start of
+ * the operation, see `access_begin`. Translated and compiled blocks are not run as
+ * their operations do not keep track of it.
+ */
+static void CPU_RUN (gb_t *gb, uint64_t end)
+{
+	gb_cpu_regs local = gb->cpu.regs, *regs = &local;
+	const gb_cpu_block *block = &no_block, *prev;
+	idle_loop idle = { NULL };
+	gb_cpu_insn insn;
+	unsigned int op, i = 0;
+	int cc;
+
+#ifdef CPU_THREADED
+	static const void *const dispatch_table[] = {
+]])
+
+for op = 0, 0x1FF, 1 do
+	local l = label(op)
+	if op % 8 == 0 then io.write("\t\t") end
+	io.write(l and string.format("&&op_%s,", l) or "&&op_invalid,")
+	io.write(op % 8 == 7 and "\n" or " ")
+end
+for f = 1, #fusions, 1 do
+	io.write(string.format("\t\t&&op_%.3X,\n", 0x1FF + f))
+end
+
+io.write([[
+	};
+#define OP(x) op_##x:
+#define INVALID op_invalid:
+#define DISPATCH(op) goto *dispatch_table[op];
+#else
+#define OP(x) case 0x##x:
+#define INVALID default:
+#define DISPATCH(op) switch (op)
+#endif
+#define NEXT goto next
+#define IMM8 ((uint8_t) insn.imm)
+#define IMM16 (insn.imm)
+
+// go on with the next operation of a fused sequence, unless it has to be run on its own
+// as the block was invalidated or an event is due in between.
+#define FUSE \
+	gb->cc += cc; \
+	cc = 0; \
+	if (i >= block->n || gb->cc >= end || gb->cc >= gb->sched.next) NEXT; \
+	insn = block->ops[i ++]; \
+	PC += insn.len; \
+	ACCESS_AT ();
+
+#ifdef CPU_ACCURATE
+// memory is accessed in the M-cycles after the operation and its operands are fetched
+#define ACCESS_AT() gb->cpu.access_cc = gb->cc + cc + insn.at
+#else
+#define ACCESS_AT()
+#endif
+
+	if (f_halt)
+	{
+		// stay halted until an interrupt is requested, which only an event can do, so
+		// the clock moves on to it in steps of 4 cycles
+		if (!IRQ)
+		{
+			uint64_t until = end < gb->sched.next ? end : gb->sched.next;
+			gb->cc += until > gb->cc ? (until - gb->cc + 3) & ~3ULL : 4;
+			return;
+		}
+		f_halt = 0;
+	}
+
+	cc = 0;
+	if (ime && IRQ)
+	{
+#ifdef CPU_ACCURATE
+		// the return address is pushed in the 4th and 5th M-cycle of the 5 it takes
+		gb->cpu.access_cc = gb->cc + 12;
+		interrupt (gb, regs);
+		cc = 20;
+#else
+		interrupt (gb, regs);
+		cc = 5;
+#endif
+	}
+
+	do
+	{
+#ifdef DEBUG_CPU
+		SYNC_FLAGS ();
+		printf ("$%.4X: ", PC);
+		printf
+		(
+			"%-20s AF = x%.4X BC = x%.4X DE = x%.4X HL = x%.4X SP = x%.4X IF = x%.2X IE = 0x%.2X IME = %d\n",
+			RAM (PC) == 0xCB ? operations_cb[RAM (PC + 1)].name : operations[RAM (PC)].name,
+			AF, BC, DE, HL, SP, IF, IE, ime
+		);
+#endif
+
+		if (i >= block->n)
+		{
+			prev = block;
+			block = get_block (gb, PC);
+			gb->cpu.run_page = PC >> 8;
+			i = 0;
+
+			if (block->idle)
+				skip_idle (gb, regs, block, prev, &idle, end);
+#if (defined(CPU_JIT) || defined(CPU_AOT)) && !defined(CPU_ACCURATE)
+			// run the translated block, it returns how many operations it got through
+			gb_cpu_code code = jit_code (gb, block);
+			if (code && cc == 0)
+			{
+				i = code (gb, regs, end);
+				continue;
+			}
+#endif
+		}
+		insn = block->ops[i ++];
+		PC += insn.len;
+		op = insn.op;
+		ACCESS_AT ();
+
+		DISPATCH (op)
+		{
+]])
+
+for op = 0, 0x1FF, 1 do
+	local l = label(op)
+	if l then
+		local o = op < 0x100 and operations[op] or operations_CB[op - 0x100]
+		io.write(string.format("\t\t\t// %s\n", o["asm"]))
+		io.write(string.format("\t\t\tOP (%s) %s NEXT;\n", l, o["str"]))
+	end
+end
+
+-- fused operations run the code of each operation in turn
+for f, ops in ipairs(fusions) do
+	local asm, str = {}, {}
+	for _, op in ipairs(ops) do
+		local o = op < 0x100 and operations[op] or operations_CB[op - 0x100]
+		asm[#asm+1] = o["asm"]
+		str[#str+1] = o["str"]
+	end
+	io.write(string.format("\t\t\t// %s\n", table.concat(asm, " + ")))
+	io.write(string.format("\t\t\tOP (%.3X) %s NEXT;\n", 0x1FF + f, table.concat(str, " FUSE ")))
+end
+
+io.write([[
+			// INVALID
+			INVALID { fprintf (stderr, "$%.4X: INVALID OPERATION\n", PC); } NEXT;
+		}
+next:
+		gb->cc += cc;
+		cc = 0;
+	}
+	while (gb->cc < end && gb->cc < gb->sched.next);
+
+#ifdef CPU_ACCURATE
+	// accesses from outside the loop happen at the current cycle
+	gb->cpu.access_cc = 0;
+#endif
+	SYNC_FLAGS ();
+	gb->cpu.regs = local;
+}
+
+#undef OP
+#undef INVALID
+#undef DISPATCH
+#undef NEXT
+#undef FUSE
+#undef ACCESS_AT
+#undef IMM8
+#undef IMM16
+]])
+
+-- with the JIT each operation is also a function that returns the number of cycles it
+-- took, translated blocks call these for the operations they do not emit code for. they
+-- are written with the fast loop.
+io.write([[
+
+#if (defined(CPU_JIT) || defined(CPU_AOT)) && !defined(CPU_ACCURATE)
+#define IMM8 ((uint8_t) imm)
+#define IMM16 (imm)
+
+]])
+
+for op = 0, 0x1FF, 1 do
+	local l = label(op)
+	if l then
+		local o = op < 0x100 and operations[op] or operations_CB[op - 0x100]
+		io.write(string.format("// %s\n", o["asm"]))
+		io.write(string.format("static int jit_op_%s (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { int cc = 0; %s return cc; }\n", l, o["str"]))
+	end
+end
+
+io.write([[
+// INVALID
+static int jit_op_invalid (gb_t *gb, gb_cpu_regs *regs, uint16_t imm) { fprintf (stderr, "$%.4X: INVALID OPERATION\n", PC); return 0; }
+
+const gb_jit_op jit_operations[0x200] = {
+]])
+
+for op = 0, 0x1FF, 1 do
+	local l = label(op)
+	if op % 8 == 0 then io.write("\t") end
+	io.write(l and string.format("jit_op_%s,", l) or "jit_op_invalid,")
+	io.write(op % 8 == 7 and "\n" or " ")
+end
+
+io.write([[
+};
+
+#undef IMM8
+#undef IMM16
+#endif
+]])
 
 io.close(file)
@@ -1,28 +1,24 @@
 #include "gb/io.h"
 #include "gb/cpu.h"
+#include "gb/core.h"
 
-static uint8_t* p1;
-#define P1 (* p1)
+#define P1 (* gb->io.p1)
 
 #define BTN_KEYS (P1 & 0x20)
 #define DIR_KEYS (P1 & 0x10)
 
 /* State for each key set as : DOWN | UP | LEFT | RIGHT | START | SELECT | B | A */
-static uint8_t key_states;
+#define key_states (gb->io.key_states)
 
-static int write_joypad_h (uint16_t address, uint8_t v)
+static int write_joypad_h (gb_t *gb, uint16_t address, uint8_t v)
 {
-	if (address != GB_IO_P1_LOC) return 0;
-
 	P1 = (P1 & 0xCF) | (v & 0x30);
 
 	return 1;
 }
 
-static int read_joypad_h (uint16_t address, uint8_t* v)
+static int read_joypad_h (gb_t *gb, uint16_t address, uint8_t* v)
 {
-	if (address != GB_IO_P1_LOC) return 0;
-
 	*v = 0xC0;
 
 	if (BTN_KEYS)
@@ -33,24 +29,24 @@ static int read_joypad_h (uint16_t address, uint8_t* v)
 	return 1;
 }
 
-void gb_io_press_button (gb_io_button b)
+void gb_io_press_button (gb_t *gb, gb_io_button b)
 {
 	key_states &= ~(1 << b);
 	// TODO should check it the key is activated in P1
-	gb_cpu_flag_interrupt (INT_FLAG_JOYPAD);
+	gb_cpu_flag_interrupt (gb, INT_FLAG_JOYPAD);
 }
 
-void gb_io_release_button (gb_io_button b)
+void gb_io_release_button (gb_t *gb, gb_io_button b)
 {
 	key_states |= 1 << b;
 }
 
-void gb_io_reset ()
+void gb_io_reset (gb_t *gb)
 {
-	p1 = gb_cpu_mem (GB_IO_P1_LOC);
+	gb->io.p1 = gb_cpu_mem (gb, GB_IO_P1_LOC);
 
 	key_states = 0xFF;
 
-	gb_cpu_register_store_handler (write_joypad_h);
-	gb_cpu_register_read_handler (read_joypad_h);
+	gb_cpu_register_store_handler (gb, GB_IO_P1_LOC, GB_IO_P1_LOC, 0, write_joypad_h);
+	gb_cpu_register_read_handler (gb, GB_IO_P1_LOC, GB_IO_P1_LOC, 0, read_joypad_h);
 }
@@ -0,0 +1,289 @@
+#include "gb/jit.h"
+#include "gb/core.h"
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "the JIT only runs on x86-64 Linux"
+#endif
+
+/**
+ * Translated blocks are called as `int code (gb_t *gb, gb_cpu_regs *regs, uint64_t end)`
+ * and keep gb in rbx, regs in rbp and end in r12 while running. Each operation is
+ * followed by a check of whether to return to the interpreter, with the number of
+ * operations run in eax.
+ */
+
+/* Upper bound of the code emitted for a block. */
+#define MAX_CODE (64 + GB_CPU_BLOCK_OPS * 128)
+
+/* Offsets of the state that the translated code works on. */
+#define OFF_CC      offsetof (gb_t, cc)
+#define OFF_NEXT    offsetof (gb_t, sched.next)
+#define OFF_PC      offsetof (gb_cpu_regs, pc)
+
+/* Offsets of the 8 bit registers by their index in the opcodes, B C D E H L (HL) A. */
+static const int8_t reg8[8] = { 3, 2, 5, 4, 7, 6, -1, 1 };
+
+/* Offsets of the 16 bit registers by their index in the opcodes, BC DE HL SP. */
+static const int8_t reg16[4] = { 2, 4, 6, 8 };
+
+/* Code being emitted and the jumps to the epilogue that are resolved at the end. */
+typedef
+struct emitter
+{
+	uint8_t *p;
+	uint8_t *exits[GB_CPU_BLOCK_OPS * 8];
+	int n_exits;
+}
+emitter;
+
+static void b1 (emitter *e, uint8_t v) { *e->p ++ = v; }
+static void b2 (emitter *e, uint16_t v) { memcpy (e->p, &v, 2); e->p += 2; }
+static void b4 (emitter *e, uint32_t v) { memcpy (e->p, &v, 4); e->p += 4; }
+static void b8 (emitter *e, uint64_t v) { memcpy (e->p, &v, 8); e->p += 8; }
+
+/* jcc rel32 to the epilogue. */
+static void exit_if (emitter *e, uint8_t cc)
+{
+	b1 (e, 0x0F);
+	b1 (e, cc);
+	e->exits[e->n_exits ++] = e->p;
+	b4 (e, 0);
+}
+
+#define JAE 0x83
+#define JE  0x84
+#define JNE 0x85
+
+/* Opcode of the operation, the first one of a fused sequence. */
+static uint16_t opcode (const gb_cpu_insn *insn)
+{
+	return insn->op < 0x200 ? insn->op : gb_cpu_fusions[insn->op - 0x200][1];
+}
+
+/* Operations emitted as native code, returns the number of cycles, zero if none. */
+static int native (emitter *e, const gb_cpu_insn *insn)
+{
+	uint16_t op = opcode (insn);
+
+	// NOP
+	if (op == 0x00)
+		return 4;
+
+	// LD r,r'
+	if (op >= 0x40 && op < 0x80 && reg8[(op >> 3) & 7] >= 0 && reg8[op & 7] >= 0)
+	{
+		// movzx eax, byte [rbp + r'] ; mov [rbp + r], al
+		b1 (e, 0x0F); b1 (e, 0xB6); b1 (e, 0x45); b1 (e, reg8[op & 7]);
+		b1 (e, 0x88); b1 (e, 0x45); b1 (e, reg8[(op >> 3) & 7]);
+		return 4;
+	}
+
+	// LD r,n
+	if ((op & 0xC7) == 0x06 && op < 0x40 && reg8[(op >> 3) & 7] >= 0)
+	{
+		// mov byte [rbp + r], n
+		b1 (e, 0xC6); b1 (e, 0x45); b1 (e, reg8[(op >> 3) & 7]); b1 (e, insn->imm);
+		return 8;
+	}
+
+	// LD rr,nn
+	if ((op & 0xCF) == 0x01 && op < 0x40)
+	{
+		// mov word [rbp + rr], nn
+		b1 (e, 0x66); b1 (e, 0xC7); b1 (e, 0x45); b1 (e, reg16[op >> 4]); b2 (e, insn->imm);
+		return 12;
+	}
+
+	// INC16 rr, DEC16 rr
+	if (((op & 0xCF) == 0x03 || (op & 0xCF) == 0x0B) && op < 0x40)
+	{
+		// add/sub word [rbp + rr], 1
+		b1 (e, 0x66); b1 (e, 0x83); b1 (e, (op & 0x08) ? 0x6D : 0x45); b1 (e, reg16[op >> 4]); b1 (e, 1);
+		return 8;
+	}
+
+	return 0;
+}
+
+/* Operations that are left to the interpreter. */
+static int interpreted (uint16_t op)
+{
+	switch (op)
+	{
+		case 0x10: // STOP
+		case 0x76: // HALT
+		case 0xE0: // LD (n),A
+		case 0xE2: // LD (C),A
+		case 0xF0: // LD A,(n)
+		case 0xF2: // LD A,(C)
+		case 0xD3: case 0xDB: case 0xDD: case 0xE3: case 0xE4: case 0xEB: case 0xEC:
+		case 0xED: case 0xF4: case 0xFC: case 0xFD: // invalid
+			return 1;
+	}
+	return 0;
+}
+
+/**
+ * Operations that access memory or change IME. Accesses can go to the registers of the
+ * other units or to the block itself, so the translated code has to check whether the
+ * block is still valid after them.
+ */
+static int side_effects (uint16_t op)
+{
+	// CB prefixed on (HL)
+	if (op >= 0x100)
+		return (op & 0x07) == 0x06;
+
+	// LD r,(HL), LD (HL),r and the ALU on (HL)
+	if (op >= 0x40 && op < 0xC0)
+		return (op & 0x07) == 0x06 || (op < 0x80 && (op & 0x38) == 0x30);
+
+	// PUSH rr, POP rr, RST n
+	if ((op & 0xCB) == 0xC1 || (op & 0xC7) == 0xC7)
+		return 1;
+
+	switch (op)
+	{
+		case 0x02: case 0x12: case 0x22: case 0x32: // LD (rr),A
+		case 0x0A: case 0x1A: case 0x2A: case 0x3A: // LD A,(rr)
+		case 0x08: case 0xEA: case 0xFA:            // LD (nn),SP, LD (nn),A, LD A,(nn)
+		case 0x34: case 0x35: case 0x36:            // INC (HL), DEC (HL), LD (HL),n
+		case 0xC0: case 0xC8: case 0xC9:            // RET
+		case 0xD0: case 0xD8: case 0xD9:
+		case 0xC4: case 0xCC: case 0xCD:            // CALL
+		case 0xD4: case 0xDC:
+		case 0xF3: case 0xFB:                       // DI, EI
+			return 1;
+	}
+	return 0;
+}
+
+/**
+ * Allocate room for a translation, dropping all of them in case memory is full.
+ * The memory is never writable and executable at once, see `protect_code`.
+ */
+static uint8_t *alloc_code (gb_t *gb)
+{
+	if (!gb->cpu.jit)
+	{
+		void *mem = mmap (NULL, GB_JIT_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (mem == MAP_FAILED) return NULL;
+		gb->cpu.jit = mem;
+		gb->cpu.jit_used = 0;
+	}
+
+	if (gb->cpu.jit_used + MAX_CODE > GB_JIT_SIZE)
+	{
+		for (int i = 0; i < GB_CPU_BLOCKS; i ++)
+		{
+			gb->cpu.blocks[i].code = NULL;
+			gb->cpu.blocks[i].hits = 0;
+		}
+		gb->cpu.jit_used = 0;
+	}
+
+	return gb->cpu.jit + gb->cpu.jit_used;
+}
+
+/* Change the protection of the pages holding the code, returns 0 on failure. */
+static int protect_code (uint8_t *code, size_t size, int prot)
+{
+	uintptr_t page = sysconf (_SC_PAGESIZE);
+	uintptr_t start = (uintptr_t) code & ~(page - 1);
+	uintptr_t end = ((uintptr_t) code + size + page - 1) & ~(page - 1);
+	return mprotect ((void *) start, end - start, prot) == 0;
+}
+
+gb_cpu_code gb_jit_translate (gb_t *gb, gb_cpu_block *block)
+{
+	if (block->n == 0 || interpreted (opcode (&block->ops[0]))) return NULL;
+
+	uint8_t *code = alloc_code (gb);
+	if (!code || !protect_code (code, MAX_CODE, PROT_READ | PROT_WRITE)) return NULL;
+
+	emitter e = { .p = code, .n_exits = 0 };
+
+	// push rbx ; push rbp ; push r12 ; mov rbx, rdi ; mov rbp, rsi ; mov r12, rdx
+	b1 (&e, 0x53); b1 (&e, 0x55); b1 (&e, 0x41); b1 (&e, 0x54);
+	b1 (&e, 0x48); b1 (&e, 0x89); b1 (&e, 0xFB);
+	b1 (&e, 0x48); b1 (&e, 0x89); b1 (&e, 0xF5);
+	b1 (&e, 0x49); b1 (&e, 0x89); b1 (&e, 0xD4);
+
+	// the interpreter takes over at the first operation it needs to run
+	int n = 0;
+	while (n < block->n && !interpreted (opcode (&block->ops[n]))) n ++;
+
+	for (int i = 0; i < n; i ++)
+	{
+		const gb_cpu_insn *insn = &block->ops[i];
+
+		// add word [rbp + pc], len
+		b1 (&e, 0x66); b1 (&e, 0x83); b1 (&e, 0x45); b1 (&e, OFF_PC); b1 (&e, insn->len);
+
+		int cc = native (&e, insn);
+		if (cc)
+		{
+			// add qword [rbx + cc], cycles
+			b1 (&e, 0x48); b1 (&e, 0x81); b1 (&e, 0x83); b4 (&e, OFF_CC); b4 (&e, cc);
+			// mov eax, i + 1
+			b1 (&e, 0xB8); b4 (&e, i + 1);
+		}
+		else
+		{
+			// mov rdi, rbx ; mov rsi, rbp ; mov edx, imm ; mov rax, op ; call rax
+			b1 (&e, 0x48); b1 (&e, 0x89); b1 (&e, 0xDF);
+			b1 (&e, 0x48); b1 (&e, 0x89); b1 (&e, 0xEE);
+			b1 (&e, 0xBA); b4 (&e, insn->imm);
+			b1 (&e, 0x48); b1 (&e, 0xB8); b8 (&e, (uintptr_t) jit_operations[opcode (insn)]);
+			b1 (&e, 0xFF); b1 (&e, 0xD0);
+			// movsxd rax, eax ; add [rbx + cc], rax
+			b1 (&e, 0x48); b1 (&e, 0x63); b1 (&e, 0xC0);
+			b1 (&e, 0x48); b1 (&e, 0x01); b1 (&e, 0x83); b4 (&e, OFF_CC);
+			// mov eax, i + 1
+			b1 (&e, 0xB8); b4 (&e, i + 1);
+		}
+
+		// the interpreter does the checks after the last operation
+		if (i == n - 1) break;
+
+		if (!cc && side_effects (opcode (insn)))
+		{
+			// the operation might have stored to the block: mov rcx, &block->n ; cmp byte [rcx], 0
+			// a remap of its memory ends the run through the scheduler, checked below
+			b1 (&e, 0x48); b1 (&e, 0xB9); b8 (&e, (uintptr_t) &block->n);
+			b1 (&e, 0x80); b1 (&e, 0x39); b1 (&e, 0x00);
+			exit_if (&e, JE);
+		}
+
+		// a pending interrupt is an event as well: mov rcx, [rbx + cc] ; cmp rcx, r12 ; jae ; cmp rcx, [rbx + next] ; jae
+		b1 (&e, 0x48); b1 (&e, 0x8B); b1 (&e, 0x8B); b4 (&e, OFF_CC);
+		b1 (&e, 0x4C); b1 (&e, 0x39); b1 (&e, 0xE1);
+		exit_if (&e, JAE);
+		b1 (&e, 0x48); b1 (&e, 0x3B); b1 (&e, 0x8B); b4 (&e, OFF_NEXT);
+		exit_if (&e, JAE);
+	}
+
+	// epilogue: pop r12 ; pop rbp ; pop rbx ; ret
+	for (int i = 0; i < e.n_exits; i ++)
+	{
+		int32_t rel = e.p - (e.exits[i] + 4);
+		memcpy (e.exits[i], &rel, 4);
+	}
+	b1 (&e, 0x41); b1 (&e, 0x5C); b1 (&e, 0x5D); b1 (&e, 0x5B); b1 (&e, 0xC3);
+
+	// translations on the same pages run again once the code is executable
+	if (!protect_code (code, MAX_CODE, PROT_READ | PROT_EXEC)) return NULL;
+
+	gb->cpu.jit_used += e.p - code;
+	return (gb_cpu_code) code;
+}
+
+void gb_jit_quit (gb_t *gb)
+{
+	if (gb->cpu.jit) munmap (gb->cpu.jit, GB_JIT_SIZE);
+	gb->cpu.jit = NULL;
+}
@@ -1,20 +1,20 @@
+#include "gb/mbc0.h"
 #include "gb/cpu.h"
 
 /*
  * Apparently there are some games that are crazy enough to atempt this and this
  * handler needs to prevent it.
  */
-static int write_rom_h (uint16_t addr, uint8_t v)
+static int write_rom_h (gb_t *gb, uint16_t addr, uint8_t v)
 {
-	if (addr < 0x8000) return 1;
-	return 0;
+	return 1;
 }
 
 /**
  *
  */
-void gb_mbc0_load (uint8_t* ram)
+void gb_mbc0_load (gb_t *gb, uint8_t* ram)
 {
-	gb_cpu_register_store_handler (write_rom_h);
+	gb_cpu_register_store_handler (gb, 0x0000, 0x7FFF, 0, write_rom_h);
 }
 
@@ -3,38 +3,48 @@
  */
 #include "gb/mbc1.h"
 #include "gb/cpu.h"
+#include "gb/core.h"
 #include <string.h>
 #include <stdio.h>
 
 //static uint8_t* rom;
-static uint8_t* ram;
+#define ram (gb->mbc.ram)
 
 /* RAM enabled register. */
-static uint8_t ram_enabled;
+#define ram_enabled (gb->mbc.ram_enabled)
 #define RAM_ENABLED ((ram_enabled & 0x0F) == 0x0A)
 
-static int write_ram_enable_h (uint16_t adr, uint8_t v)
+static void map_ram (gb_t *) ;
+
+static int write_ram_enable_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr > 0x1FFF) return 0;
 	ram_enabled = v;
+	map_ram (gb);
 	return 1;
 }
 
 /* ROM/RAM mode select. */
-static uint8_t select_mode;
+#define select_mode (gb->mbc.mbc1.select_mode)
 #define ROM_SELECT_MODE (select_mode == 0)
 #define RAM_SELECT_MODE (select_mode == 1)
 
-static uint8_t bank_lo;
-static uint8_t bank_hi;
-static uint8_t bank_ram;
+#define bank_lo (gb->mbc.mbc1.bank_lo)
+#define bank_hi (gb->mbc.mbc1.bank_hi)
+#define bank_ram (gb->mbc.mbc1.bank_ram)
 
 /* points correctly to address within current RAM bank. */
 #define RAM(adr) ram[adr - 0xA000 + (bank_ram * RAM_BANK_SIZE)]
 
-static void reload_banks ()
+/* map the current RAM bank while RAM is enabled, else the handlers take care of it. */
+static void map_ram (gb_t *gb)
 {
-	static int b;
+	uint8_t *p = RAM_ENABLED ? &RAM (0xA000) : NULL;
+	gb_cpu_map (gb, 0xA000, RAM_BANK_SIZE, p, GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
+}
+
+static void reload_banks (gb_t *gb)
+{
+	int b;
 
 	if (ROM_SELECT_MODE)
 	{
@@ -47,53 +57,47 @@ static void reload_banks ()
 		bank_ram = bank_hi;
 	}
 
-	gb_cpu_switch_rom_bank (b);
+	gb_cpu_switch_rom_bank (gb, b);
+	map_ram (gb);
 }
 
-static int write_select_mode_h (uint16_t adr, uint8_t v)
+static int write_select_mode_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0x6000 || adr >= 0x8000) return 0;
 	select_mode = v & 1;
-	reload_banks ();
+	reload_banks (gb);
 	return 1;
 }
 
-static int write_bank_number_h (uint16_t adr, uint8_t v)
+static int write_bank_number_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0x2000 || adr >= 0x6000)
-		return 0; // not trying to change bank #
-	else if (adr < 0x4000)
+	if (adr < 0x4000)
 	{
 		bank_lo = v & 0x1F;
 		if (bank_lo == 0) bank_lo = 1; // can't choose ROM bank 00h
 	}
 	else bank_hi = v & 0x03;
 
-	reload_banks ();
+	reload_banks (gb);
 
 	return 1;
 }
 
 /* Handles reading from RAM $A000 - $BFFF. */
-static int read_ram_h (uint16_t adr, uint8_t* v)
+static int read_ram_h (gb_t *gb, uint16_t adr, uint8_t* v)
 {
-	if (adr < 0xA000 || adr >= 0xC000)
-		return 0;
 	*v = RAM_ENABLED ? RAM (adr) : 0x00;
 	return 1;
 }
 
 /* Handles writing to RAM $A000 - $BFFF. */
-static int write_ram_h (uint16_t adr, uint8_t v)
+static int write_ram_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0xA000 || adr >= 0xC000)
-		return 0;
-	else if (RAM_ENABLED)
+	if (RAM_ENABLED)
 		RAM (adr) = v;
 	return 1;
 }
 
-void gb_mbc1_load (uint8_t* ram_)
+void gb_mbc1_load (gb_t *gb, uint8_t* ram_)
 {
 	ram = ram_;
 
@@ -103,10 +107,12 @@ void gb_mbc1_load (uint8_t* ram_)
 	ram_enabled = 0;
 	select_mode = 0;
 
-	gb_cpu_register_store_handler (write_ram_enable_h);
-	gb_cpu_register_store_handler (write_bank_number_h);
-	gb_cpu_register_store_handler (write_select_mode_h);
-	gb_cpu_register_store_handler (write_ram_h);
+	gb_cpu_register_store_handler (gb, 0x0000, 0x1FFF, 0, write_ram_enable_h);
+	gb_cpu_register_store_handler (gb, 0x2000, 0x5FFF, 0, write_bank_number_h);
+	gb_cpu_register_store_handler (gb, 0x6000, 0x7FFF, 0, write_select_mode_h);
+	gb_cpu_register_store_handler (gb, 0xA000, 0xBFFF, 0, write_ram_h);
+
+	gb_cpu_register_read_handler (gb, 0xA000, 0xBFFF, 0, read_ram_h);
 
-	gb_cpu_register_read_handler (read_ram_h);
+	map_ram (gb);
 }
@@ -3,39 +3,34 @@
  */
 #include "gb/mbc2.h"
 #include "gb/cpu.h"
+#include "gb/core.h"
 
-static uint8_t* ram;
+#define ram (gb->mbc.ram)
 
 #define RAM(a) ram[a - 0xA000]
 
 /* RAM enabled register. */
-static uint8_t ram_enabled;
+#define ram_enabled (gb->mbc.ram_enabled)
 #define RAM_ENABLED ((ram_enabled & 0x0A) == 0x0A)
 
-static int write_ram_enable_h (uint16_t adr, uint8_t v)
+static int write_ram_enable_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr > 0x1FFF || (adr & 0x0100)) // LSB of upper byte of the address must be cleared
+	if (adr & 0x0100) // LSB of upper byte of the address must be cleared
 		return 0;
 	ram_enabled = v;
 	return 1;
 }
 
-static int write_ram_h (uint16_t adr, uint8_t v)
+static int write_ram_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0xA000 || adr > 0xA1FF)
-		return 0;
-
 	if (RAM_ENABLED)
 		RAM(adr) = v & 0x0F;
 
 	return 1;
 }
 
-static int read_ram_h (uint16_t adr, uint8_t* v)
+static int read_ram_h (gb_t *gb, uint16_t adr, uint8_t* v)
 {
-	if (adr < 0xA000 || adr > 0xA1FF)
-		return 0;
-
 	if (!RAM_ENABLED)
 		*v = 0;
 	else
@@ -44,27 +39,28 @@ static int read_ram_h (uint16_t adr, uint8_t* v)
 	return 1;
 }
 
-static int write_bank_number_h (uint16_t adr, uint8_t v)
+static int write_bank_number_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0x2000 || adr > 0x3FFF)
-		return 0;
-	else if (!(adr & 0x0100)) // LSB of upper byte must be set
+	if (!(adr & 0x0100)) // LSB of upper byte must be set
 		return 0;
 
 	uint8_t b = v & 0x0F;
-	gb_cpu_switch_rom_bank (b);
+	gb_cpu_switch_rom_bank (gb, b);
 	return 1;
 }
 
-void gb_mbc2_load (uint8_t* ram_)
+void gb_mbc2_load (gb_t *gb, uint8_t* ram_)
 {
 	ram = ram_;
 
 	ram_enabled = 0;
 
-	gb_cpu_register_store_handler (write_ram_enable_h);
-	gb_cpu_register_store_handler (write_bank_number_h);
-	gb_cpu_register_store_handler (write_ram_h);
+	gb_cpu_register_store_handler (gb, 0x0000, 0x1FFF, 0, write_ram_enable_h);
+	gb_cpu_register_store_handler (gb, 0x2000, 0x3FFF, 0, write_bank_number_h);
+	gb_cpu_register_store_handler (gb, 0xA000, 0xA1FF, 0, write_ram_h);
+
+	gb_cpu_register_read_handler (gb, 0xA000, 0xA1FF, 0, read_ram_h);
 
-	gb_cpu_register_read_handler (read_ram_h);
+	// the RAM is only 4 bits wide so accesses need to go through the handlers
+	gb_cpu_map (gb, 0xA000, 0x200, NULL, GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
 }
@@ -1,5 +1,6 @@
 #include "gb/mbc3.h"
 #include "gb/cpu.h"
+#include "gb/core.h"
 #include "gb.h"
 #include <stdio.h>
 #include <string.h>
@@ -16,24 +17,24 @@
  *       Bit 6  Halt (0=Active, 1=Stop Timer)
  *       Bit 7  Day Counter Carry Bit (1=Counter Overflow)
  */
-static uint8_t rtc[5];
-static uint8_t* rtc_;
+#define rtc (gb->mbc.mbc3.rtc)
+#define rtc_ (gb->mbc.mbc3.rtc_)
 #define RTC (* rtc_)
 
 #define TIMER_HALT (rtc[4] & 0x40)
 
 /* Keep track of CPU clock cycles. */
-static uint32_t cc;
+#define timer_cc (gb->mbc.mbc3.cc)
 
 /**
  * Timer in seconds.
  *
  * 32 bits should hold for about 136 years.
  */
-static uint32_t timer;
+#define timer (gb->mbc.mbc3.timer)
 
 #ifdef DEBUG
-static void print_timer ()
+static void print_timer (gb_t *gb)
 {
 
 	uint16_t d = timer / 86400;
@@ -46,17 +47,22 @@ static void print_timer ()
 #endif  // ifdef DEBUG
 
 /* Keep track if the day counter overflowed. */
-static uint8_t day_count_overflow;
+#define day_count_overflow (gb->mbc.mbc3.day_count_overflow)
+
+#define synced (gb->mbc.mbc3.synced)
 
 /**
- * Step the timer in relation to the CPU.
+ * Step the timer in relation to the CPU, up to the current cycle.
  */
-static void step (uint32_t cc_)
+static void sync (gb_t *gb)
 {
+	uint64_t cc_ = gb->cc - synced;
+	synced = gb->cc;
+
 	if (TIMER_HALT) return;
 
-	cc += cc_;
-	if (cc >= GB_CPU_CLOCK)  // one second
+	timer_cc += cc_;
+	while (timer_cc >= GB_CPU_CLOCK)  // one second
 	{
 		timer ++;
 
@@ -67,51 +73,70 @@ static void step (uint32_t cc_)
 			day_count_overflow = 0x80;
 		}
 
-		cc -= GB_CPU_CLOCK;
+		timer_cc -= GB_CPU_CLOCK;
 	}
 }
 
-static uint8_t* ram;
+/* Schedule the next second, nothing happens while the timer is halted. */
+static void schedule_next (gb_t *gb)
+{
+	if (TIMER_HALT)
+		gb_sched_cancel (gb, GB_EVENT_RTC);
+	else
+		gb_sched_schedule (gb, GB_EVENT_RTC, synced + GB_CPU_CLOCK - timer_cc);
+}
+
+static void rtc_event (gb_t *gb)
+{
+	sync (gb);
+	schedule_next (gb);
+}
+
+#define ram (gb->mbc.ram)
 
 /* RAM enabled register. */
-static uint8_t ram_enabled;
+#define ram_enabled (gb->mbc.ram_enabled)
 #define RAM_ENABLED ((ram_enabled & 0x0A) == 0x0A)
 
-static int write_ram_enable_h (uint16_t adr, uint8_t v)
+static void map_ram (gb_t *) ;
+
+static int write_ram_enable_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr > 0x1FFF) return 0;
 	ram_enabled = v;
+	map_ram (gb);
 	return 1;
 }
 
 /* ROM bank number. */
-static uint8_t rom_bank;
+#define rom_bank (gb->mbc.mbc3.rom_bank)
 
-static int write_rom_bank_h (uint16_t adr, uint8_t v)
+static int write_rom_bank_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0x2000 || adr >= 0x4000) return 0;
-
 	rom_bank = v & 0x7f;
 	if (rom_bank == 0) rom_bank = 1;
-	gb_cpu_switch_rom_bank (rom_bank);
+	gb_cpu_switch_rom_bank (gb, rom_bank);
 
 	return 1;
 }
 
 /* current RAM bank. */
-static uint8_t ram_bank;
+#define ram_bank (gb->mbc.mbc3.ram_bank)
 
 /* points correctly to address within current RAM bank. */
 #define RAM(adr) ram[adr - 0xA000 + (ram_bank << 13)]
 
-static uint8_t flag_read_rtc;
+#define flag_read_rtc (gb->mbc.mbc3.flag_read_rtc)
 
-/* Handles writes to $4000 - $5FFF: writing RAM bank or RTC register. */
-static int write_ram_bank_h (uint16_t adr, uint8_t v)
+/* map the current RAM bank when enabled and selected, else the handlers take care of it. */
+static void map_ram (gb_t *gb)
 {
-	if (adr < 0x4000 || adr >= 0x6000)
-		return 0;
+	uint8_t *p = RAM_ENABLED && !flag_read_rtc ? &RAM (0xA000) : NULL;
+	gb_cpu_map (gb, 0xA000, RAM_BANK_SIZE, p, GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
+}
 
+/* Handles writes to $4000 - $5FFF: writing RAM bank or RTC register. */
+static int write_ram_bank_h (gb_t *gb, uint16_t adr, uint8_t v)
+{
 	v &= 0xF;
 
 	if (v <= 0x3)
@@ -125,16 +150,14 @@ static int write_ram_bank_h (uint16_t adr, uint8_t v)
 		flag_read_rtc = 1;
 	}
 
+	map_ram (gb);
 	return 1;
 }
 
 /* Handles reading from RAM $A000 - $BFFF. */
-static int read_ram_h (uint16_t adr, uint8_t* v)
+static int read_ram_h (gb_t *gb, uint16_t adr, uint8_t* v)
 {
-	if (adr < 0xA000 || adr > 0xBFFF)
-		return 0;
-
-	else if (!RAM_ENABLED)
+	if (!RAM_ENABLED)
 	{
 		*v = 0;
 		return 1;
@@ -149,16 +172,16 @@ static int read_ram_h (uint16_t adr, uint8_t* v)
 }
 
 /* Handles writing to RAM $A000 - $BFFF, and RTC registers. */
-static int write_ram_h (uint16_t adr, uint8_t v)
+static int write_ram_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0xA000 || adr > 0xBFFF)
-		return 0;
-	else if (!RAM_ENABLED)
+	if (!RAM_ENABLED)
 		return 1;
 
 	if (flag_read_rtc)
 	{
+		sync (gb);
 		RTC = v;
+		schedule_next (gb);
 
 		// check reset of day counter overflow.
 		// i hope this works.
@@ -172,7 +195,7 @@ static int write_ram_h (uint16_t adr, uint8_t v)
 }
 
 /* Flag to indicate if the $00 was written to $6000-7FFF. */
-static uint8_t f_rtc_latched;
+#define f_rtc_latched (gb->mbc.mbc3.f_rtc_latched)
 
 /**
  * Handle writes to $6000-7FFF.
@@ -180,11 +203,8 @@ static uint8_t f_rtc_latched;
  * When writing 00h, and then 01h to this register, the current time becomes latched
  * into the RTC registers.
  */
-static int write_latch_clock_data (uint16_t adr, uint8_t v)
+static int write_latch_clock_data (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0x6000 || adr > 0x7FFF)
-		return 0;
-
 	if (v == 0)
 		f_rtc_latched = 1;
 
@@ -196,6 +216,8 @@ static int write_latch_clock_data (uint16_t adr, uint8_t v)
 			// latch time
 			//
 
+			sync (gb);
+
 			uint16_t d = timer / 86400;
 			uint8_t h = (timer / 3600) % 24;
 			uint8_t m = (timer / 60) % 60;
@@ -214,7 +236,7 @@ static int write_latch_clock_data (uint16_t adr, uint8_t v)
 	return 1;
 }
 
-void gb_mbc3_load (uint8_t* ram_)
+void gb_mbc3_load (gb_t *gb, uint8_t* ram_)
 {
 	ram = ram_;
 
@@ -226,17 +248,21 @@ void gb_mbc3_load (uint8_t* ram_)
 	f_rtc_latched = 0;
 
 	// below variables are for the timer, but how does this work with the battery?
-	cc = 0;
+	timer_cc = 0;
 	timer = 0;
 	day_count_overflow = 0;
 
-	gb_cpu_register_store_handler (write_ram_enable_h);
-	gb_cpu_register_store_handler (write_rom_bank_h);
-	gb_cpu_register_store_handler (write_ram_bank_h);
-	gb_cpu_register_store_handler (write_ram_h);
-	gb_cpu_register_store_handler (write_latch_clock_data);
+	gb_cpu_register_store_handler (gb, 0x0000, 0x1FFF, 0, write_ram_enable_h);
+	gb_cpu_register_store_handler (gb, 0x2000, 0x3FFF, 0, write_rom_bank_h);
+	gb_cpu_register_store_handler (gb, 0x4000, 0x5FFF, 0, write_ram_bank_h);
+	gb_cpu_register_store_handler (gb, 0xA000, 0xBFFF, 0, write_ram_h);
+	gb_cpu_register_store_handler (gb, 0x6000, 0x7FFF, 0, write_latch_clock_data);
+
+	gb_cpu_register_read_handler (gb, 0xA000, 0xBFFF, 0, read_ram_h);
 
-	gb_cpu_register_read_handler (read_ram_h);
+	map_ram (gb);
 
-	gb_add_step_callback (step);
+	synced = gb->cc;
+	gb_sched_register (gb, GB_EVENT_RTC, rtc_event);
+	schedule_next (gb);
 }
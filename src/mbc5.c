@@ -3,30 +3,28 @@
  */
 #include "gb/mbc5.h"
 #include "gb/cpu.h"
+#include "gb/core.h"
 #include <string.h>
 
-static uint8_t* ram;
+#define ram (gb->mbc.ram)
 
 /* RAM enabled register. */
-static uint8_t ram_enabled;
+#define ram_enabled (gb->mbc.ram_enabled)
 #define RAM_ENABLED ((ram_enabled & 0x0A) == 0x0A)
 
-static int write_ram_enable_h (uint16_t address, uint8_t v)
+static int write_ram_enable_h (gb_t *gb, uint16_t address, uint8_t v)
 {
-	if (address > 0x1FFF) return 0;
 	ram_enabled = v;
 	return 1;
 }
 
 /* ROM and RAM bank numbers. */
-static uint8_t bank_rom_lo;
-static uint8_t bank_rom_hi;
-static uint8_t bank_ram;
+#define bank_rom_lo (gb->mbc.mbc5.bank_rom_lo)
+#define bank_rom_hi (gb->mbc.mbc5.bank_rom_hi)
+#define bank_ram (gb->mbc.mbc5.bank_ram)
 
-static int write_bank_number_h (uint16_t adr, uint8_t v)
+static int write_bank_number_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr < 0x2000 || adr >= 0x3FFF) return 0;
-
 	// low
 	if (adr <= 0x2FFF)
 		bank_rom_lo = v;
@@ -35,40 +33,41 @@ static int write_bank_number_h (uint16_t adr, uint8_t v)
 		bank_rom_hi = v & 1;
 
 	uint32_t b = ((bank_rom_hi << 8) | bank_rom_lo);
-	gb_cpu_switch_rom_bank (b);
+	gb_cpu_switch_rom_bank (gb, b);
 
 	return 1;
 }
 
-static int write_ram_bank_number_h (uint16_t adr, uint8_t v)
+/* map the current RAM bank. */
+static void map_ram (gb_t *gb)
 {
-	if (adr < 0x4000 || adr > 0x5FFF) return 0;
+	gb_cpu_map (gb, 0xA000, RAM_BANK_SIZE, ram + (bank_ram << 13), GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
+}
 
+static int write_ram_bank_number_h (gb_t *gb, uint16_t adr, uint8_t v)
+{
 	bank_ram = v & 0x0F;
+	map_ram (gb);
 	return 1;
 }
 
 /* Handles reading from RAM $A000 - $BFFF. */
-static int read_ram_h (uint16_t address, uint8_t* v)
+static int read_ram_h (gb_t *gb, uint16_t address, uint8_t* v)
 {
-	if (address < 0xA000 || address > 0xBFFF) return 0;
-
 	address = address - 0xA000 + (bank_ram << 13);
 	*v = ram[address];
 	return 1;
 }
 
 /* Handles writing to RAM $A000 - $BFFF. */
-static int write_ram_h (uint16_t address, uint8_t v)
+static int write_ram_h (gb_t *gb, uint16_t address, uint8_t v)
 {
-	if (address < 0xA000 || address > 0xBFFF) return 0;
-
 	address = address - 0xA000 + (bank_ram << 13);
 	ram[address] = v;
 	return 1;
 }
 
-void gb_mbc5_load (uint8_t* ram_)
+void gb_mbc5_load (gb_t *gb, uint8_t* ram_)
 {
 	ram = ram_;
 
@@ -76,10 +75,12 @@ void gb_mbc5_load (uint8_t* ram_)
 	bank_rom_lo = 0;
 	bank_ram = 0;
 
-	gb_cpu_register_store_handler (write_ram_enable_h);
-	gb_cpu_register_store_handler (write_bank_number_h);
-	gb_cpu_register_store_handler (write_ram_bank_number_h);
-	gb_cpu_register_store_handler (write_ram_h);
+	gb_cpu_register_store_handler (gb, 0x0000, 0x1FFF, 0, write_ram_enable_h);
+	gb_cpu_register_store_handler (gb, 0x2000, 0x3FFF, 0, write_bank_number_h);
+	gb_cpu_register_store_handler (gb, 0x4000, 0x5FFF, 0, write_ram_bank_number_h);
+	gb_cpu_register_store_handler (gb, 0xA000, 0xBFFF, 0, write_ram_h);
+
+	gb_cpu_register_read_handler (gb, 0xA000, 0xBFFF, 0, read_ram_h);
 
-	gb_cpu_register_read_handler (read_ram_h);
+	map_ram (gb);
 }
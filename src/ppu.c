@@ -1,5 +1,6 @@
 #include "gb/ppu.h"
 #include "gb/cpu.h"
+#include "gb/core.h"
 #include "gb.h"
 #include <string.h>
 
@@ -8,35 +9,25 @@
 //#endif
 
 /* Dot counter within scanline. */
-static uint32_t dot;
+#define dot (gb->ppu.dot)
 
 /* Registers --------------------------------------------------- */
-static uint8_t* scy_;
-static uint8_t* scx_;
-static uint8_t* ly_;
-static uint8_t* lyc_;
-static uint8_t* wy_;
-static uint8_t* wx_;
-static uint8_t* bgp_;
-static uint8_t* obp0_;
-static uint8_t* obp1_;
-
-#define SCY (* scy_)
-#define SCX (* scx_)
-#define LY (* ly_)
-#define LYC (* lyc_)
-#define WY (* wy_)
-#define WX (* wx_)
-#define BGP (* bgp_)
-#define OBP0 (* obp0_)
-#define OBP1 (* obp1_)
+#define SCY (* gb->ppu.scy)
+#define SCX (* gb->ppu.scx)
+#define LY (* gb->ppu.ly)
+#define LYC (* gb->ppu.lyc)
+#define WY (* gb->ppu.wy)
+#define WX (* gb->ppu.wx)
+#define BGP (* gb->ppu.bgp)
+#define OBP0 (* gb->ppu.obp0)
+#define OBP1 (* gb->ppu.obp1)
 
 #define LY_LOC 0xFF44
 
 /* LY register is read only. */
-static int write_ly_h (uint16_t adr, uint8_t v)
+static int write_ly_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	return adr == LY_LOC;
+	return 1;
 }
 
 /**
@@ -53,8 +44,9 @@ static int write_ly_h (uint16_t adr, uint8_t v)
  */
 
 #define LCDC_LOC 0xFF40
-static uint8_t* lcdc_;
-#define LCDC (* lcdc_)
+#define LCDC (* gb->ppu.lcdc)
+
+static void schedule_next (gb_t *) ;
 
 #define LCD_ENABLED (LCDC & 0x80)
 #define WIN_TILE_MAP (0x1800 | ((LCDC & 0x40) << 4))
@@ -81,8 +73,7 @@ static uint8_t* lcdc_;
  */
 
 #define STATUS_LOC 0xFF41
-static uint8_t *status_;
-#define STATUS (*status_)
+#define STATUS (* gb->ppu.status)
 
 #define LYC_EQ_LQ_FLAG 0x04
 
@@ -98,11 +89,18 @@ static uint8_t *status_;
 #define MODE_SEARCH_OAM 2
 #define MODE_TRANSFER_LCD 3
 
-#define SET_MODE(x) { STATUS = (STATUS & 0xFC) | x; }
+static void map_vram (gb_t *, uint8_t) ;
+
+/* VRAM is only mapped directly into memory while the PPU is not drawing. */
+#define SET_MODE(x) \
+{ \
+	if ((MODE == MODE_TRANSFER_LCD) != (x == MODE_TRANSFER_LCD)) map_vram (gb, x); \
+	STATUS = (STATUS & 0xFC) | x; \
+}
 
-static int write_status_h (uint16_t addr, uint8_t v)
+static int write_status_h (gb_t *gb, uint16_t addr, uint8_t v)
 {
-	if (addr != STATUS_LOC) return 0;
+	gb_ppu_sync (gb);
 
 	// do not overwrite mode bits and LY=LYC
 	STATUS = (v & 0xF8) | (STATUS & 0x07);
@@ -110,9 +108,9 @@ static int write_status_h (uint16_t addr, uint8_t v)
 	return 1;
 }
 
-static int write_lcdc_h (uint16_t adr, uint8_t v)
+static int write_lcdc_h (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr != LCDC_LOC) return 0;
+	gb_ppu_sync (gb);
 
 #ifdef DEBUG_PPU
 	uint8_t tmp = LCDC;
@@ -134,13 +132,25 @@ static int write_lcdc_h (uint16_t adr, uint8_t v)
 		dot = LY = 0;
 		SET_MODE (MODE_HBLANK);
 	}
+	schedule_next (gb);
 	return 1;
 }
 
+/**
+ * Catch up before writes to registers that change how the pixels are drawn, the pixels
+ * up to this point should be drawn with the old values. The handlers of registers that
+ * do more than that catch up themselves.
+ */
+static int write_sync_h (gb_t *gb, uint16_t addr, uint8_t v)
+{
+	gb_ppu_sync (gb);
+	return 0;
+}
+
 /**
  * Block any illegal writes because of PPU mode.
  */
-static int write_mode_block (uint16_t addr, uint8_t v)
+static int write_mode_block (gb_t *gb, uint16_t addr, uint8_t v)
 {
 	// no access to OAM while in MODE 2
 	if ((MODE == MODE_SEARCH_OAM) && ((addr >= 0xFE00) && (addr <= 0xFE9F)))
@@ -160,7 +170,7 @@ static int write_mode_block (uint16_t addr, uint8_t v)
 /**
  * Block reads to VRAM and OAM when not accessible.
  */
-static int read_mode_block (uint16_t addr, uint8_t *v)
+static int read_mode_block (gb_t *gb, uint16_t addr, uint8_t *v)
 {
 	// no access to OAM while in MODE 2
 	if ((MODE == MODE_SEARCH_OAM) && ((addr >= 0xFE00) && (addr <= 0xFE9F)))
@@ -187,7 +197,7 @@ static int read_mode_block (uint16_t addr, uint8_t *v)
 }
 
 /* OAM data pointer */
-static uint8_t *oam;
+#define oam (gb->ppu.oam)
 
 #define SPRITE_BG_PRIO(sprite) (sprite[3] & 0x80)
 #define SPRITE_YFLIP(sprite) (sprite[3] & 0x40)
@@ -196,67 +206,57 @@ static uint8_t *oam;
 #define SPRITE_VRAM(sprite) ((sprite[3] & 0x08) >> 3)
 #define SPRITE_PALETTE_CGB(sprite) (sprite[3] & 0x07)
 
-#define NPIXELS 23040  // width * height
+#define NPIXELS GB_PPU_NPIXELS
 
 /* switchable screen buffer for rendering. */
-static uint16_t *lcd, *lcd_buf;
-static uint16_t __lcd_1[NPIXELS];
-static uint16_t __lcd_2[NPIXELS];
+#define lcd (gb->ppu.lcd)
+#define lcd_buf (gb->ppu.lcd_buf)
+#define __lcd_1 (gb->ppu.lcd_1)
+#define __lcd_2 (gb->ppu.lcd_2)
 
 
-const uint16_t *gb_ppu_lcd () { return lcd; }
+const uint16_t *gb_ppu_lcd (gb_t *gb) { return lcd; }
 
 /* VRAM */
-static uint8_t *vram;
+#define vram (gb->ppu.vram)
 
 /* VRAM banks */
-static uint8_t *vram_bank0;  // this one points to mem $8000-$9FFF
-static uint8_t vram_bank1[0x2000];
+#define vram_bank0 (gb->ppu.vram_bank0)
+#define vram_bank1 (gb->ppu.vram_bank1)
 
-static uint8_t *_vbk;
-#define VBK (*_vbk)
+#define VBK (* gb->ppu.vbk)
 #define VBK_LOC 0xFF4F
 
-static int write_vbk_handler (uint16_t adr, uint8_t v)
+static int write_vbk_handler (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr != VBK_LOC) return 0;
-
+	gb_ppu_sync (gb);
 	vram = v & 1 ? vram_bank1 : vram_bank0;
 	VBK = 0xFE | (v & 1);
+	map_vram (gb, MODE);
 	return 1;
 }
 
-/* handler to make sure that writes to VRAM go to the correct bank. */
-static int write_vram_handler (uint16_t adr, uint8_t v)
-{
-	if ((adr < 0x8000) || (adr >= 0xA000)) return 0;
-
-	vram[adr - 0x8000] = v;
-	return 1;
-}
-
-/* handler to make sure that reads from VRAM come from the correct bank. */
-static int read_vram_handler (uint16_t adr, uint8_t *v)
+/* map the current VRAM bank, or let the handlers block accesses while drawing. */
+static void map_vram (gb_t *gb, uint8_t mode)
 {
-	if ((adr < 0x8000) || (adr >= 0xA000)) return 0;
-
-	*v = vram[adr - 0x8000];
-	return 1;
+	uint8_t *p = mode == MODE_TRANSFER_LCD ? NULL : vram;
+	gb_cpu_map (gb, VRAM_LOC, 0x2000, p, GB_CPU_MAP_READ | GB_CPU_MAP_STORE);
 }
 
-static uint8_t CRAM_BG[64];
+#define CRAM_BG (gb->ppu.cram_bg)
 
-static uint8_t *_bcps;
-#define BCPS (*_bcps)
+#define BCPS (* gb->ppu.bcps)
 #define BCPS_LOC 0xFF68
 
 //static uint8_t *_bcpd;
 //#define BCPD (*_bcpd)
 #define BCPD_LOC 0xFF69
 
-static int write_bcpd_handler (uint16_t adr, uint8_t v)
+static int write_bcpd_handler (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr != BCPD_LOC) return 0;
+	gb_ppu_sync (gb);
+	if (write_mode_block (gb, adr, v))
+		return 1;
 
 	uint8_t a = BCPS & 0x3F;
 	CRAM_BG[a] = v;
@@ -271,20 +271,18 @@ static int write_bcpd_handler (uint16_t adr, uint8_t v)
 	return 1;
 }
 
-static uint8_t CRAM_OBJ[64];
+#define CRAM_OBJ (gb->ppu.cram_obj)
 
-static uint8_t *_ocps;
-#define OCPS (*_ocps)
+#define OCPS (* gb->ppu.ocps)
 #define OCPS_LOC 0xFF6A
 
 //static uint8_t *_ocpd;
 //#define OCPD (*_ocpd)
 #define OCPD_LOC 0xFF6B
 
-static int write_ocpd_handler (uint16_t adr, uint8_t v)
+static int write_ocpd_handler (gb_t *gb, uint16_t adr, uint8_t v)
 {
-	if (adr != OCPD_LOC) return 0;
-
+	gb_ppu_sync (gb);
 	uint8_t a = OCPS & 0x3F;
 	CRAM_OBJ[a] = v;
 
@@ -305,27 +303,30 @@ static const uint16_t SHADES[4] = { 0xFFFF, 0xAD6A, 0x294A, 0x0000 };
 // put the desired color in the 2 least significant bits
 #define SHADE(pal, c) SHADES[(pal >> (c << 1)) & 0x03]
 
-/* get color @ (x, y) within 8x8 tile. */
-static uint8_t color_tile (uint8_t *tile, uint8_t x, uint8_t y)
+/* get the colors of row y within 8x8 tile, right to left if flipped. */
+static inline void tile_row (uint8_t *tile, uint8_t y, uint8_t flip, uint8_t *px)
 {
-	uint8_t shift = 7 - x;
 	y <<= 1; // y mul 2
 
-	uint8_t lsb = (tile[y] >> shift) & 1;
-	uint8_t msb = (tile[y | 1] >> shift) & 1;
+	uint8_t lsb = tile[y];
+	uint8_t msb = tile[y | 1];
 
-	return (msb << 1) | lsb; // color value 0-3
+	for (uint8_t x = 0; x < 8; x ++)
+	{
+		uint8_t shift = flip ? x : 7 - x;
+		px[x] = (((msb >> shift) & 1) << 1) | ((lsb >> shift) & 1); // color value 0-3
+	}
 }
 
-/* get color within background BG tile. */
-static inline uint8_t __color_bg_tile_dmg (uint8_t *t, uint8_t x, uint8_t y, uint8_t *)
+/* get the colors of a row within background BG tile. */
+static void __bg_tile_row_dmg (gb_t *gb, uint8_t *t, uint8_t y, uint8_t *px, uint8_t *)
 {
 	uint8_t n = *t;
 	uint16_t off = !BG_WIN_TILE ? 0x1000 + ((int8_t) n << 4) : n << 4;
-	return color_tile (vram_bank0 + off, x, y);
+	tile_row (vram_bank0 + off, y, 0, px);
 }
 
-static inline uint8_t __color_bg_tile_cgb (uint8_t *t, uint8_t x, uint8_t y, uint8_t *pal)
+static void __bg_tile_row_cgb (gb_t *gb, uint8_t *t, uint8_t y, uint8_t *px, uint8_t *pal)
 {
 	uint8_t n = *t;
 	uint16_t off = !BG_WIN_TILE ? 0x1000 + ((int8_t) n << 4) : n << 4;
@@ -337,50 +338,50 @@ static inline uint8_t __color_bg_tile_cgb (uint8_t *t, uint8_t x, uint8_t y, uin
 
 	// flip
 	if (att & 0x40) y = 7 - y;
-	if (att & 0x20) x = 7 - x;
 
 	*pal = att & 0x7;
 	uint8_t *tmp = (att & 0x8 ? vram_bank1 : vram_bank0) + off;
-	return color_tile (tmp, x, y);
+	tile_row (tmp, y, att & 0x20, px);
 }
 
-static uint8_t (*color_bg_tile) (uint8_t *, uint8_t, uint8_t, uint8_t *) ;
+#define bg_tile_row(t, y, px, pal) gb->ppu.bg_tile_row (gb, t, y, px, pal)
 
 /**
- * Draw BG pixel @ x,y in LCD.
+ * Fetch pixels [x0, x1) of the line from a tile map, with map coordinate (mx, my) at
+ * pixel x0. The uint8_t type of the coordinates makes sure to wrap around 255.
  */
-static inline uint8_t color_bg (uint8_t x, uint8_t *pal)
-{
-	// BG X and Y viewport, the uint8_t type makes sure to wrap around 255.
-	uint8_t bgx = (x + SCX), bgy = (LY + SCY);
-
-	// determine BG tile index in 32x32 tile map.
-	// (x div 8) + (y div 8) * 32
-	uint16_t _t = (bgx >> 3) + ((bgy & 0xF8) << 2);
-	uint8_t *t = &vram_bank0[BG_TILE_MAP + _t];
-
-	return color_bg_tile (t, bgx & 0x7, bgy & 0x7, pal);
-}
-
-static inline uint8_t color_win (uint8_t x, uint8_t *pal)
+static inline void fetch_tiles
+(
+	gb_t *gb,
+	uint16_t map, uint8_t mx, uint8_t my, int x0, int x1, uint8_t *c, uint8_t *pal
+)
 {
-	uint8_t winx = x - (WX - 7), winy = LY - WY;
+	uint8_t px[8], p = 0;
 
-	uint16_t _t = (winx >> 3) + ((winy & 0xF8) << 2);
-	uint8_t *t = &vram_bank0[WIN_TILE_MAP + _t];
+	while (x0 < x1)
+	{
+		// determine tile index in 32x32 tile map.
+		// (x div 8) + (y div 8) * 32
+		uint16_t _t = (mx >> 3) + ((my & 0xF8) << 2);
+		bg_tile_row (&vram_bank0[map + _t], my & 0x7, px, &p);
 
-	return color_bg_tile (t, winx & 0x7, winy & 0x7, pal);
+		for (uint8_t i = mx & 0x7; i < 8 && x0 < x1; i ++, mx ++, x0 ++)
+		{
+			c[x0] = px[i];
+			pal[x0] = p;
+		}
+	}
 }
 
-#define SPRITES_PER_LINE 10
+#define SPRITES_PER_LINE GB_PPU_SPRITES_PER_LINE
 
 /* Indices of the sprites that are visible on this line. */
-static uint8_t line_sprites[SPRITES_PER_LINE + 1];
+#define line_sprites (gb->ppu.line_sprites)
 
 #define RESET_LINE_SPRITES memset (line_sprites, 0xFF, SPRITES_PER_LINE + 1);
 
 /* Find (the first 10) sprites that are visible on the current line. */
-static inline void find_line_sprites ()
+static inline void find_line_sprites (gb_t *gb)
 {
 	uint8_t x, y, *sprite;
 
@@ -404,127 +405,158 @@ static inline void find_line_sprites ()
 	}
 }
 
-static inline uint8_t __color_obj_dmg
+static void __obj_tile_row_dmg
 (
-	uint8_t *sprite, uint8_t ti, uint8_t dx, uint8_t dy, uint8_t *pal
+	gb_t *gb,
+	uint8_t *sprite, uint8_t ti, uint8_t dy, uint8_t *px, uint8_t *pal
 )
 {
 	*pal = SPRITE_PALETTE (sprite) ? OBP1 : OBP0;
-	return color_tile (vram + (ti << 4), dx, dy);
+	tile_row (vram + (ti << 4), dy, SPRITE_XFLIP (sprite), px);
 }
 
-static inline uint8_t __color_obj_cgb
+static void __obj_tile_row_cgb
 (
-	uint8_t *sprite, uint8_t ti, uint8_t dx, uint8_t dy, uint8_t *pal
+	gb_t *gb,
+	uint8_t *sprite, uint8_t ti, uint8_t dy, uint8_t *px, uint8_t *pal
 )
 {
 	*pal = SPRITE_PALETTE_CGB (sprite);
 	uint8_t *vb = SPRITE_VRAM (sprite) ? vram_bank1 : vram_bank0;
-	return color_tile (vb + (ti << 4), dx, dy);
+	tile_row (vb + (ti << 4), dy, SPRITE_XFLIP (sprite), px);
 }
 
 /**
- * Pointer to function that will handle computing the color of the sprite at a fixed
- * coordinate within the tile. This differs depending if we are in CGB mode or not.
+ * Pointer to function that will get the colors of a row within a sprite. This differs
+ * depending if we are in CGB mode or not.
  *
- * Takes a pointer to the sprite bytes, a tile index, and x,y within the tile.
- * Returns the color index within the palette.
+ * Takes a pointer to the sprite bytes, a tile index, and y within the tile.
+ * Fills in the color index within the palette of the 8 pixels.
  */
-static uint8_t (*__color_obj) (uint8_t *, uint8_t, uint8_t, uint8_t, uint8_t *);
+#define obj_tile_row(s, ti, y, px, pal) gb->ppu.obj_tile_row (gb, s, ti, y, px, pal)
 
 /**
- * Compute (if) color of object at the current drawing coordinate.
+ * Fetch the sprite pixels [x0, x1) of the line, a color of zero means there is no
+ * sprite at the pixel. Sprites that come first have priority so they are fetched last
+ * on top of the others.
  */
-static inline uint8_t color_obj (uint8_t x, uint16_t bgc, uint8_t *c, uint8_t *pal)
+static inline void fetch_sprites (gb_t *gb, int x0, int x1, const uint8_t *bgc, uint8_t *c, uint8_t *pal)
 {
-	uint8_t *sprite;
-	int16_t dx;
-	uint8_t dy, ti, obc, obp;
+	uint8_t *sprite, px[8], p, dy, ti;
+	int n = 0, sx;
 
-	for (uint8_t *s = line_sprites; (*s) != 0xFF; s ++)
-	{
-		sprite = oam + ((*s) << 2);
+	while (line_sprites[n] != 0xFF) n ++;
 
-		// background priority
-		if (SPRITE_BG_PRIO (sprite) && bgc) continue;
+	for (int i = n - 1; i >= 0; i --)
+	{
+		sprite = oam + (line_sprites[i] << 2);
 
-		dx = x - sprite[1] + 8;
+		// pixels of the sprite within [x0, x1)
+		sx = sprite[1] - 8;
+		int from = sx > x0 ? sx : x0, to = sx + 8 < x1 ? sx + 8 : x1;
+		if (from >= to) continue;
 
-		if (dx >= 0 && dx < 8)
-		{
-			dy = LY - sprite[0] + 16;
+		dy = LY - sprite[0] + 16;
+		if (SPRITE_YFLIP (sprite))
+			dy = OBJ_SIZE - 1 - dy;
 
-			// flip
-			if (SPRITE_XFLIP (sprite))
-				dx = 7 - dx;
-			if (SPRITE_YFLIP (sprite))
-				dy = OBJ_SIZE - 1 - dy;
+		// tile
+		ti = sprite[2]; if (OBJ_SIZE == 16) ti &= 0xFE;
 
-			// tile
-			ti = sprite[2]; if (OBJ_SIZE == 16) ti &= 0xFE;
+		obj_tile_row (sprite, ti, dy, px, &p);
 
-			// tile color
-			obc = __color_obj (sprite, ti, dx, dy, &obp);
+		for (int x = from; x < to; x ++)
+		{
+			// background priority
+			if (SPRITE_BG_PRIO (sprite) && bgc[x]) continue;
 
-			if (obc)
+			if (px[x - sx])
 			{
-				*c = obc;
-				*pal = obp;
-				return 1;
+				c[x] = px[x - sx];
+				pal[x] = p;
 			}
 		}
 	}
-
-	return 0;
 }
 
-void gb_ppu_stall (uint32_t cc)
+/* Color indices and palettes of the pixels in the line being drawn. */
+typedef
+struct line
 {
-	dot += cc;
-	if (dot >= GB_SCANLINE) dot %= GB_FRAME;
+	uint8_t bgc[GB_LCD_WIDTH];  // BG only, for sprite priority
+	uint8_t c[GB_LCD_WIDTH];    // BG or window
+	uint8_t pal[GB_LCD_WIDTH];
+	uint8_t obc[GB_LCD_WIDTH];  // sprites
+	uint8_t obp[GB_LCD_WIDTH];
 }
+line;
 
-#define OAM_CC 80
-
-static inline void draw_dmg (uint16_t x)
+/* Fetch the BG, window and sprite pixels [x0, x1) of the current line. */
+static inline void fetch_line (gb_t *gb, int x0, int x1, line *l)
 {
-	uint8_t bgc = 0, c = 0, pal = BGP;
+	int n = x1 - x0;
 
 	// Background
 	if (BG_WIN_PRIO)
 	{
 		// BG
-		c = bgc = color_bg (x, 0);
+		fetch_tiles (gb, BG_TILE_MAP, x0 + SCX, LY + SCY, x0, x1, l->bgc, l->pal);
+		memcpy (l->c + x0, l->bgc + x0, n);
+
 		// WIN
-		if (WIN_DISP_ENABLED && (x >= (WX - 7)) && (LY >= WY))
-			c = color_win (x, 0);
+		int wx = WX - 7;
+		if (WIN_DISP_ENABLED && (wx < x1) && (LY >= WY))
+		{
+			int from = wx > x0 ? wx : x0;
+			fetch_tiles (gb, WIN_TILE_MAP, from - wx, LY - WY, from, x1, l->c, l->pal);
+		}
 	}
+	else
+	{
+		memset (l->bgc + x0, 0, n);
+		memset (l->c + x0, 0, n);
+		memset (l->pal + x0, 0, n);
+	}
+
 	// Sprite
+	memset (l->obc + x0, 0, n);
 	if (OBJ_ENABLED)
-		color_obj (x, bgc, &c, &pal);
+		fetch_sprites (gb, x0, x1, l->bgc, l->obc, l->obp);
+}
+
+void gb_ppu_stall (gb_t *gb, uint32_t cc)
+{
+	gb_ppu_sync (gb);
+	dot += cc;
+	if (dot >= GB_SCANLINE) dot %= GB_FRAME;
+	schedule_next (gb);
+}
+
+#define OAM_CC 80
+#define HBLANK_DOT (OAM_CC + GB_LCD_WIDTH + 12)
+
+/* Draw pixels [x0, x1) of the current line. */
+static void draw_dmg (gb_t *gb, int x0, int x1)
+{
+	line l;
+	uint16_t *buf = lcd_buf + LY * GB_LCD_WIDTH;
+
+	fetch_line (gb, x0, x1, &l);
 
-	lcd_buf[LY * GB_LCD_WIDTH + x] = SHADE (pal, c);
+	for (int x = x0; x < x1; x ++)
+		buf[x] = l.obc[x] ? SHADE (l.obp[x], l.obc[x]) : SHADE (BGP, l.c[x]);
 }
 
-static inline void draw_cgb (uint16_t x)
+static void draw_cgb (gb_t *gb, int x0, int x1)
 {
-	uint8_t bgc = 0, ci = 0, pal = 0;
-	uint16_t *cram = (uint16_t *) CRAM_BG;
+	line l;
+	uint16_t *buf = lcd_buf + LY * GB_LCD_WIDTH;
+	uint16_t *cram_bg = (uint16_t *) CRAM_BG, *cram_obj = (uint16_t *) CRAM_OBJ;
 
 	// TODO
 	// implement correct priorities
 
-	// Background
-	if (BG_WIN_PRIO)
-	{
-		// BG
-		ci = bgc = color_bg (x, &pal);
-		// WIN
-		if (WIN_DISP_ENABLED && (x >= (WX - 7)) && (LY >= WY))
-			ci = color_win (x, &pal);
-	}
-	// Sprite
-	if (OBJ_ENABLED && color_obj (x, bgc, &ci, &pal)) cram = (uint16_t *) CRAM_OBJ;
+	fetch_line (gb, x0, x1, &l);
 
 	// TODO
 	// I shift away the unused MSB to make the LSB cleared, this is to be compatible
@@ -535,15 +567,21 @@ static inline void draw_cgb (uint16_t x)
 	// takes care of transforming the value the way they are going to represent it.
 
 	// 4 colors / palette × 2 B / colors = 8 B / palette = 4 uint16_t / palette
-	lcd_buf[LY * GB_LCD_WIDTH + x] = cram[(pal << 2) + ci] << 1;
+	for (int x = x0; x < x1; x ++)
+		buf[x] = (l.obc[x] ? cram_obj[(l.obp[x] << 2) + l.obc[x]] : cram_bg[(l.pal[x] << 2) + l.c[x]]) << 1;
 }
 
-static void (*draw) (uint16_t);
+#define draw(x0, x1) gb->ppu.draw (gb, x0, x1)
 
-/* step the PPU one dot. */
-static inline void step ()
+/**
+ * Step the PPU up to the next dot where the mode can change, but at most `cc` dots.
+ * The pixels within the dots are drawn in one go.
+ *
+ * Returns the number of dots stepped.
+ */
+static inline uint32_t step (gb_t *gb, uint32_t cc)
 {
-	if (!LCD_ENABLED) return;
+	uint32_t n;
 
 	// start of new scanline.
 	if (dot == 0)
@@ -553,23 +591,23 @@ static inline void step ()
 		{
 			STATUS |= LYC_EQ_LQ_FLAG;
 			if (LYC_EQ_LY_INT)
-				gb_cpu_flag_interrupt (INT_FLAG_LCD_STAT);
+				gb_cpu_flag_interrupt (gb, INT_FLAG_LCD_STAT);
 		}
 		// OAM search
 		if (LY < GB_LCD_HEIGHT)
 		{
 			SET_MODE (MODE_SEARCH_OAM);
 			if (MODE_2_OAM_INT)
-				gb_cpu_flag_interrupt (INT_FLAG_LCD_STAT);
-			find_line_sprites ();
+				gb_cpu_flag_interrupt (gb, INT_FLAG_LCD_STAT);
+			find_line_sprites (gb);
 		}
 		// V-BLANK
 		else if (LY == GB_LCD_HEIGHT)
 		{
-			gb_cpu_flag_interrupt (INT_FLAG_VBLANK);
+			gb_cpu_flag_interrupt (gb, INT_FLAG_VBLANK);
 			SET_MODE (MODE_VBLANK);
 			if (MODE_1_VBLANK_INT)
-				gb_cpu_flag_interrupt (INT_FLAG_LCD_STAT);
+				gb_cpu_flag_interrupt (gb, INT_FLAG_LCD_STAT);
 
 			// Transfer data to LCD
 			if (lcd == __lcd_1)
@@ -582,107 +620,183 @@ static inline void step ()
 			}
 		}
 	}
-	// else - if we are on a visible line and past mode 2
-	else if (LY < GB_LCD_HEIGHT && dot >= OAM_CC)
+	else if (LY < GB_LCD_HEIGHT && dot == OAM_CC)
+	{
+		SET_MODE (MODE_TRANSFER_LCD);
+	}
+	// H-BLANK
+	else if (LY < GB_LCD_HEIGHT && dot == HBLANK_DOT)
 	{
-		uint16_t x = dot - OAM_CC;
+		SET_MODE (MODE_HBLANK);
+		if (MODE_0_HBLANK_INT)
+			gb_cpu_flag_interrupt (gb, INT_FLAG_LCD_STAT);
+	}
 
-		if (x == 0) SET_MODE (MODE_TRANSFER_LCD);
+	// dots until the next one where the mode can change
+	if (dot < OAM_CC)
+		n = OAM_CC - dot;
+	else if (dot < HBLANK_DOT)
+		n = HBLANK_DOT - dot;
+	else if (dot < GB_SCANLINE)
+		n = GB_SCANLINE - dot;
+	else
+		n = 1;
+	if (n > cc) n = cc;
 
-		if (x < GB_LCD_WIDTH) draw (x);
-		// H-BLANK
-		else if (x == (GB_LCD_WIDTH + 12))
-		{
-			SET_MODE (MODE_HBLANK);
-			if (MODE_0_HBLANK_INT)
-				gb_cpu_flag_interrupt (INT_FLAG_LCD_STAT);
-		}
+	// draw the pixels on a visible line, dot OAM_CC + x draws pixel x.
+	if (LY < GB_LCD_HEIGHT && dot >= OAM_CC && dot < OAM_CC + GB_LCD_WIDTH)
+	{
+		int x = dot - OAM_CC;
+		draw (x, x + n < GB_LCD_WIDTH ? x + n : GB_LCD_WIDTH);
 	}
 
 	// step the dot counter and line
-	dot ++;
+	dot += n;
 	if (dot >= GB_SCANLINE)
 	{
 		dot -= GB_SCANLINE;
 		LY ++; if (LY == GB_SCANLINES) LY = 0;
 		if (LYC_EQ_LY && LYC != LY) STATUS &= ~LYC_EQ_LQ_FLAG;
 	}
+
+	return n;
 }
 
-void gb_ppu_step (uint32_t cc)
+void gb_ppu_step (gb_t *gb, uint32_t cc)
 {
-	for (; cc > 0; cc --) step ();
+	gb->ppu.cc += cc;
+	if (!LCD_ENABLED) return;  // nothing happens while the LCD is off
+	while (cc > 0) cc -= step (gb, cc);
 }
 
-void gb_ppu_reset (uint8_t dmg)
+void gb_ppu_sync (gb_t *gb)
 {
-	lcdc_   = gb_cpu_mem (LCDC_LOC);
-	status_ = gb_cpu_mem (STATUS_LOC);
-	scy_    = gb_cpu_mem (0xFF42);
-	scx_    = gb_cpu_mem (0xFF43);
-	ly_     = gb_cpu_mem (0xFF44);
-	lyc_    = gb_cpu_mem (0xFF45);
-	wy_     = gb_cpu_mem (0xFF4A);
-	wx_     = gb_cpu_mem (0xFF4B);
-	bgp_    = gb_cpu_mem (0xFF47);
-	obp0_   = gb_cpu_mem (0xFF48);
-	obp1_   = gb_cpu_mem (0xFF49);
+	gb_ppu_step (gb, gb->cc - gb->ppu.cc);
+}
+
+/**
+ * Schedule the next step that changes state the CPU can see; the start of a mode or
+ * the end of the scanline. Pixels in between are drawn when catching up.
+ */
+static void schedule_next (gb_t *gb)
+{
+	uint32_t n;  // steps until the change has been made
+
+	if (!LCD_ENABLED)
+	{
+		gb_sched_cancel (gb, GB_EVENT_PPU);
+		return;
+	}
+
+	if (dot == 0 || dot >= GB_SCANLINE)
+		n = 1;
+	else if (LY < GB_LCD_HEIGHT && dot <= OAM_CC)
+		n = OAM_CC - dot + 1;
+	else if (LY < GB_LCD_HEIGHT && dot <= HBLANK_DOT)
+		n = HBLANK_DOT - dot + 1;
+	else
+		n = GB_SCANLINE - dot;
+
+	gb_sched_schedule (gb, GB_EVENT_PPU, gb->ppu.cc + n);
+}
+
+static void ppu_event (gb_t *gb)
+{
+	gb_ppu_sync (gb);
+	schedule_next (gb);
+}
+
+void gb_ppu_reset (gb_t *gb, uint8_t dmg)
+{
+	gb->ppu.lcdc   = gb_cpu_mem (gb, LCDC_LOC);
+	gb->ppu.status = gb_cpu_mem (gb, STATUS_LOC);
+	gb->ppu.scy    = gb_cpu_mem (gb, 0xFF42);
+	gb->ppu.scx    = gb_cpu_mem (gb, 0xFF43);
+	gb->ppu.ly     = gb_cpu_mem (gb, 0xFF44);
+	gb->ppu.lyc    = gb_cpu_mem (gb, 0xFF45);
+	gb->ppu.wy     = gb_cpu_mem (gb, 0xFF4A);
+	gb->ppu.wx     = gb_cpu_mem (gb, 0xFF4B);
+	gb->ppu.bgp    = gb_cpu_mem (gb, 0xFF47);
+	gb->ppu.obp0   = gb_cpu_mem (gb, 0xFF48);
+	gb->ppu.obp1   = gb_cpu_mem (gb, 0xFF49);
 
 	LCDC = 0x91; // NOTE a lot of games do not set the LCD enabled when starting....
 	BGP = 0xFC;
 	OBP0 = OBP1 = 0xFF;
 
-	vram = vram_bank0 = gb_cpu_mem (VRAM_LOC);
-	oam = gb_cpu_mem (OAM_LOC);
+	vram = vram_bank0 = gb_cpu_mem (gb, VRAM_LOC);
+	oam = gb_cpu_mem (gb, OAM_LOC);
+	map_vram (gb, MODE);
 
 	dot = LY = 0;
+	gb->ppu.cc = gb->cc;
 
 	RESET_LINE_SPRITES
 
-	gb_cpu_register_read_handler (read_mode_block);
+	gb_cpu_register_read_handler (gb, VRAM_LOC, 0x9FFF, 0, read_mode_block);
+	gb_cpu_register_read_handler (gb, OAM_LOC, 0xFE9F, 0, read_mode_block);
+	gb_cpu_register_read_handler (gb, BCPD_LOC, BCPD_LOC, 0, read_mode_block);
 
-	gb_cpu_register_store_handler (write_mode_block);
-	gb_cpu_register_store_handler (write_status_h);
-	gb_cpu_register_store_handler (write_lcdc_h);
-	gb_cpu_register_store_handler (write_ly_h);
+	gb_cpu_register_store_handler (gb, VRAM_LOC, 0x9FFF, 0, write_mode_block);
+	gb_cpu_register_store_handler (gb, OAM_LOC, 0xFE9F, 0, write_mode_block);
+	gb_cpu_register_store_handler (gb, STATUS_LOC, STATUS_LOC, 0, write_status_h);
+	gb_cpu_register_store_handler (gb, LCDC_LOC, LCDC_LOC, 0, write_lcdc_h);
+	gb_cpu_register_store_handler (gb, LY_LOC, LY_LOC, 0, write_ly_h);
+	gb_cpu_register_store_handler (gb, 0xFF42, 0xFF43, 0, write_sync_h);
+	gb_cpu_register_store_handler (gb, 0xFF45, 0xFF45, 0, write_sync_h);
+	gb_cpu_register_store_handler (gb, 0xFF47, 0xFF4B, 0, write_sync_h);
 
 	if (!dmg)
 	{
-		_vbk = gb_cpu_mem (VBK_LOC);
-		_ocps = gb_cpu_mem (OCPS_LOC);
-		_bcps = gb_cpu_mem (BCPS_LOC);
+		gb->ppu.vbk  = gb_cpu_mem (gb, VBK_LOC);
+		gb->ppu.ocps = gb_cpu_mem (gb, OCPS_LOC);
+		gb->ppu.bcps = gb_cpu_mem (gb, BCPS_LOC);
 
-		gb_cpu_register_store_handler (write_vbk_handler);
-		gb_cpu_register_store_handler (write_vram_handler);
-		gb_cpu_register_store_handler (write_bcpd_handler);
-		gb_cpu_register_store_handler (write_ocpd_handler);
-
-		gb_cpu_register_read_handler (read_vram_handler);
+		gb_cpu_register_store_handler (gb, VBK_LOC, VBK_LOC, 0, write_vbk_handler);
+		gb_cpu_register_store_handler (gb, BCPD_LOC, BCPD_LOC, 0, write_bcpd_handler);
+		gb_cpu_register_store_handler (gb, OCPD_LOC, OCPD_LOC, 0, write_ocpd_handler);
+		gb_cpu_register_store_handler (gb, BCPS_LOC, BCPS_LOC, 0, write_sync_h);
+		gb_cpu_register_store_handler (gb, OCPS_LOC, OCPS_LOC, 0, write_sync_h);
 
 		memset (CRAM_BG, 0, 64);
 		memset (CRAM_OBJ, 0, 64);
 
-		draw = draw_cgb;
-		__color_obj = __color_obj_cgb;
-		color_bg_tile = __color_bg_tile_cgb;
+		gb->ppu.draw = draw_cgb;
+		gb->ppu.obj_tile_row = __obj_tile_row_cgb;
+		gb->ppu.bg_tile_row = __bg_tile_row_cgb;
 	}
 	else
 	{
-		draw = draw_dmg;
-		__color_obj = __color_obj_dmg;
-		color_bg_tile = __color_bg_tile_dmg;
+		gb->ppu.draw = draw_dmg;
+		gb->ppu.obj_tile_row = __obj_tile_row_dmg;
+		gb->ppu.bg_tile_row = __bg_tile_row_dmg;
 	}
 
-	memset (__lcd_1, 0, NPIXELS * sizeof (uint16_t));
-	memset (__lcd_2, 0, NPIXELS * sizeof (uint16_t));
+	memset (__lcd_1, 0, sizeof (__lcd_1));
+	memset (__lcd_2, 0, sizeof (__lcd_2));
 	lcd = __lcd_1;
 	lcd_buf = __lcd_2;
+
+	gb_sched_register (gb, GB_EVENT_PPU, ppu_event);
+	schedule_next (gb);
 }
 
 #ifdef DEBUG_PPU
 
+/* get color @ (x, y) within 8x8 tile. */
+static uint8_t color_tile (uint8_t *tile, uint8_t x, uint8_t y)
+{
+	uint8_t shift = 7 - x;
+	y <<= 1; // y mul 2
+
+	uint8_t lsb = (tile[y] >> shift) & 1;
+	uint8_t msb = (tile[y | 1] >> shift) & 1;
+
+	return (msb << 1) | lsb; // color value 0-3
+}
+
 /* get color within sprite. */
-static inline uint8_t color_sprite (uint8_t n, uint8_t x, uint8_t y)
+static inline uint8_t color_sprite (gb_t *gb, uint8_t n, uint8_t x, uint8_t y)
 {
 	if (OBJ_SIZE == 16) n &= 0xFE;
 	return color_tile (vram + (n << 4), x, y);
@@ -710,7 +824,7 @@ static inline void print_tile (uint8_t* t)
 	printf ("\n");
 }
 
-static inline void print_sprite (uint8_t s)
+static inline void print_sprite (gb_t *gb, uint8_t s)
 {
 	uint8_t* sprite = oam + (s << 2);
 
@@ -735,13 +849,13 @@ static inline void print_sprite (uint8_t s)
 	print_tile (tile);
 }
 
-static inline void print_oam ()
+static inline void print_oam (gb_t *gb)
 {
 	for (int i = 0; i < 40; i ++)
-		print_sprite (i);
+		print_sprite (gb, i);
 }
 
-static inline void print_bg (uint8_t bg)
+static inline void print_bg (gb_t *gb, uint8_t bg)
 {
 
 }
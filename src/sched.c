@@ -0,0 +1,72 @@
+#include "gb/sched.h"
+#include "gb/core.h"
+#include <string.h>
+
+#define SCHED (gb->sched)
+
+#define NEVER UINT64_MAX
+
+/* update the cached deadline of the earliest event. */
+static inline void update_next (gb_t *gb)
+{
+	SCHED.next = SCHED.n ? SCHED.at[SCHED.queue[0]] : NEVER;
+}
+
+/* remove the event from the queue, returns zero if it was not pending. */
+static int dequeue (gb_t *gb, gb_event e)
+{
+	for (int i = 0; i < SCHED.n; i ++)
+	{
+		if (SCHED.queue[i] != e) continue;
+
+		SCHED.n --;
+		memmove (SCHED.queue + i, SCHED.queue + i + 1, (SCHED.n - i) * sizeof (gb_event));
+		return 1;
+	}
+	return 0;
+}
+
+void gb_sched_reset (gb_t *gb)
+{
+	memset (&SCHED, 0, sizeof (gb_sched));
+	update_next (gb);
+}
+
+void gb_sched_register (gb_t *gb, gb_event e, gb_event_handler h)
+{
+	SCHED.handlers[e] = h;
+}
+
+void gb_sched_schedule (gb_t *gb, gb_event e, uint64_t cc)
+{
+	dequeue (gb, e);
+	SCHED.at[e] = cc;
+
+	// events with the same deadline run in the order they were scheduled
+	int i = SCHED.n;
+	while (i > 0 && SCHED.at[SCHED.queue[i - 1]] > cc) i --;
+
+	memmove (SCHED.queue + i + 1, SCHED.queue + i, (SCHED.n - i) * sizeof (gb_event));
+	SCHED.queue[i] = e;
+	SCHED.n ++;
+
+	update_next (gb);
+}
+
+void gb_sched_cancel (gb_t *gb, gb_event e)
+{
+	if (dequeue (gb, e)) update_next (gb);
+}
+
+void gb_sched_dispatch (gb_t *gb)
+{
+	while (SCHED.n && SCHED.at[SCHED.queue[0]] <= gb->cc)
+	{
+		gb_event e = SCHED.queue[0];
+		dequeue (gb, e);
+		update_next (gb);
+
+		// the handler is free to schedule the event again
+		if (SCHED.handlers[e]) SCHED.handlers[e] (gb);
+	}
+}
@@ -0,0 +1,305 @@
+/**
+ * Save states.
+ *
+ * The state is written as a flat list of fields in the native byte order. The same
+ * list is walked to count, save and load so the three can not get out of sync.
+ *
+ * Pointers are stored as references to the memory they point into, see `ref`. The
+ * handlers, register pointers and ROM stay as they were set up by `gb_load`.
+ */
+#include "gb/core.h"
+#include "gb.h"
+#include <string.h>
+
+#define STATE_MAGIC "GBST"
+#define STATE_VERSION 1
+
+/* Cartridge header from the title up to and including the global checksum. */
+#define HEADER_LOC 0x0134
+#define HEADER_SIZE 0x1C
+
+enum op
+{
+	OP_COUNT,
+	OP_SAVE,
+	OP_LOAD,
+};
+
+/* Copy a block between the state and the buffer depending on the operation. */
+#define BLOCK(p, n) \
+	do { \
+		if (op == OP_SAVE) memcpy (buf + len, (p), (n)); \
+		else if (op == OP_LOAD) memcpy ((p), buf + len, (n)); \
+		len += (n); \
+	} while (0)
+
+#define FIELD(x) BLOCK (&(x), sizeof (x))
+
+/* Memory that pointers can point into, a reference is the region and the offset. */
+enum region
+{
+	REGION_NONE,
+	REGION_RAM,
+	REGION_WRAM,
+	REGION_VRAM1,
+	REGION_ROM,
+	REGION_MBC_RAM,
+};
+
+#define REF(r, off) (((uint32_t) (r) << 24) | (uint32_t) (off))
+
+#define WITHIN(p, base, size) ((p) >= (base) && (p) < (base) + (size))
+
+/* reference to the memory that p points into. */
+static uint32_t ref (gb_t *gb, const uint8_t *p)
+{
+	const uint8_t *rom = gb->cpu.rom;
+
+	if (!p)
+		return REF (REGION_NONE, 0);
+	else if (WITHIN (p, gb->cpu.ram, sizeof (gb->cpu.ram)))
+		return REF (REGION_RAM, p - gb->cpu.ram);
+	else if (WITHIN (p, gb->cpu.wram, sizeof (gb->cpu.wram)))
+		return REF (REGION_WRAM, p - gb->cpu.wram);
+	else if (WITHIN (p, gb->ppu.vram_bank1, sizeof (gb->ppu.vram_bank1)))
+		return REF (REGION_VRAM1, p - gb->ppu.vram_bank1);
+	else if (WITHIN (p, rom, gb->cpu.n_rom_banks * ROM_BANK_SIZE))
+		return REF (REGION_ROM, p - rom);
+
+	// the MBC can map banks past the end of RAM that is too small for it
+	return REF (REGION_MBC_RAM, p - gb->mbc.ram);
+}
+
+/* pointer from a reference. */
+static uint8_t *deref (gb_t *gb, uint32_t r)
+{
+	uint32_t off = r & 0xFFFFFF;
+
+	switch (r >> 24)
+	{
+		case REGION_RAM: return gb->cpu.ram + off;
+		case REGION_WRAM: return gb->cpu.wram + off;
+		case REGION_VRAM1: return gb->ppu.vram_bank1 + off;
+		case REGION_ROM: return (uint8_t *) gb->cpu.rom + off;
+		case REGION_MBC_RAM: return gb->mbc.ram + off;
+	}
+	return NULL;
+}
+
+/* Pointer field, stored as a reference. */
+#define POINTER(x) \
+	do { \
+		uint32_t r = ref (gb, (x)); \
+		FIELD (r); \
+		if (op == OP_LOAD) (x) = deref (gb, r); \
+	} while (0)
+
+static size_t cpu (gb_t *gb, uint8_t *buf, enum op op)
+{
+	size_t len = 0;
+
+	FIELD (gb->cpu.regs);
+	FIELD (gb->cpu.f_halt);
+	FIELD (gb->cpu.ime);
+	FIELD (gb->cpu.divcc);
+	FIELD (gb->cpu.timacc);
+	FIELD (gb->cpu.timer_cc);
+	FIELD (gb->cpu.ram);
+	FIELD (gb->cpu.wram);
+	POINTER (gb->cpu.wram_bank);
+
+	for (int i = 0; i < GB_CPU_PAGES; i ++)
+	{
+		POINTER (gb->cpu.read_map[i]);
+		POINTER (gb->cpu.store_map[i]);
+	}
+
+	return len;
+}
+
+static size_t ppu (gb_t *gb, uint8_t *buf, enum op op)
+{
+	size_t len = 0;
+
+	FIELD (gb->ppu.dot);
+	FIELD (gb->ppu.cc);
+	POINTER (gb->ppu.vram);
+	FIELD (gb->ppu.vram_bank1);
+	FIELD (gb->ppu.cram_bg);
+	FIELD (gb->ppu.cram_obj);
+	FIELD (gb->ppu.line_sprites);
+
+	// the frame being shown and the one being drawn
+	uint8_t swapped = gb->ppu.lcd == gb->ppu.lcd_2;
+	FIELD (swapped);
+	if (op == OP_LOAD)
+	{
+		gb->ppu.lcd = swapped ? gb->ppu.lcd_2 : gb->ppu.lcd_1;
+		gb->ppu.lcd_buf = swapped ? gb->ppu.lcd_1 : gb->ppu.lcd_2;
+	}
+	FIELD (gb->ppu.lcd_1);
+	FIELD (gb->ppu.lcd_2);
+
+	return len;
+}
+
+#define ENVELOPE(e) \
+	do { \
+		FIELD ((e).cc); \
+		FIELD ((e).enabled); \
+		FIELD ((e).vol); \
+	} while (0)
+
+static size_t apu (gb_t *gb, uint8_t *buf, enum op op)
+{
+	size_t len = 0;
+
+	FIELD (gb->apu.enabled_ch);
+
+	FIELD (gb->apu.ch1_cc);
+	FIELD (gb->apu.ch1_duty_cc);
+	FIELD (gb->apu.ch1_len);
+	FIELD (gb->apu.ch1_shadow);
+	FIELD (gb->apu.ch1_sweep_cc);
+	ENVELOPE (gb->apu.ch1_env);
+
+	FIELD (gb->apu.ch2_cc);
+	FIELD (gb->apu.ch2_duty_cc);
+	FIELD (gb->apu.ch2_len);
+	ENVELOPE (gb->apu.ch2_env);
+
+	FIELD (gb->apu.wav_cc);
+	FIELD (gb->apu.wav_duty);
+	FIELD (gb->apu.wav_len);
+
+	FIELD (gb->apu.noi_cc);
+	FIELD (gb->apu.lfsr);
+	FIELD (gb->apu.noi_len);
+	ENVELOPE (gb->apu.noi_env);
+
+	FIELD (gb->apu.fs);
+	FIELD (gb->apu.fs_cc);
+	FIELD (gb->apu.cc);
+	FIELD (gb->apu.apucc);
+
+	// samples that have not been retrieved are not part of the state
+	if (op == OP_LOAD) gb->apu.samples_len = 0;
+
+	return len;
+}
+
+static size_t mbc (gb_t *gb, uint8_t *buf, enum op op)
+{
+	size_t len = 0;
+
+	FIELD (gb->mbc.ram_enabled);
+	BLOCK (gb->mbc.ram, gb->mbc.ram_size);
+
+	// the MBC3 registers cover the ones of the other controllers as they share memory.
+	FIELD (gb->mbc.mbc3.rtc);
+	uint8_t rtc = WITHIN (gb->mbc.mbc3.rtc_, gb->mbc.mbc3.rtc, 5) ?
+		gb->mbc.mbc3.rtc_ - gb->mbc.mbc3.rtc :
+		0xFF;
+	FIELD (rtc);
+	if (op == OP_LOAD) gb->mbc.mbc3.rtc_ = rtc < 5 ? gb->mbc.mbc3.rtc + rtc : NULL;
+	FIELD (gb->mbc.mbc3.cc);
+	FIELD (gb->mbc.mbc3.synced);
+	FIELD (gb->mbc.mbc3.timer);
+	FIELD (gb->mbc.mbc3.day_count_overflow);
+	FIELD (gb->mbc.mbc3.rom_bank);
+	FIELD (gb->mbc.mbc3.ram_bank);
+	FIELD (gb->mbc.mbc3.flag_read_rtc);
+	FIELD (gb->mbc.mbc3.f_rtc_latched);
+
+	return len;
+}
+
+static size_t sched (gb_t *gb, uint8_t *buf, enum op op)
+{
+	size_t len = 0;
+
+	FIELD (gb->sched.next);
+	FIELD (gb->sched.at);
+	FIELD (gb->sched.queue);
+	FIELD (gb->sched.n);
+
+	return len;
+}
+
+/* Walk the whole state, returns its size. */
+static size_t state (gb_t *gb, uint8_t *buf, enum op op)
+{
+	size_t len = 0;
+
+	FIELD (gb->cc);
+	FIELD (gb->step_end);
+	FIELD (gb->io.key_states);
+
+	len += cpu (gb, buf ? buf + len : NULL, op);
+	len += ppu (gb, buf ? buf + len : NULL, op);
+	len += apu (gb, buf ? buf + len : NULL, op);
+	len += mbc (gb, buf ? buf + len : NULL, op);
+	len += sched (gb, buf ? buf + len : NULL, op);
+
+	return len;
+}
+
+/**
+ * The state starts with a header to make sure it is loaded into the same version of
+ * the emulator running the same game.
+ */
+typedef
+struct state_header
+{
+	char magic[4];
+	uint32_t version;
+	uint8_t cartridge[HEADER_SIZE];
+	uint32_t ram_size;
+	uint32_t size;
+}
+state_header;
+
+static void header (gb_t *gb, state_header *h)
+{
+	memset (h, 0, sizeof (state_header));
+	memcpy (h->magic, STATE_MAGIC, 4);
+	h->version = STATE_VERSION;
+	memcpy (h->cartridge, gb->cpu.rom + HEADER_LOC, HEADER_SIZE);
+	h->ram_size = gb->mbc.ram_size;
+	h->size = state (gb, NULL, OP_COUNT);
+}
+
+size_t gb_state_size (gb_t *gb)
+{
+	return sizeof (state_header) + state (gb, NULL, OP_COUNT);
+}
+
+int gb_state_save (gb_t *gb, uint8_t *buf, size_t size)
+{
+	if (size < gb_state_size (gb)) return 1;
+
+	// decoded blocks are not part of the state, the memory map is saved without them
+	gb_cpu_flush (gb);
+
+	state_header h;
+	header (gb, &h);
+	memcpy (buf, &h, sizeof (state_header));
+	state (gb, buf + sizeof (state_header), OP_SAVE);
+
+	return 0;
+}
+
+int gb_state_load (gb_t *gb, const uint8_t *buf, size_t size)
+{
+	state_header h;
+	if (size < sizeof (state_header)) return 1;
+	header (gb, &h);
+	if (memcmp (buf, &h, sizeof (state_header)) != 0) return 1;
+	if (size < sizeof (state_header) + h.size) return 1;
+
+	// fields are only copied from the buffer when loading
+	gb_cpu_flush (gb);
+	state (gb, (uint8_t *) buf + sizeof (state_header), OP_LOAD);
+
+	return 0;
+}